@@ -0,0 +1,448 @@
+/**
+ * WDDR Bench  - Application that times PHY firmware hot paths on target
+ *
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <compiler.h>
+
+/* Image header includes. */
+#include <image.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Kernel includes. */
+#include <kernel/io.h>
+#include <cycles.h>
+
+/* LPDDR includes. */
+#include <wddr/memory_map.h>
+#include <wddr/device.h>
+#include <wddr/driver.h>
+#include <dfi/buffer.h>
+#include <dfi/packet.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define MAIN_TASK_PRIORITY          (tskIDLE_PRIORITY + 3)
+#define MAIN_STACK_SIZE             (configMINIMAL_STACK_SIZE * 2)
+
+#define WDDR_BASE_ADDR              (0x00000000)
+
+// Runs per benchmark; full boot is far more expensive than the rest
+#define BENCH_RUNS                  (64)
+#define BENCH_BOOT_RUNS             (8)
+
+// Number of packets written into IG FIFO by the DFI fill benchmark
+#define BENCH_DFI_PACKET_NUM        (16)
+
+/**
+ * @brief   Benchmark Report Format
+ *
+ * @details Each result is published through the MCU GP registers. GP1 holds
+ *          the median and GP2 the p99 in cycles, then GP0 is written with
+ *          the descriptor below. Host acknowledges by clearing GP0. GP3 is
+ *          written with BENCH_REPORT_DONE after the last result.
+ *
+ * VALID    descriptor is valid.
+ * ID       benchmark ID (bench_id_t).
+ * ARG      benchmark argument (MSR, frequency, packets or channel / byte).
+ * RUNS     number of runs.
+ */
+#define BENCH_REPORT__VALID__MSK    (0x80000000)
+#define BENCH_REPORT__VALID__SHFT   (31)
+#define BENCH_REPORT__ID__MSK       (0x7F000000)
+#define BENCH_REPORT__ID__SHFT      (24)
+#define BENCH_REPORT__ARG__MSK      (0x00FF0000)
+#define BENCH_REPORT__ARG__SHFT     (16)
+#define BENCH_REPORT__RUNS__MSK     (0x0000FFFF)
+#define BENCH_REPORT__RUNS__SHFT    (0)
+
+#define BENCH_REPORT_DONE           (0xBE7C0000)
+
+// Channel / byte packed into benchmark argument
+#define BENCH_ARG_SA(channel, byte) (((channel) << 4) | (byte))
+
+/*******************************************************************************
+**                            STRUCTURE DECLARATIONS
+*******************************************************************************/
+/**
+ * @brief   Benchmark ID Enumeration
+ *
+ * CONFIGURE_PHY    wddr_configure_phy of WDDR_PHY_BOOT_FREQ (ARG: MSR).
+ * MRW_UPDATE       wddr_prep_freq_switch_mrw_update (ARG: frequency).
+ * DFI_FILL         dfi_buffer_fill_packets (ARG: packets).
+ * ZQCAL            cmn_zqcal_calibrate.
+ * SA_CAL           Sense Amp calibration of one byte (ARG: channel / byte).
+ * PLL_CAL          pll_calibrate_vco (ARG: frequency).
+ * BOOT             full wddr_boot with calibration.
+ */
+typedef enum bench_id
+{
+    BENCH_ID_CONFIGURE_PHY,
+    BENCH_ID_MRW_UPDATE,
+    BENCH_ID_DFI_FILL,
+    BENCH_ID_ZQCAL,
+    BENCH_ID_SA_CAL,
+    BENCH_ID_PLL_CAL,
+    BENCH_ID_BOOT,
+} bench_id_t;
+
+/**
+ * @brief   Benchmark Function
+ *
+ * @details Runs a single iteration of a benchmark, including any setup it
+ *          needs, and returns only the cycles of the operation under test.
+ */
+typedef uint32_t (*bench_fn_t)(uint8_t arg);
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+static void vMainTask( void *pvParameters );
+/** @brief  Centralized shutdown function */
+static void shutdown(uint32_t cause);
+
+/** @brief  Runs a benchmark and publishes median / p99 */
+static void bench_run(bench_id_t id, uint8_t arg, uint16_t runs, bench_fn_t fn);
+
+/** @brief  Publishes a single benchmark result through the GP registers */
+static void bench_report(bench_id_t id, uint8_t arg, uint16_t runs, uint32_t median, uint32_t p99);
+
+static uint32_t bench_configure_phy(uint8_t msr);
+static uint32_t bench_mrw_update(uint8_t freq_id);
+static uint32_t bench_dfi_fill(uint8_t num);
+static uint32_t bench_zqcal(uint8_t arg);
+static uint32_t bench_sa_cal(uint8_t arg);
+static uint32_t bench_pll_cal(uint8_t freq_id);
+static uint32_t bench_boot(uint8_t arg);
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+extern uint32_t __start;
+img_hdr_t image_hdr __attribute__((section(".image_hdr"))) = {
+    .image_magic = IMAGE_MAGIC,
+    .image_hdr_version = IMAGE_VERSION_CURRENT,
+    .image_type = IMAGE_TYPE_APP,
+    .version_major = FW_VERSION_MAJOR,
+    .version_minor = FW_VERSION_MINOR,
+    .version_patch = FW_VERSION_PATCH,
+    .vector_addr = (uint32_t) &__start,
+    .device_id = IMAGE_DEVICE_ID_HOST,
+    .git_dirty = GIT_DIRTY,
+    .git_ahead = GIT_AHEAD,
+    .git_sha = GIT_SHA,
+    // populated as part of a post compilation step
+    .crc = 0,
+    .data_size = 0,
+};
+
+// Benchmarks own the PHY; the PHY firmware task isn't started
+static DECLARE_WDDR_TABLE(table);
+static wddr_dev_t wddr __attribute__ ((section (".data"))) = {0};
+
+static uint32_t samples[BENCH_RUNS];
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+int main( void )
+{
+    wddr_init(&wddr, WDDR_BASE_ADDR, &table);
+
+    xTaskCreate( vMainTask, "Main Task", MAIN_STACK_SIZE, NULL, MAIN_TASK_PRIORITY, NULL );
+
+    /* Start the tasks and timer running. */
+    vTaskStartScheduler();
+
+    /* If all is well, the scheduler will now be running, and the following
+    line will never be reached.  If the following line does execute, then
+    there was insufficient FreeRTOS heap memory available for the Idle and/or
+    timer tasks to be created.
+    or task have stoppped the Scheduler */
+}
+
+/*-----------------------------------------------------------*/
+static void vMainTask( void *pvParameters )
+{
+    // Full boot first; remaining benchmarks need a booted PHY
+    bench_run(BENCH_ID_BOOT, 0, BENCH_BOOT_RUNS, bench_boot);
+
+    for (uint8_t freq_id = 0; freq_id < WDDR_PHY_VALID_FREQ_NUM; freq_id++)
+    {
+        bench_run(BENCH_ID_PLL_CAL, freq_id, BENCH_RUNS, bench_pll_cal);
+    }
+
+    bench_run(BENCH_ID_ZQCAL, 0, BENCH_RUNS, bench_zqcal);
+
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+        {
+            bench_run(BENCH_ID_SA_CAL, BENCH_ARG_SA(channel, byte), BENCH_RUNS, bench_sa_cal);
+        }
+    }
+
+    bench_run(BENCH_ID_CONFIGURE_PHY, WDDR_MSR_0, BENCH_RUNS, bench_configure_phy);
+    bench_run(BENCH_ID_CONFIGURE_PHY, WDDR_MSR_1, BENCH_RUNS, bench_configure_phy);
+
+    for (uint8_t freq_id = 0; freq_id < WDDR_PHY_VALID_FREQ_NUM; freq_id++)
+    {
+        bench_run(BENCH_ID_MRW_UPDATE, freq_id, BENCH_RUNS, bench_mrw_update);
+    }
+
+    bench_run(BENCH_ID_DFI_FILL, BENCH_DFI_PACKET_NUM, BENCH_RUNS, bench_dfi_fill);
+
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP3_CFG__ADR, BENCH_REPORT_DONE);
+
+    // Loop forever
+    while(1);
+}
+
+/*-----------------------------------------------------------*/
+static void bench_run(bench_id_t id, uint8_t arg, uint16_t runs, bench_fn_t fn)
+{
+    uint32_t sample;
+    uint16_t ii, jj;
+
+    configASSERT(runs > 0 && runs <= BENCH_RUNS);
+
+    // Insertion sort as samples come in; run counts are small
+    for (ii = 0; ii < runs; ii++)
+    {
+        sample = fn(arg);
+        for (jj = ii; jj > 0 && samples[jj - 1] > sample; jj--)
+        {
+            samples[jj] = samples[jj - 1];
+        }
+        samples[jj] = sample;
+    }
+
+    // Nearest rank p99; equals max for fewer than 100 runs
+    bench_report(id, arg, runs, samples[runs / 2], samples[(runs * 99 + 99) / 100 - 1]);
+}
+
+/*-----------------------------------------------------------*/
+static void bench_report(bench_id_t id, uint8_t arg, uint16_t runs, uint32_t median, uint32_t p99)
+{
+    uint32_t desc = SET_REG_FIELD(BENCH_REPORT__VALID, 1) |
+                    SET_REG_FIELD(BENCH_REPORT__ID, id) |
+                    SET_REG_FIELD(BENCH_REPORT__ARG, arg) |
+                    SET_REG_FIELD(BENCH_REPORT__RUNS, runs);
+
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP1_CFG__ADR, median);
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP2_CFG__ADR, p99);
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP0_CFG__ADR, desc);
+
+    // Wait for host to pick up result
+    while (reg_read(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP0_CFG__ADR) != 0)
+    {
+        taskYIELD();
+    }
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_configure_phy(uint8_t msr)
+{
+    uint32_t start = get_cycles();
+    wddr_configure_phy(&wddr, WDDR_PHY_BOOT_FREQ, (wddr_msr_t) msr);
+    return get_cycles() - start;
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_mrw_update(uint8_t freq_id)
+{
+    uint32_t start = get_cycles();
+    wddr_prep_freq_switch_mrw_update(&wddr, &wddr.dfi, &wddr.table->cfg.freq[freq_id].dram);
+    start = get_cycles() - start;
+
+    // Drop prefilled packets
+    dfi_buffer_disable(&wddr.dfi);
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        wddr_clear_fifo_reg_if(&wddr, channel);
+    }
+    return start;
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_dfi_fill(uint8_t num)
+{
+    uint32_t start;
+    dfi_tx_packet_buffer_t buffer;
+
+    dfi_tx_packet_buffer_init(&buffer);
+    for (uint8_t nn = 0; nn < num; nn++)
+    {
+        configASSERT(create_ck_packet_sequence(&buffer, 1) != NULL);
+    }
+
+    start = get_cycles();
+    dfi_buffer_fill_packets(&wddr.dfi, &buffer.list);
+    start = get_cycles() - start;
+
+    dfi_tx_packet_buffer_free(&buffer);
+
+    // Drop filled packets
+    dfi_buffer_disable(&wddr.dfi);
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        wddr_clear_fifo_reg_if(&wddr, channel);
+    }
+    return start;
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_zqcal(uint8_t arg)
+{
+    __UNUSED__ wddr_return_t ret;
+    uint32_t start = get_cycles();
+    ret = cmn_zqcal_calibrate(&wddr.cmn, &wddr.table->cfg.common.common.zqcal);
+    start = get_cycles() - start;
+    configASSERT(ret == WDDR_SUCCESS);
+    return start;
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_sa_cal(uint8_t arg)
+{
+    uint32_t start;
+    __UNUSED__ wddr_return_t ret;
+    uint8_t channel = arg >> 4;
+    uint8_t byte = arg & 0xF;
+    dq_reg_t *dq_reg = wddr.channel[channel].dq_reg[byte];
+    const rx_gb_cfg_t *gb = &wddr.table->cfg.freq[WDDR_PHY_BOOT_FREQ].channel[channel].dq[byte].rx.rank_cmn.cmn.gearbox;
+    rx_gb_cfg_t gb_cfg = {
+        .data_mode = DGB_2TO1_IR,
+        .fifo_mode = FGB_2TO2,
+        .wck_mode = GB_WCK_MODE_0,
+    };
+
+    // Same setup as boot: calibration assumes CS=0 and 2:1 gearbox
+    wddr_set_chip_select_reg_if(&wddr, channel, WDDR_RANK_0, true);
+    dq_dq_rx_gb_set_mode_reg_if(dq_reg, WDDR_MSR_0, &gb_cfg);
+    dq_dqs_rx_gb_set_mode_reg_if(dq_reg, WDDR_MSR_0, &gb_cfg);
+
+    start = get_cycles();
+    ret = channel_rx_sa_dqbyte_configure(&wddr.channel[channel],
+                                         byte,
+                                         true,
+                                         &wddr.table->cfg.common.channel[channel].dq[byte].rx.sa);
+    start = get_cycles() - start;
+    configASSERT(ret == WDDR_SUCCESS);
+
+    dq_dq_rx_gb_set_mode_reg_if(dq_reg, WDDR_MSR_0, gb);
+    dq_dqs_rx_gb_set_mode_reg_if(dq_reg, WDDR_MSR_0, gb);
+    wddr_set_chip_select_reg_if(&wddr, channel, WDDR_RANK_0, false);
+    return start;
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_pll_cal(uint8_t freq_id)
+{
+    uint32_t start = get_cycles();
+    __UNUSED__ wddr_return_t ret;
+
+    ret = pll_calibrate_vco(&wddr.pll, &wddr.table->cfg.freq[freq_id].pll);
+    configASSERT(ret == WDDR_SUCCESS);
+    return get_cycles() - start;
+}
+
+/*-----------------------------------------------------------*/
+static uint32_t bench_boot(uint8_t arg)
+{
+    uint32_t start;
+    __UNUSED__ wddr_return_t ret;
+    wddr_boot_cfg_t cfg = WDDR_BOOT_CONFIG_NONE;
+
+    cfg = UPDATE_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_PLL_CAL, 1);
+    cfg = UPDATE_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_ZQCAL_CAL, 1);
+    cfg = UPDATE_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_SA_CAL, 1);
+
+    start = get_cycles();
+    ret = wddr_boot(&wddr, cfg);
+    start = get_cycles() - start;
+    configASSERT(ret == WDDR_SUCCESS);
+    return start;
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationMallocFailedHook( void )
+{
+    shutdown(0x20001);
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationIdleHook( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName )
+{
+    ( void ) pcTaskName;
+    ( void ) pxTask;
+    shutdown(0x30001);
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationTickHook( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+void vAssertCalled( const char * const pcFileName, unsigned long ulLine )
+{
+    const char *pcString = pcFileName;
+    uint32_t ulFileNameLen = strlen(pcFileName);
+    char cFileName[7] = {'\0'};
+
+    /**
+     * @note    This is a patch because on this platform it is known that assert
+     *          will fail for port.c line 161.
+     */
+    memcpy(&cFileName[0], &pcString[ulFileNameLen - 6], 6);
+
+    if (strcmp(pcFileName, "port.c") && ulLine == 161)
+    {
+        return;
+    }
+
+    // Write out the file and line number
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP1_CFG__ADR, ulLine);
+    while (*pcString != '\0')
+    {
+        reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP2_CFG__ADR, *pcString++);
+    }
+    shutdown(0x40001);
+}
+
+/*-----------------------------------------------------------*/
+static void shutdown(uint32_t cause)
+{
+    taskDISABLE_INTERRUPTS();
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_GP3_CFG__ADR, cause);
+    _exit(1);
+}
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include <compiler.h>
 
 /* Image header includes. */
 #include <image.h>
@@ -29,6 +30,8 @@
 /* FreeRTOS includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
+#include "queue.h"
 
 /* Kernel includes. */
 #include <kernel/io.h>
@@ -38,11 +41,14 @@
 /* Messenger includes. */
 #include <messenger/device.h>
 #include <messenger/messages_wddr.h>
+#include <messenger/bulk.h>
 
 /* PHY Firmware includes. */
 #include <wddr/memory_map.h>
 #include <wddr/irq_map.h>
+#include <wddr/eye.h>
 #include <firmware/phy_api.h>
+#include <firmware/phy_trace.h>
 
 /*******************************************************************************
 **                                   MACROS
@@ -53,10 +59,18 @@
 // Task priority least to greatest
 #define MESSENGER_TASK_PRIORITY     (tskIDLE_PRIORITY + 2)
 #define MAIN_TASK_PRIORITY          (tskIDLE_PRIORITY + 3)
+#define REPLY_TASK_PRIORITY         (tskIDLE_PRIORITY + 3)
 
 // Stack size
 #define MESSENGER_STACK_SIZE        (configMINIMAL_STACK_SIZE)
 #define MAIN_STACK_SIZE             (configMINIMAL_STACK_SIZE * 2)
+#define REPLY_STACK_SIZE            (configMINIMAL_STACK_SIZE)
+
+// PREP that wasn't handled by the firmware is issued again
+#define PREP_TRY_COUNT              (3)
+
+// PREP stays in flight until its reply is sent, so a completion always finds a free slot
+#define PREP_REPLY_QUEUE_LEN        (1)
 
 /*******************************************************************************
 **                            STRUCTURE DECLARATIONS
@@ -67,13 +81,80 @@ typedef enum app_state {
     APP_STATE_ERROR,
 } app_state_t;
 
+/**
+ * @brief   PREP Completion Structure
+ *
+ * freq_id  frequency that was prepared.
+ * status   firmware status of the PREP.
+ * retry    whether firmware dropped the PREP and it should be issued again.
+ */
+typedef struct prep_done {
+    uint8_t     freq_id;
+    UBaseType_t status;
+    bool        retry;
+} prep_done_t;
+
 /*******************************************************************************
 **                            FUNCTION DECLARATIONS
 *******************************************************************************/
 static void vMainTask( void *pvParameters );
 
-/** @brief  Internal function to handle received messages */
-static void handle_message(const Message_t *req, Message_t *rsp, app_state_t *state);
+/**
+ * @brief   Reply task
+ *
+ * @details Re-issues or answers PREP requests once firmware completes them.
+ *          Main task is blocked on the messenger and the firmware task and
+ *          timer task must never block on it, so replies get their own task.
+ */
+static void vReplyTask( void *pvParameters );
+
+/**
+ * @brief   Internal function to handle received messages
+ *
+ * @return  returns whether response is ready.
+ * @retval  true if response should be sent now.
+ * @retval  false if response is sent once request completes.
+ */
+static bool handle_message(const Message_t *req, Message_t *rsp, app_state_t *state);
+
+/** @brief  Internal function to send message to host; safe from any task */
+static void send_message(Message_t *msg);
+
+/** @brief  Internal function to send consecutive messages to host in one operation */
+static void send_messages(Message_t *msg, uint8_t num);
+
+/** @brief  Internal function to craft PREP response */
+static void prep_response(Message_t *rsp, uint8_t freq_id, UBaseType_t status, app_state_t state);
+
+/** @brief  Internal function called by firmware when PREP completes */
+static void prep_complete(uint8_t freq_id, UBaseType_t status, bool retry);
+
+/** @brief  Internal function that re-issues or answers PREP from reply task */
+static void prep_reply(const prep_done_t *done);
+
+/** @brief  Internal function to start bulk transfer of requested source */
+static void bulk_request(uint32_t data);
+
+/** @brief  Internal bulk read function for the trace ring */
+static bool bulk_read_trace(uint32_t index, uint32_t *word, void *ctx);
+
+/** @brief  Internal bulk read function for an eye map; ctx is request data */
+static bool bulk_read_eye(uint32_t index, uint32_t *word, void *ctx);
+
+/** @brief  Internal bulk read function for the telemetry snapshot */
+static bool bulk_read_stats(uint32_t index, uint32_t *word, void *ctx);
+
+/** @brief  Internal bulk read function for CSR write filter counts */
+static bool bulk_read_csr_filter(uint32_t index, uint32_t *word, void *ctx);
+
+/** @brief  Internal bulk read function for the CSR access profile */
+static bool bulk_read_csr_profile(uint32_t index, uint32_t *word, void *ctx);
+
+/** @brief  Internal bulk read function for the boot report */
+static bool bulk_read_boot_report(uint32_t index, uint32_t *word, void *ctx);
+
+/** @brief  Internal bulk read function for poll statistics */
+static bool bulk_read_poll(uint32_t index, uint32_t *word, void *ctx);
 
 /** @brief  Centralized shutdown function */
 static void shutdown(uint32_t cause);
@@ -81,6 +162,24 @@ static void shutdown(uint32_t cause);
 /*******************************************************************************
 **                           VARIABLE DECLARATIONS
 *******************************************************************************/
+static wddr_message_interface_t message_intf;
+static app_state_t phy_state = APP_STATE_IDLE;
+
+// Serializes responses sent by main task and completion callbacks
+static SemaphoreHandle_t xSendMutex;
+
+// PREP in flight until reply is sent, its tries and its completions
+static volatile bool prep_busy;
+static uint8_t prep_tries;
+static QueueHandle_t xPrepReplyQueue;
+
+// Only one bulk transfer is in progress at a time
+static wddr_bulk_t bulk;
+static uint32_t bulk_req_data;
+
+// Header of frequency cache entry waiting for its value
+static wddr_table_entry_t freq_store_entry;
+
 extern uint32_t __start;
 img_hdr_t image_hdr __attribute__((section(".image_hdr"))) = {
     .image_magic = IMAGE_MAGIC,
@@ -128,8 +227,6 @@ int main( void )
 /*-----------------------------------------------------------*/
 static void vMainTask( void *pvParameters )
 {
-    wddr_message_interface_t message_intf;
-    app_state_t phy_state = APP_STATE_IDLE;
     Message_t req;
 
     // Interface Ready as initial message
@@ -138,32 +235,296 @@ static void vMainTask( void *pvParameters )
         .data = WDDR_DEVICE_ID,
     };
 
+    xSendMutex = xSemaphoreCreateMutex();
+    configASSERT(xSendMutex != NULL);
+
+    xPrepReplyQueue = xQueueCreate(PREP_REPLY_QUEUE_LEN, sizeof(prep_done_t));
+    configASSERT(xPrepReplyQueue != NULL);
+
     // Initialize messenger interface
     wddr_messenger_init(&message_intf);
+    wddr_bulk_init(&bulk, send_messages);
 
     // Send MSG Interface Ready message
-    wddr_messenger_send(&message_intf, &resp);
+    send_message(&resp);
+
+    xTaskCreate(vReplyTask, "Reply Task", REPLY_STACK_SIZE, NULL, REPLY_TASK_PRIORITY, NULL);
 
-    // Main receiving loop
+    // Main receiving loop; never blocks on firmware
     for (;;)
     {
         if (wddr_messenger_receive(&message_intf, &req))
         {
-            // Disable message interrupts while processing
-            interrupt_disable(MESSENGER_REQ_INTERRUPT_MSK |
-                              MESSENGER_ACK_INTERRUPT_MSK);
+            if (handle_message(&req, &resp, &phy_state))
+            {
+                send_message(&resp);
+            }
+        }
+    }
+}
 
-            // Process message
-            handle_message(&req, &resp, &phy_state);
+/*-----------------------------------------------------------*/
+static void vReplyTask( void *pvParameters )
+{
+    prep_done_t done;
+
+    for (;;)
+    {
+        if (xQueueReceive(xPrepReplyQueue, &done, portMAX_DELAY) == pdTRUE)
+        {
+            prep_reply(&done);
+        }
+    }
+}
 
-            // Send response
-            wddr_messenger_send(&message_intf, &resp);
+/*-----------------------------------------------------------*/
+static void send_message(Message_t *msg)
+{
+    send_messages(msg, 1);
+}
 
-            // Re-enable messaging interrupts
-            interrupt_enable(MESSENGER_REQ_INTERRUPT_MSK |
-                            MESSENGER_ACK_INTERRUPT_MSK);
+/*-----------------------------------------------------------*/
+static void send_messages(Message_t *msg, uint8_t num)
+{
+    xSemaphoreTake(xSendMutex, portMAX_DELAY);
+
+    // Disable message interrupts while sending
+    interrupt_disable(MESSENGER_REQ_INTERRUPT_MSK |
+                      MESSENGER_ACK_INTERRUPT_MSK);
+
+    while (num--)
+    {
+        wddr_messenger_send(&message_intf, msg++);
+    }
+
+    // Re-enable messaging interrupts
+    interrupt_enable(MESSENGER_REQ_INTERRUPT_MSK |
+                     MESSENGER_ACK_INTERRUPT_MSK);
+
+    xSemaphoreGive(xSendMutex);
+}
+
+/*-----------------------------------------------------------*/
+static void prep_response(Message_t *rsp, uint8_t freq_id, UBaseType_t status, app_state_t state)
+{
+    rsp->id = MESSAGE_WDDR_FREQ_PREP_RESP;
+    rsp->data = UPDATE_REG_FIELD(0x0, WDDR_FREQ_PREP_RSP__STATUS, !status);
+    rsp->data = UPDATE_REG_FIELD(rsp->data, WDDR_FREQ_PREP_RSP__FREQ_ID, freq_id);
+    rsp->data = UPDATE_REG_FIELD(rsp->data, WDDR_FREQ_PREP_RSP__RESP_CODE, state);
+}
+
+/*-----------------------------------------------------------*/
+static void prep_complete(uint8_t freq_id, UBaseType_t status, bool retry)
+{
+    BaseType_t ret;
+    prep_done_t done = {
+        .freq_id = freq_id,
+        .status = status,
+        .retry = retry,
+    };
+
+    // Firmware task must never block on the messenger; slot is always free
+    ret = xQueueSendToBack(xPrepReplyQueue, &done, 0);
+    configASSERT(ret == pdPASS);
+}
+
+/*-----------------------------------------------------------*/
+static void prep_reply(const prep_done_t *done)
+{
+    Message_t resp;
+    UBaseType_t status = done->status;
+
+    if (done->retry)
+    {
+        // Firmware dropped request; PHY state is unchanged
+        if (++prep_tries < PREP_TRY_COUNT &&
+            firmware_phy_prep_switch_async(done->freq_id, prep_complete) == pdPASS)
+        {
+            return;
         }
+
+        status = pdFAIL;
+    }
+    else if (status != pdPASS)
+    {
+        phy_state = APP_STATE_ERROR;
+    }
+
+    // Only one PREP is in flight; next one starts over
+    prep_tries = 0;
+    prep_response(&resp, done->freq_id, status, phy_state);
+    send_message(&resp);
+    prep_busy = false;
+}
+
+/*-----------------------------------------------------------*/
+static void bulk_request(uint32_t data)
+{
+    uint8_t vref_num = 0, best_row, width;
+
+    bulk_req_data = data;
+    switch (GET_REG_FIELD(data, WDDR_BULK_REQ__SRC))
+    {
+        case WDDR_BULK_SRC_TRACE:
+            wddr_bulk_start(&bulk,
+                            WDDR_BULK_SRC_TRACE,
+                            sizeof(fw_phy_trace_ring_t) / sizeof(uint32_t),
+                            bulk_read_trace,
+                            NULL);
+            break;
+        case WDDR_BULK_SRC_EYE_MAP:
+            if (firmware_phy_eye_get_info(&vref_num, &best_row, &width) == pdPASS)
+            {
+                wddr_bulk_start(&bulk,
+                                WDDR_BULK_SRC_EYE_MAP,
+                                vref_num * WDDR_EYE_ROW_WORD_NUM,
+                                bulk_read_eye,
+                                &bulk_req_data);
+                break;
+            }
+            wddr_bulk_start(&bulk, WDDR_BULK_SRC_EYE_MAP, 0, NULL, NULL);
+            break;
+        case WDDR_BULK_SRC_STATS:
+            wddr_bulk_start(&bulk,
+                            WDDR_BULK_SRC_STATS,
+                            firmware_phy_stats_snapshot(),
+                            bulk_read_stats,
+                            NULL);
+            break;
+        case WDDR_BULK_SRC_CSR_FILTER:
+            wddr_bulk_start(&bulk,
+                            WDDR_BULK_SRC_CSR_FILTER,
+                            FIRMWARE_PHY_CSR_FILTER_NUM * 2,
+                            bulk_read_csr_filter,
+                            NULL);
+            break;
+        case WDDR_BULK_SRC_CSR_PROFILE:
+            wddr_bulk_start(&bulk,
+                            WDDR_BULK_SRC_CSR_PROFILE,
+                            FIRMWARE_PHY_CSR_PROFILE_NUM * 4,
+                            bulk_read_csr_profile,
+                            NULL);
+            break;
+        case WDDR_BULK_SRC_BOOT_REPORT:
+            wddr_bulk_start(&bulk,
+                            WDDR_BULK_SRC_BOOT_REPORT,
+                            FIRMWARE_PHY_BOOT_REPORT_NUM,
+                            bulk_read_boot_report,
+                            NULL);
+            break;
+        case WDDR_BULK_SRC_POLL:
+            wddr_bulk_start(&bulk,
+                            WDDR_BULK_SRC_POLL,
+                            FIRMWARE_PHY_POLL_NUM * 4,
+                            bulk_read_poll,
+                            NULL);
+            break;
+        default:
+            wddr_bulk_start(&bulk, GET_REG_FIELD(data, WDDR_BULK_REQ__SRC), 0, NULL, NULL);
+            break;
+    }
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_trace(uint32_t index, uint32_t *word, void *ctx __UNUSED__)
+{
+    return firmware_phy_trace_read(index, word) == pdPASS;
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_eye(uint32_t index, uint32_t *word, void *ctx)
+{
+    uint32_t data = *(uint32_t *) ctx;
+
+    return firmware_phy_eye_read(GET_REG_FIELD(data, WDDR_BULK_REQ__EYE_RANK),
+                                 GET_REG_FIELD(data, WDDR_BULK_REQ__EYE_BYTE),
+                                 index / WDDR_EYE_ROW_WORD_NUM,
+                                 index % WDDR_EYE_ROW_WORD_NUM,
+                                 word) == pdPASS;
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_stats(uint32_t index, uint32_t *word, void *ctx __UNUSED__)
+{
+    return firmware_phy_stats_read(index, true, word) == pdPASS;
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_csr_filter(uint32_t index, uint32_t *word, void *ctx __UNUSED__)
+{
+    uint32_t addr, count;
+
+    if (firmware_phy_csr_filter_read(index / 2, &addr, &count) != pdPASS)
+    {
+        return false;
+    }
+
+    *word = (index & 0x1) ? count : addr;
+    return true;
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_csr_profile(uint32_t index, uint32_t *word, void *ctx __UNUSED__)
+{
+    csr_profile_entry_t entry;
+
+    if (firmware_phy_csr_profile_read(index / 4, &entry) != pdPASS)
+    {
+        return false;
     }
+
+    switch (index % 4)
+    {
+        case 0:
+            *word = entry.reads;
+            break;
+        case 1:
+            *word = entry.writes;
+            break;
+        case 2:
+            *word = entry.read_cycles;
+            break;
+        default:
+            *word = entry.write_cycles;
+            break;
+    }
+
+    return true;
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_boot_report(uint32_t index, uint32_t *word, void *ctx __UNUSED__)
+{
+    return firmware_phy_boot_report_read(index, word) == pdPASS;
+}
+
+/*-----------------------------------------------------------*/
+static bool bulk_read_poll(uint32_t index, uint32_t *word, void *ctx __UNUSED__)
+{
+    wddr_poll_stats_t stats;
+
+    if (firmware_phy_poll_read(index / 4, &stats) != pdPASS)
+    {
+        return false;
+    }
+
+    switch (index % 4)
+    {
+        case 0:
+            *word = stats.count;
+            break;
+        case 1:
+            *word = stats.timeouts;
+            break;
+        case 2:
+            *word = stats.cycles_max;
+            break;
+        default:
+            *word = stats.count ? stats.cycles_total / stats.count : 0;
+            break;
+    }
+
+    return true;
 }
 
 /*-----------------------------------------------------------*/
@@ -242,7 +603,7 @@ void vAssertCalled( const char * const pcFileName, unsigned long ulLine )
 }
 
 /*-----------------------------------------------------------*/
-static void handle_message(const Message_t *req, Message_t *rsp, app_state_t *state)
+static bool handle_message(const Message_t *req, Message_t *rsp, app_state_t *state)
 {
     Message_t local_resp = {0x0, 0x0};
     UBaseType_t status = pdPASS;
@@ -256,33 +617,161 @@ static void handle_message(const Message_t *req, Message_t *rsp, app_state_t *st
             // Extract Frequency ID
             freq_id = GET_REG_FIELD(req->data, WDDR_FREQ_PREP_REQ__FREQ_ID);
 
-            do
+            // Message only valid in ready state; response is sent on completion
+            if (*state == APP_STATE_READY && !prep_busy)
             {
-                // Message only valid in ready state
-                if (*state != APP_STATE_READY)
+                prep_busy = true;
+                if (firmware_phy_prep_switch_async(freq_id, prep_complete) == pdPASS)
                 {
-                    status = pdFAIL;
-                    break;
+                    return false;
                 }
+                prep_busy = false;
+            }
 
-                // Prepare for switch if phy is ready
-                status = firmware_phy_prep_switch(freq_id);
-                if (status == pdPASS)
-                {
+            // Not ready or another PREP is in flight
+            status = pdFAIL;
+            prep_response(&local_resp, freq_id, status, *state);
+            break;
+
+        case MESSAGE_WDDR_EYE_INFO_REQ:
+            uint8_t vref_num = 0, best_row = 0, width = 0;
+
+            status = firmware_phy_eye_get_info(&vref_num, &best_row, &width);
+
+            local_resp.id = MESSAGE_WDDR_EYE_INFO_RESP;
+            local_resp.data = UPDATE_REG_FIELD(0x0, WDDR_EYE_INFO_RSP__STATUS, !status);
+            local_resp.data = UPDATE_REG_FIELD(local_resp.data, WDDR_EYE_INFO_RSP__VREF_NUM, vref_num);
+            local_resp.data = UPDATE_REG_FIELD(local_resp.data, WDDR_EYE_INFO_RSP__BEST_ROW, best_row);
+            local_resp.data = UPDATE_REG_FIELD(local_resp.data, WDDR_EYE_INFO_RSP__WIDTH, width);
+            break;
+
+        // Scan runs in the background; poll EYE_INFO for the result
+        case MESSAGE_WDDR_EYE_SCAN_REQ:
+            wddr_eye_scan_cfg_t eye_cfg = {
+                .vref_axis = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__VREF_AXIS),
+                .timing_axis = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__TIMING_AXIS),
+                .channel = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__CHANNEL),
+                .rank_mask = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__RANK_MASK),
+                .vref_start = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__VREF_START),
+                .vref_step = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__VREF_STEP),
+                .vref_num = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__VREF_NUM),
+                .train = GET_REG_FIELD(req->data, WDDR_EYE_SCAN_REQ__TRAIN),
+            };
+
+            // Message only valid in ready state
+            status = *state == APP_STATE_READY ? firmware_phy_eye_scan(&eye_cfg) : pdFAIL;
+
+            local_resp.id = MESSAGE_WDDR_EYE_SCAN_RESP;
+            local_resp.data = UPDATE_REG_FIELD(0x0, WDDR_EYE_SCAN_RSP__STATUS, !status);
+            break;
+
+        // Eye maps are read one packed word at a time
+        case MESSAGE_WDDR_EYE_MAP_REQ:
+            uint32_t word = 0;
+
+            firmware_phy_eye_read(GET_REG_FIELD(req->data, WDDR_EYE_MAP_REQ__RANK),
+                                  GET_REG_FIELD(req->data, WDDR_EYE_MAP_REQ__BYTE),
+                                  GET_REG_FIELD(req->data, WDDR_EYE_MAP_REQ__ROW),
+                                  GET_REG_FIELD(req->data, WDDR_EYE_MAP_REQ__WORD),
+                                  &word);
+
+            local_resp.id = MESSAGE_WDDR_EYE_MAP_RESP;
+            local_resp.data = word;
+            break;
+
+        // Profile statistics are read one value at a time
+        case MESSAGE_WDDR_PROF_REQ:
+            uint32_t value = 0;
+
+            firmware_phy_prof_read(GET_REG_FIELD(req->data, WDDR_PROF_REQ__EVENT),
+                                   GET_REG_FIELD(req->data, WDDR_PROF_REQ__KIND),
+                                   GET_REG_FIELD(req->data, WDDR_PROF_REQ__STAT),
+                                   GET_REG_FIELD(req->data, WDDR_PROF_REQ__CLEAR),
+                                   &value);
+
+            local_resp.id = MESSAGE_WDDR_PROF_RESP;
+            local_resp.data = value;
+            break;
+
+        // Trace ring is dumped one word at a time
+        case MESSAGE_WDDR_TRACE_REQ:
+            uint32_t trace_word = 0;
+
+            firmware_phy_trace_read(GET_REG_FIELD(req->data, WDDR_TRACE_REQ__WORD), &trace_word);
+
+            local_resp.id = MESSAGE_WDDR_TRACE_RESP;
+            local_resp.data = trace_word;
+            break;
+
+        // Telemetry counters; snapshot first for a consistent set
+        case MESSAGE_WDDR_STATS_REQ:
+            uint32_t stat = 0;
+            uint16_t index = GET_REG_FIELD(req->data, WDDR_STATS_REQ__INDEX);
+
+            switch (GET_REG_FIELD(req->data, WDDR_STATS_REQ__CMD))
+            {
+                case WDDR_STATS_CMD_READ:
+                    firmware_phy_stats_read(index, false, &stat);
                     break;
-                }
+                case WDDR_STATS_CMD_SNAPSHOT:
+                    stat = firmware_phy_stats_snapshot();
+                    break;
+                case WDDR_STATS_CMD_READ_SNAPSHOT:
+                    firmware_phy_stats_read(index, true, &stat);
+                    break;
+                default:
+                    firmware_phy_stats_clear();
+                    firmware_phy_csr_profile_clear();
+                    firmware_phy_poll_clear();
+                    break;
+            }
 
-                // Mark as error state
-                *state = APP_STATE_ERROR;
-            } while (0);
+            local_resp.id = MESSAGE_WDDR_STATS_RESP;
+            local_resp.data = stat;
+            break;
 
-            // Craft response message
-            local_resp.id = MESSAGE_WDDR_FREQ_PREP_RESP;
-            local_resp.data = UPDATE_REG_FIELD(0x0, WDDR_FREQ_PREP_RSP__STATUS, !status);
-            local_resp.data = UPDATE_REG_FIELD(local_resp.data, WDDR_FREQ_PREP_RSP__FREQ_ID, freq_id);
-            local_resp.data = UPDATE_REG_FIELD(local_resp.data, WDDR_FREQ_PREP_RSP__RESP_CODE, *state);
+        // Operating points are uploaded one delta entry at a time
+        case MESSAGE_WDDR_FREQ_STORE_REQ:
+            switch (GET_REG_FIELD(req->data, WDDR_FREQ_STORE_REQ__CMD))
+            {
+                case WDDR_FREQ_STORE_CMD_BEGIN:
+                    firmware_phy_freq_store_begin(GET_REG_FIELD(req->data, WDDR_FREQ_STORE_REQ__OP_ID));
+                    break;
+                case WDDR_FREQ_STORE_CMD_ENTRY:
+                    freq_store_entry.offset = GET_REG_FIELD(req->data, WDDR_FREQ_STORE_REQ__OFFSET);
+                    freq_store_entry.type = GET_REG_FIELD(req->data, WDDR_FREQ_STORE_REQ__TYPE);
+                    freq_store_entry.rep = GET_REG_FIELD(req->data, WDDR_FREQ_STORE_REQ__REP);
+                    break;
+                case WDDR_FREQ_STORE_CMD_COMMIT:
+                    // Message only valid in ready state
+                    status = *state == APP_STATE_READY ? firmware_phy_freq_store_commit() : pdFAIL;
+                    break;
+                default:
+                    status = pdFAIL;
+                    break;
+            }
+
+            local_resp.id = MESSAGE_WDDR_FREQ_STORE_RESP;
+            local_resp.data = UPDATE_REG_FIELD(0x0, WDDR_FREQ_STORE_RSP__STATUS, !status);
+            break;
+
+        case MESSAGE_WDDR_FREQ_STORE_DATA:
+            freq_store_entry.value = req->data;
+            status = firmware_phy_freq_store_entry(&freq_store_entry);
+
+            local_resp.id = MESSAGE_WDDR_FREQ_STORE_RESP;
+            local_resp.data = UPDATE_REG_FIELD(0x0, WDDR_FREQ_STORE_RSP__STATUS, !status);
             break;
 
+        // Bulk transfer sends its own header, data and end messages
+        case MESSAGE_WDDR_BULK_REQ:
+            bulk_request(req->data);
+            return false;
+
+        case MESSAGE_WDDR_BULK_ACK:
+            wddr_bulk_ack(&bulk, req->data);
+            return false;
+
         case MESSAGE_GENERAL_MCU_BOOT_REQ:
             do
             {
@@ -331,6 +820,7 @@ static void handle_message(const Message_t *req, Message_t *rsp, app_state_t *st
     // Update response
     rsp->id = local_resp.id;
     rsp->data = local_resp.data;
+    return true;
 }
 
 /*-----------------------------------------------------------*/
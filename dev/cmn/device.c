@@ -33,11 +33,14 @@ void cmn_ibias_disable(cmn_dev_t *cmn_dev)
     cmn_ibias_set_state_reg_if(cmn_dev->cmn_reg, IBIAS_STATE_DISABLE);
 }
 
-void cmn_pmon_run(cmn_dev_t *cmn_dev, uint32_t *count)
+wddr_return_t cmn_pmon_run(cmn_dev_t *cmn_dev, uint32_t *count)
 {
+    bool done;
+
     cmn_pmon_set_state_reg_if(cmn_dev->cmn_reg, PMON_STATE_ENABLED);
-    cmn_pmon_get_status_count_reg_if(cmn_dev->cmn_reg, count);
+    done = cmn_pmon_get_status_count_reg_if(cmn_dev->cmn_reg, count);
     cmn_pmon_set_state_reg_if(cmn_dev->cmn_reg, PMON_STATE_DISABLED);
+    return done ? WDDR_SUCCESS : WDDR_ERROR_POLL_TIMEOUT;
 }
 
 void cmn_pmon_configure(cmn_dev_t *cmn_dev, pmon_cfg_t *cfg)
@@ -39,9 +39,9 @@ dfi_return_t dfi_buffer_fill_packets(dfi_dev_t *dfi,
     return dfi_buffer_write_packets(dfi, packet_list);
 }
 
-void dfi_buffer_send_packets(dfi_dev_t *dfi, bool should_block)
+dfi_return_t dfi_buffer_send_packets(dfi_dev_t *dfi)
 {
-    dfi_fifo_send_packets_reg_if(dfi->dfich_reg);
+    return dfi_fifo_send_packets_reg_if(dfi->dfich_reg);
 }
 
 dfi_return_t dfi_buffer_fill_and_send_packets(dfi_dev_t *dfi,
@@ -56,8 +56,7 @@ dfi_return_t dfi_buffer_fill_and_send_packets(dfi_dev_t *dfi,
         return ret;
     }
 
-    dfi_buffer_send_packets(dfi, true);
-    return DFI_SUCCESS;
+    return dfi_buffer_send_packets(dfi);
 }
 
 static dfi_return_t dfi_buffer_write_packets(dfi_dev_t *dfi,
@@ -14,6 +14,7 @@
 #define WRFIFO_2_CA_PINS    (0b000111)
 #define RDFIFO_2_CA_PINS    (0b000001)
 #define RDDQ_2_CA_PINS      (0b000011)
+#define DQS_OSC_2_CA_PINS   (0b001011)
 #define CAS_2_CA_PINS       (0b010010)
 #define MRW_1_CA_PINS       (0b000110)
 #define MRW_2_CA_PINS       (0b010110)
@@ -233,6 +234,12 @@ void create_rddq_command(command_t *command, chipselect_t cs)
     create_mpc_frame(command->address, cs, RDDQ_2_CA_PINS);
 }
 
+void create_dqs_osc_start_command(command_t *command, chipselect_t cs)
+{
+    command->command_type = COMMAND_TYPE_MPC;
+    create_mpc_frame(command->address, cs, DQS_OSC_2_CA_PINS);
+}
+
 void create_self_refresh_entry_command(command_t *command, chipselect_t cs)
 {
     command->command_type = COMMAND_TYPE_SR;
@@ -19,6 +19,9 @@ static void handle_dfi_ctrlupd_req_irq(int irq_num, void *args);
 /** @brief  IRQ Handler for all phyupd ACK events */
 static void handle_dfi_phyupd_ack_irq(int irq_num, void *args);
 
+/** @brief  IRQ Handler for all LP_CTRL / LP_DATA REQ events */
+static void handle_dfi_lp_req_irq(int irq_num, void *args);
+
 void dfi_init(dfi_dev_t *dfi, uint32_t base)
 {
     uint32_t mask;
@@ -34,17 +37,21 @@ void dfi_init(dfi_dev_t *dfi, uint32_t base)
     request_irq(MCU_FAST_IRQ_PHYMSTR_ACK, handle_dfi_phymstr_ack_irq, NULL);
     request_irq(MCU_FAST_IRQ_PHYUPD_ACK, handle_dfi_phyupd_ack_irq, NULL);
     request_irq(MCU_FAST_IRQ_CTRLUPD_REQ, handle_dfi_ctrlupd_req_irq, NULL);
+    request_irq(MCU_FAST_IRQ_LP_REQ, handle_dfi_lp_req_irq, dfi);
 
     // Turn off interrupts until needed
     disable_irq(MCU_FAST_IRQ_PHYMSTR_ACK);
     disable_irq(MCU_FAST_IRQ_PHYUPD_ACK);
+    disable_irq(MCU_FAST_IRQ_LP_REQ);
 
     // Turn on sticky bit for IRQ
     mask = reg_read(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_STICKY_CFG__ADR);
     mask |= FAST_IRQ_STICKY_MASK(DDR_IRQ_PHYUPD_ACK) |
             FAST_IRQ_STICKY_MASK(DDR_IRQ_PHYMSTR_ACK) |
             FAST_IRQ_STICKY_MASK(DDR_IRQ_CTRLUPD_REQ_ASSERTION) |
-            FAST_IRQ_STICKY_MASK(DDR_IRQ_CTRLUPD_REQ_DEASSERTION);
+            FAST_IRQ_STICKY_MASK(DDR_IRQ_CTRLUPD_REQ_DEASSERTION) |
+            FAST_IRQ_STICKY_MASK(DDR_IRQ_LP_CTRL_REQ) |
+            FAST_IRQ_STICKY_MASK(DDR_IRQ_LP_DATA_REQ);
     reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_STICKY_CFG__ADR, mask);
 }
 
@@ -53,14 +60,14 @@ void dfi_phymstr_req(dfi_dev_t *dfi, dfi_phymstr_req_t *req)
     dfi_phymstr_req_assert_reg_if(dfi->dfi_reg, req);
 }
 
-void dfi_phymstr_exit(dfi_dev_t *dfi)
+dfi_return_t dfi_phymstr_exit(dfi_dev_t *dfi)
 {
-    dfi_phymstr_req_deassert_reg_if(dfi->dfi_reg);
+    return dfi_phymstr_req_deassert_reg_if(dfi->dfi_reg);
 }
 
-void dfi_ctrlupd_deassert_ack(dfi_dev_t *dfi)
+dfi_return_t dfi_ctrlupd_deassert_ack(dfi_dev_t *dfi)
 {
-    dfi_ctrlupd_deassert_ack_reg_if(dfi->dfi_reg);
+    return dfi_ctrlupd_deassert_ack_reg_if(dfi->dfi_reg);
 }
 
 void dfi_ctrlupd_enable(dfi_dev_t *dfi)
@@ -75,14 +82,28 @@ void dfi_ctrlupd_disable(dfi_dev_t *dfi)
     disable_irq(MCU_FAST_IRQ_CTRLUPD_REQ);
 }
 
+void dfi_lp_enable(dfi_dev_t *dfi)
+{
+    for (uint8_t intf = 0; intf < DFI_LP_IF_NUM; intf++)
+    {
+        dfi_lp_ack_override_reg_if(dfi->dfi_reg, intf, true, 0);
+    }
+    enable_irq(MCU_FAST_IRQ_LP_REQ);
+}
+
+void dfi_lp_ack(dfi_dev_t *dfi, dfi_lp_if_t intf, bool ack)
+{
+    dfi_lp_ack_override_reg_if(dfi->dfi_reg, intf, true, ack);
+}
+
 void dfi_phyupd_req(dfi_dev_t *dfi, dfi_phyupd_type_t type)
 {
     dfi_phyupd_req_assert_reg_if(dfi->dfi_reg, type);
 }
 
-void dfi_phyupd_exit(dfi_dev_t *dfi)
+dfi_return_t dfi_phyupd_exit(dfi_dev_t *dfi)
 {
-    dfi_phyupd_req_deassert_reg_if(dfi->dfi_reg);
+    return dfi_phyupd_req_deassert_reg_if(dfi->dfi_reg);
 }
 
 static void handle_dfi_phymstr_ack_irq(__UNUSED__ int irq_num, __UNUSED__ void *args)
@@ -161,3 +182,46 @@ static void handle_dfi_ctrlupd_req_irq(__UNUSED__ int irq_num, __UNUSED__ void *
     fw_phy_task_notify_isr(&msg, &xHigherPriorityTaskWoken);
     portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
+
+static void handle_dfi_lp_req_irq(__UNUSED__ int irq_num, void *args)
+{
+    uint32_t reg_val;
+    uint8_t req, wakeup;
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    dfi_dev_t *dfi = (dfi_dev_t *) args;
+    fw_msg_t msg;
+
+    reg_val = reg_read(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_STA__ADR);
+
+    // Clear interrupt
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_CLR_CFG__ADR,
+              FAST_IRQ_STICKY_MASK(DDR_IRQ_LP_CTRL_REQ) |
+              FAST_IRQ_STICKY_MASK(DDR_IRQ_LP_DATA_REQ));
+    reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_CLR_CFG__ADR, 0x0);
+
+    /**
+     * @note    IRQ fires on both edges of REQ; current REQ state and
+     *          WAKEUP encoding are sampled and passed along with the event.
+     */
+    if (reg_val & FAST_IRQ_STICKY_MASK(DDR_IRQ_LP_CTRL_REQ))
+    {
+        dfi_lp_get_status_reg_if(dfi->dfi_reg, DFI_LP_IF_CTRL, &req, &wakeup);
+        msg.event = FW_PHY_EVENT_LP_CTRL_REQ;
+        msg.data = DFI_LP_EVENT_DATA(req, wakeup);
+        msg.xSender = NULL;
+        msg.complete = NULL;
+        fw_phy_task_notify_isr(&msg, &xHigherPriorityTaskWoken);
+    }
+
+    if (reg_val & FAST_IRQ_STICKY_MASK(DDR_IRQ_LP_DATA_REQ))
+    {
+        dfi_lp_get_status_reg_if(dfi->dfi_reg, DFI_LP_IF_DATA, &req, &wakeup);
+        msg.event = FW_PHY_EVENT_LP_DATA_REQ;
+        msg.data = DFI_LP_EVENT_DATA(req, wakeup);
+        msg.xSender = NULL;
+        msg.complete = NULL;
+        fw_phy_task_notify_isr(&msg, &xHigherPriorityTaskWoken);
+    }
+
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
@@ -11,6 +11,11 @@
 #define CS_HIGH                 (1)
 #define CA_CLK_LEN              (3)
 
+// Oscillator run time is programmed in units of 16 DRAM clocks
+#define DQS_OSC_RUN_TIME__SHFT  (4)
+// Conservative tOSCO (max(40ns, 8nCK)) in DRAM clocks
+#define DQS_OSC_TOSCO_CK        (128)
+
 #define VRCG__SHFT      (3)
 #define VRCG__MSK       (1 << VRCG__SHFT)
 #define CBT__SHFT       (0)
@@ -106,6 +111,47 @@ void dram_idle(__UNUSED__ dram_dev_t *dram, dfi_dev_t *dfi)
     dfi_tx_packet_buffer_free(&packet_buffer);
 }
 
+void dram_self_refresh_enter(dram_dev_t *dram, dfi_dev_t *dfi)
+{
+    command_t command = {0};
+    dfi_tx_packet_buffer_t packet_buffer;
+
+    dfi_tx_packet_buffer_init(&packet_buffer);
+    create_cke_packet_sequence(&packet_buffer, 1);
+    for (chipselect_t cs = CS_0; cs <= CS_1; cs++)
+    {
+        create_self_refresh_entry_command(&command, cs);
+        dram_create_address_packet_sequence(&packet_buffer, dram->cfg->ratio, &command, 1);
+    }
+
+    // Drop CKE (Self-Refresh Power Down) so CK can be stopped
+    create_cke_packet_sequence(&packet_buffer, 1);
+    create_ck_packet_sequence(&packet_buffer, 10);
+    dfi_buffer_fill_and_send_packets(dfi, &packet_buffer.list);
+    dfi_tx_packet_buffer_free(&packet_buffer);
+}
+
+void dram_self_refresh_exit(dram_dev_t *dram, dfi_dev_t *dfi)
+{
+    command_t command = {0};
+    dfi_tx_packet_buffer_t packet_buffer;
+
+    // Exit Self-Refresh Power Down first
+    dfi_tx_packet_buffer_init(&packet_buffer);
+    create_ck_packet_sequence(&packet_buffer, 1);
+    create_cke_packet_sequence(&packet_buffer, 10);
+    for (chipselect_t cs = CS_0; cs <= CS_1; cs++)
+    {
+        create_self_refresh_exit_command(&command, cs);
+        dram_create_address_packet_sequence(&packet_buffer, dram->cfg->ratio, &command, 1);
+    }
+
+    // tXSR is measured in DRAM clocks
+    create_cke_packet_sequence(&packet_buffer, (dram->cfg->txsr >> dram->cfg->ratio) + 1);
+    dfi_buffer_fill_and_send_packets(dfi, &packet_buffer.list);
+    dfi_tx_packet_buffer_free(&packet_buffer);
+}
+
 void dram_frequency_init(dram_dev_t *dram,
                          dfi_dev_t *dfi,
                          dram_freq_cfg_t *dram_cfg)
@@ -483,6 +529,43 @@ wddr_return_t dram_prepare_rdfifo_sequence(dram_dev_t *dram,
     return dram_prepare_read_sequence(dram, buffer, burst_length, cs, rddata_en_offset, &command);
 }
 
+wddr_return_t dram_prepare_mrr_sequence(dram_dev_t *dram,
+                                        dfi_tx_packet_buffer_t *buffer,
+                                        chipselect_t cs,
+                                        uint8_t mode_register,
+                                        uint16_t rddata_en_offset)
+{
+    command_t command = {0};
+    create_read_mode_register_command(&command, cs, mode_register);
+    return dram_prepare_read_sequence(dram, buffer, BL_16, cs, rddata_en_offset, &command);
+}
+
+wddr_return_t dram_prepare_dqs_osc_sequence(dram_dev_t *dram,
+                                            dfi_tx_packet_buffer_t *buffer,
+                                            chipselect_t cs,
+                                            uint8_t run_time)
+{
+    command_t command = {0};
+    uint16_t wait_dram_clk = (run_time << DQS_OSC_RUN_TIME__SHFT) + DQS_OSC_TOSCO_CK;
+
+    // Program run time
+    PROPAGATE_ERROR(dram_create_mrw_packet_sequence(buffer, dram->cfg->ratio, cs, 0x17, run_time, 1));
+    create_cke_packet_sequence(buffer, 1);
+
+    // Start oscillator
+    create_dqs_osc_start_command(&command, cs);
+    PROPAGATE_ERROR(dram_create_address_packet_sequence(buffer, dram->cfg->ratio, &command, 1));
+    create_cke_packet_sequence(buffer, 1);
+
+    // Oscillator stops on its own; keep clocks running until count is valid
+    if (create_cke_packet_sequence(buffer, (wait_dram_clk >> dram->cfg->ratio) + 1) == NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    return WDDR_SUCCESS;
+}
+
 wddr_return_t dram_prepare_wrlvl_sequence(dram_dev_t *dram,
                                           dfi_tx_packet_buffer_t *buffer)
 {
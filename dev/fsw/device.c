@@ -10,6 +10,7 @@
 #include <pll/table.h>
 #include <wddr/irq_map.h>
 #include <wddr/memory_map.h>
+#include <wddr/poll.h>
 #include <firmware/phy_task.h>
 
 /** @brief  IRQ Handler for INIT_START IRQ */
@@ -40,13 +41,13 @@ void fsw_init(fsw_dev_t *dev, uint32_t base)
     reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_STICKY_CFG__ADR, mask);
 }
 
-void fsw_switch_to_dfi_mode(fsw_dev_t *fsw_dev, dfi_dev_t *dfi_dev)
+wddr_return_t fsw_switch_to_dfi_mode(fsw_dev_t *fsw_dev, dfi_dev_t *dfi_dev)
 {
-    uint32_t init_start, reg_val;
+    uint32_t reg_val;
 
     if (fsw_dev->mode == FSW_MODE_DFI)
     {
-        return;
+        return WDDR_SUCCESS;
     }
 
     // Set override values to MSR0 and VCO1
@@ -59,10 +60,10 @@ void fsw_switch_to_dfi_mode(fsw_dev_t *fsw_dev, dfi_dev_t *dfi_dev)
     dfi_set_init_complete_ovr_reg_if(dfi_dev->dfi_reg, false, 0x0);
 
     // init_start must be low before proceeding, wait for this to happen.
-    do
+    if (!wddr_poll(WDDR_POLL_SITE_DFI_MODE_INIT_START, dfi_init_start_low_cond, dfi_dev->dfi_reg))
     {
-        init_start = dfi_get_init_start_status_reg_if(dfi_dev->dfi_reg);
-    } while (init_start != 0x0);
+        return WDDR_ERROR_POLL_TIMEOUT;
+    }
 
     // Release init_start override (shouldn't be set)
     dfi_set_init_start_ovr_reg_if(dfi_dev->dfi_reg, false, 0x0);
@@ -82,6 +83,7 @@ void fsw_switch_to_dfi_mode(fsw_dev_t *fsw_dev, dfi_dev_t *dfi_dev)
     reg_write(WDDR_MEMORY_MAP_MCU + WAV_MCU_IRQ_FAST_CLR_CFG__ADR, 0x0);
 
     fsw_dev->mode = FSW_MODE_DFI;
+    return WDDR_SUCCESS;
 }
 
 wddr_msr_t fsw_get_current_msr(fsw_dev_t *dev)
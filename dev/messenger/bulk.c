@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stddef.h>
+
+/* Kernel includes. */
+#include <kernel/io.h>
+
+/* LPDDR includes. */
+#include <messenger/bulk.h>
+#include <messenger/messages_wddr.h>
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+// CRC-32 (reflected 0xEDB88320) remainders of a nibble
+static const uint32_t crc_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to send header with given status */
+static void wddr_bulk_send_header(wddr_bulk_t *bulk, bool ok);
+
+/** @brief  Internal Function to send next window or end of transfer */
+static void wddr_bulk_send_window(wddr_bulk_t *bulk);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void wddr_bulk_init(wddr_bulk_t *bulk, wddr_bulk_send_t send)
+{
+    bulk->send = send;
+    bulk->read = NULL;
+    bulk->ctx = NULL;
+    bulk->active = false;
+    bulk->resent = 0;
+}
+
+bool wddr_bulk_start(wddr_bulk_t *bulk,
+                     uint8_t src,
+                     uint32_t count,
+                     wddr_bulk_read_t read,
+                     void *ctx)
+{
+    bulk->src = src;
+    bulk->count = read == NULL ? 0 : count;
+    bulk->active = false;
+
+    if (read == NULL)
+    {
+        wddr_bulk_send_header(bulk, false);
+        return false;
+    }
+
+    bulk->read = read;
+    bulk->ctx = ctx;
+    bulk->index = 0;
+    bulk->acked = 0;
+    bulk->crc = 0;
+    bulk->crc_acked = 0;
+    bulk->active = true;
+
+    wddr_bulk_send_header(bulk, true);
+    wddr_bulk_send_window(bulk);
+    return true;
+}
+
+bool wddr_bulk_ack(wddr_bulk_t *bulk, uint32_t received)
+{
+    if (!bulk->active)
+    {
+        return false;
+    }
+
+    if (received == bulk->index)
+    {
+        bulk->acked = bulk->index;
+        bulk->crc_acked = bulk->crc;
+    }
+    else
+    {
+        // Host lost words; go back to last acknowledged window
+        bulk->resent += bulk->index - bulk->acked;
+        bulk->index = bulk->acked;
+        bulk->crc = bulk->crc_acked;
+    }
+
+    wddr_bulk_send_window(bulk);
+    return true;
+}
+
+uint32_t wddr_bulk_crc(uint32_t crc, uint32_t word)
+{
+    crc = ~crc;
+    for (uint8_t nn = 0; nn < 8; nn++)
+    {
+        crc = (crc >> 4) ^ crc_nibble[(crc ^ word) & 0xF];
+        word >>= 4;
+    }
+    return ~crc;
+}
+
+static void wddr_bulk_send_header(wddr_bulk_t *bulk, bool ok)
+{
+    Message_t msg;
+
+    msg.id = MESSAGE_WDDR_BULK_HDR;
+    msg.data = UPDATE_REG_FIELD(0x0, WDDR_BULK_HDR__STATUS, !ok);
+    msg.data = UPDATE_REG_FIELD(msg.data, WDDR_BULK_HDR__SRC, bulk->src);
+    msg.data = UPDATE_REG_FIELD(msg.data, WDDR_BULK_HDR__COUNT, bulk->count);
+    bulk->send(&msg, 1);
+}
+
+static void wddr_bulk_send_window(wddr_bulk_t *bulk)
+{
+    Message_t msg;
+    uint32_t word;
+    uint8_t nn;
+
+    // Last window was acknowledged; finish with CRC
+    if (bulk->acked == bulk->count)
+    {
+        msg.id = MESSAGE_WDDR_BULK_END;
+        msg.data = bulk->crc;
+        bulk->send(&msg, 1);
+        bulk->active = false;
+        return;
+    }
+
+    for (nn = 0; nn < WDDR_BULK_WINDOW && bulk->index < bulk->count; nn++)
+    {
+        // Unreadable words are sent as 0 so the host can still finish
+        if (!bulk->read(bulk->index, &word, bulk->ctx))
+        {
+            word = 0;
+        }
+
+        bulk->window[nn].id = MESSAGE_WDDR_BULK_DATA;
+        bulk->window[nn].data = word;
+        bulk->crc = wddr_bulk_crc(bulk->crc, word);
+        bulk->index++;
+    }
+
+    // Whole window goes out in one send operation
+    bulk->send(bulk->window, nn);
+}
@@ -62,6 +62,26 @@ static bool wddr_messenger_validate(void *dev, void *buff, size_t len)
     {
         case MESSAGE_WDDR_FREQ_PREP_REQ:
         case MESSAGE_WDDR_FREQ_PREP_RESP:
+        case MESSAGE_WDDR_EYE_INFO_REQ:
+        case MESSAGE_WDDR_EYE_INFO_RESP:
+        case MESSAGE_WDDR_EYE_MAP_REQ:
+        case MESSAGE_WDDR_EYE_MAP_RESP:
+        case MESSAGE_WDDR_PROF_REQ:
+        case MESSAGE_WDDR_PROF_RESP:
+        case MESSAGE_WDDR_TRACE_REQ:
+        case MESSAGE_WDDR_TRACE_RESP:
+        case MESSAGE_WDDR_BULK_REQ:
+        case MESSAGE_WDDR_BULK_HDR:
+        case MESSAGE_WDDR_BULK_DATA:
+        case MESSAGE_WDDR_BULK_ACK:
+        case MESSAGE_WDDR_BULK_END:
+        case MESSAGE_WDDR_STATS_REQ:
+        case MESSAGE_WDDR_STATS_RESP:
+        case MESSAGE_WDDR_FREQ_STORE_REQ:
+        case MESSAGE_WDDR_FREQ_STORE_DATA:
+        case MESSAGE_WDDR_FREQ_STORE_RESP:
+        case MESSAGE_WDDR_EYE_SCAN_REQ:
+        case MESSAGE_WDDR_EYE_SCAN_RESP:
             return true;
         default:
             break;
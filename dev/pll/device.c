@@ -8,10 +8,14 @@
 #include <kernel/irq.h>
 #include <kernel/io.h>
 #include <firmware/phy_task.h>
+#include <firmware/phy_trace.h>
+#include <firmware/phy_stats.h>
 #include <pll/device.h>
 #include <pll/driver.h>
 #include <wddr/memory_map.h>
+#include <wddr/csr_shadow.h>
 #include <wddr/irq_map.h>
+#include <wddr/poll.h>
 #include <vco/driver.h>
 
 // MCU VCO values
@@ -24,10 +28,26 @@
 
 static void pll_irq_handler(int irq, void *args);
 
+/** @brief  Internal Function to configure PHY VCO FLL and start it */
+static void pll_vco_fll_start(vco_dev_t *p_vco, vco_cfg_t *p_vco_cfg);
+
+/** @brief  Internal Function to wait for PHY VCO FLL lock and store calibration */
+static bool pll_vco_fll_finish(vco_dev_t *p_vco, vco_cfg_t *p_vco_cfg);
+
+/** @brief  Internal Function to check if PHY VCO FLL is locked */
+static bool pll_vco_fll_locked(void *ctx);
+
+/** @brief  Internal Function to configure PHY VCO and select it as next VCO */
+static void pll_prepare_vco(pll_dev_t *pll,
+                            vco_dev_t *p_vco,
+                            uint8_t freq_id,
+                            pll_freq_cfg_t *cfg);
+
 void pll_init(pll_dev_t *pll, uint32_t base)
 {
     uint32_t reg_val;
     vco_dev_t *p_vco;
+    __UNUSED__ bool seen;
 
     // Initialize all VCOs
     for (uint8_t vco_id = 0; vco_id < VCO_INDEX_NUM; vco_id++)
@@ -42,34 +62,37 @@ void pll_init(pll_dev_t *pll, uint32_t base)
     pll->p_vco_current = NULL;
     pll->p_vco_next = NULL;
     pll->p_vco_prev = NULL;
+    pll->p_vco_parked = NULL;
     pll_init_reg_if(pll, base);
 
     /**
      * @note PLL interrupts might be enabled at boot so need to clear.
      */
     // Enable all interrupts
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_INITIAL_SWITCH_DONE_INT_EN, 0x1);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_CORE_LOCKED_INT_EN, 0x1);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_LOSS_OF_LOCK_INT_EN, 0x1);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
 
     // Wait until PLL has seen INT_EN updates
-    do
-    {
-        reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
-    } while (!(reg_val & DDR_MVP_PLL_CORE_STATUS_INT_EN_CORE_LOCKED_INT_EN__MSK));
+    seen = wddr_poll_reg(WDDR_POLL_SITE_PLL_INT_EN,
+                         (volatile uint32_t *) (uintptr_t) (pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR),
+                         DDR_MVP_PLL_CORE_STATUS_INT_EN_CORE_LOCKED_INT_EN__MSK,
+                         DDR_MVP_PLL_CORE_STATUS_INT_EN_CORE_LOCKED_INT_EN__MSK,
+                         NULL);
+    configASSERT(seen);
 
     // Read interrupt status and clear
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT__ADR);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT__ADR, reg_val);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_STATUS_INT__ADR);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_STATUS_INT__ADR, reg_val);
 
     // Disable all interrupts
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_INITIAL_SWITCH_DONE_INT_EN, 0x0);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_CORE_LOCKED_INT_EN, 0x0);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_LOSS_OF_LOCK_INT_EN, 0x0);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
 
     // Register IRQ
     request_irq(MCU_FAST_IRQ_PLL, pll_irq_handler, pll);
@@ -108,31 +131,53 @@ void pll_boot(pll_dev_t *pll)
 
 void pll_prepare_vco_switch(pll_dev_t *pll, uint8_t freq_id, pll_freq_cfg_t *cfg)
 {
-    vco_dev_t *p_vco;
-    vco_cfg_t *p_vco_cfg;
+    uint8_t vco_id;
 
     // Find available PHY VCO
-    for (uint8_t vco_id = VCO_INDEX_PHY_START; vco_id < VCO_INDEX_PHY_END; vco_id++)
+    pll_get_idle_vco(pll, &vco_id);
+    if (vco_id != UNDEFINED_VCO_ID)
     {
-        // If not current, then it's free.
-        if (vco_id != pll->p_vco_current->vco_id)
-        {
-            p_vco_cfg = &cfg->vco_cfg[vco_id - VCO_INDEX_PHY_START];
-            p_vco = &pll->vco[vco_id];
-
-            //  Configure VCO for given frequency
-            vco_set_enable_reg_if(p_vco, true);
-            vco_set_post_div_reg_if(p_vco, p_vco_cfg->post_div);
-            vco_set_int_frac_reg_if(p_vco, p_vco_cfg->int_comp, p_vco_cfg->prop_gain);
-            vco_set_band_reg_if(p_vco, p_vco_cfg->band, p_vco_cfg->fine, true);
-
-            // Set as next VCO
-            pll_set_vco_sel_reg_if(pll, vco_id);
-            pll->p_vco_next = p_vco;
-            p_vco->freq_id = freq_id;
-            break;
-        }
+        pll_prepare_vco(pll, &pll->vco[vco_id], freq_id, cfg);
+    }
+}
+
+void pll_prepare_vco_park(pll_dev_t *pll)
+{
+    // Already running from MCU VCO
+    if (pll->p_vco_current->vco_id == VCO_INDEX_MCU)
+    {
+        return;
     }
+
+    pll_set_vco_sel_reg_if(pll, VCO_INDEX_MCU);
+    pll->p_vco_next = &pll->vco[VCO_INDEX_MCU];
+    pll->p_vco_parked = pll->p_vco_current;
+}
+
+wddr_return_t pll_prepare_vco_unpark(pll_dev_t *pll, pll_freq_cfg_t *cfg)
+{
+    if (pll->p_vco_parked == NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    pll_prepare_vco(pll, pll->p_vco_parked, pll->p_vco_parked->freq_id, cfg);
+    pll->p_vco_parked = NULL;
+    return WDDR_SUCCESS;
+}
+
+wddr_return_t pll_abort_vco_park(pll_dev_t *pll)
+{
+    if (pll->p_vco_parked == NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    // PHY VCO is still enabled and locked
+    pll_set_vco_sel_reg_if(pll, pll->p_vco_parked->vco_id);
+    pll->p_vco_next = pll->p_vco_parked;
+    pll->p_vco_parked = NULL;
+    return WDDR_SUCCESS;
 }
 
 wddr_return_t pll_switch_vco(pll_dev_t *pll, bool is_sw_switch)
@@ -182,65 +227,114 @@ void pll_disable_vco(pll_dev_t *pll)
     pll->p_vco_prev = NULL;
 }
 
-void pll_calibrate_vco(pll_dev_t *pll, pll_freq_cfg_t *cfg)
+wddr_return_t pll_calibrate_vco(pll_dev_t *pll, pll_freq_cfg_t *cfg)
 {
-    vco_dev_t *p_vco;
-    vco_cfg_t *p_vco_cfg;
+    if (pll_calibrate_vco_start(pll, cfg))
+    {
+        return pll_calibrate_vco_finish(pll, cfg);
+    }
+
+    return WDDR_SUCCESS;
+}
 
+bool pll_calibrate_vco_start(pll_dev_t *pll, pll_freq_cfg_t *cfg)
+{
     // Can only calibrate prior to switching to a VCO used for PHY clock
     if (pll->p_vco_current != NULL && pll->p_vco_current->vco_id != VCO_INDEX_MCU)
     {
-        return;
+        return false;
     }
 
     for (uint8_t vco_id = VCO_INDEX_PHY_START; vco_id < VCO_INDEX_PHY_END; vco_id++)
     {
-        p_vco_cfg = &cfg->vco_cfg[vco_id - VCO_INDEX_PHY_START];
-        p_vco = &pll->vco[vco_id];
+        // VCOs lock independently of each other
+        pll_vco_fll_start(&pll->vco[vco_id], &cfg->vco_cfg[vco_id - VCO_INDEX_PHY_START]);
+    }
+
+    return true;
+}
+
+wddr_return_t pll_calibrate_vco_finish(pll_dev_t *pll, pll_freq_cfg_t *cfg)
+{
+    wddr_return_t ret = WDDR_SUCCESS;
+
+    for (uint8_t vco_id = VCO_INDEX_PHY_START; vco_id < VCO_INDEX_PHY_END; vco_id++)
+    {
+        // Finish all so that no FLL is left enabled
+        if (!pll_vco_fll_finish(&pll->vco[vco_id], &cfg->vco_cfg[vco_id - VCO_INDEX_PHY_START]))
+        {
+            ret = WDDR_ERROR_POLL_TIMEOUT;
+        }
+    }
 
-        // Configure VCO for given frequency
-        vco_set_fll_control2_reg_if(p_vco,
-                                    p_vco_cfg->fll_refclk_count,
-                                    p_vco_cfg->fll_range,
-                                    p_vco_cfg->fll_vco_count_target);
-        vco_set_fll_control1_reg_if(p_vco, p_vco_cfg->band, p_vco_cfg->fine, p_vco_cfg->lock_count_threshold);
+    return ret;
+}
 
-        // Enable VCO FLL
-        vco_set_fll_enable_reg_if(p_vco, true);
+wddr_return_t pll_calibrate_idle_vco(pll_dev_t *pll, uint8_t vco_id, pll_freq_cfg_t *cfg)
+{
+    vco_dev_t *p_vco;
+    vco_cfg_t *p_vco_cfg;
+    bool enabled, locked;
 
-        // Wait until locked
-        while (!vco_is_fll_locked(p_vco));
+    if (vco_id < VCO_INDEX_PHY_START || vco_id >= VCO_INDEX_PHY_END)
+    {
+        return WDDR_ERROR;
+    }
 
-        // Disable VCO FLL
-        vco_set_fll_enable_reg_if(p_vco, false);
+    p_vco = &pll->vco[vco_id];
+    p_vco_cfg = &cfg->vco_cfg[vco_id - VCO_INDEX_PHY_START];
 
-        // Get calibrated VCO values
-        vco_get_fll_band_status_reg_if(p_vco, &p_vco_cfg->band, &p_vco_cfg->fine);
+    // VCO must not be driving PLL or be needed to return to
+    if (p_vco == pll->p_vco_current ||
+        p_vco == pll->p_vco_prev ||
+        p_vco == pll->p_vco_parked)
+    {
+        return WDDR_ERROR;
+    }
+
+    // Preparation is overwritten by calibration
+    if (p_vco == pll->p_vco_next)
+    {
+        pll->p_vco_next = NULL;
     }
+
+    // Idle VCO is disabled after a switch; FLL can only lock a running VCO
+    enabled = vco_get_enable_reg_if(p_vco);
+    vco_set_enable_reg_if(p_vco, true);
+
+    // Release band override so FLL can search band
+    vco_set_band_reg_if(p_vco, p_vco_cfg->band, p_vco_cfg->fine, false);
+
+    pll_vco_fll_start(p_vco, p_vco_cfg);
+    locked = pll_vco_fll_finish(p_vco, p_vco_cfg);
+
+    // Leave VCO as it was
+    vco_set_enable_reg_if(p_vco, enabled);
+    return locked ? WDDR_SUCCESS : WDDR_ERROR_POLL_TIMEOUT;
 }
 
 void pll_set_loss_lock_interrupt_state(pll_dev_t *pll, bool enable)
 {
     uint32_t reg_val;
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_LOSS_OF_LOCK_INT_EN, enable);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
 }
 
 void pll_set_lock_interrupt_state(pll_dev_t *pll, bool enable)
 {
     uint32_t reg_val;
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_CORE_LOCKED_INT_EN, enable);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
 }
 
 void pll_set_init_lock_interrupt_state(pll_dev_t *pll, bool enable)
 {
     uint32_t reg_val;
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_INT_EN_INITIAL_SWITCH_DONE_INT_EN, enable);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_STATUS_INT_EN__ADR, reg_val);
 }
 
 void pll_get_current_vco(pll_dev_t *pll, uint8_t *vco_id)
@@ -261,6 +355,27 @@ void pll_get_next_vco(pll_dev_t *pll, uint8_t *vco_id)
     *vco_id = pll->p_vco_next->vco_id;
 }
 
+void pll_get_idle_vco(pll_dev_t *pll, uint8_t *vco_id)
+{
+    *vco_id = UNDEFINED_VCO_ID;
+
+    for (uint8_t id = VCO_INDEX_PHY_START; id < VCO_INDEX_PHY_END; id++)
+    {
+        // Parked VCO is relocked from its configuration on unpark
+        if (pll->p_vco_parked != NULL && id == pll->p_vco_parked->vco_id)
+        {
+            continue;
+        }
+
+        // If not current, then it's free.
+        if (pll->p_vco_current == NULL || id != pll->p_vco_current->vco_id)
+        {
+            *vco_id = id;
+            return;
+        }
+    }
+}
+
 void pll_get_current_freq(pll_dev_t *pll, uint8_t *freq_id)
 {
     *freq_id = pll->p_vco_current->freq_id;
@@ -273,18 +388,21 @@ static void pll_irq_handler(__UNUSED__ int irq, void *args)
     fw_msg_t msg;
     pll_dev_t *pll = (pll_dev_t *) args;
 
-    // Read PLL's IRQ status
+    // Read PLL's IRQ status (directly as in interrupt context)
     reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS_INT__ADR);
 
     // clear PLL's IRQ status
     reg_write(pll->base + DDR_MVP_PLL_CORE_STATUS_INT__ADR, reg_val);
 
+    fw_phy_trace(FW_PHY_TRACE_PLL_IRQ, FW_PHY_EVENT_NUM, FW_PHY_TRACE_STATE_NONE, reg_val);
+
     do
     {
         // Loss of lock (highest priority)
         if (reg_val & DDR_MVP_PLL_CORE_STATUS_INT_LOSS_OF_LOCK__MSK)
         {
             msg.event = FW_PHY_EVENT_PLL_LOSS_LOCK;
+            fw_phy_stats_inc(FW_PHY_STAT_PLL_LOSS_LOCK);
             break;
         }
 
@@ -306,6 +424,63 @@ static void pll_irq_handler(__UNUSED__ int irq, void *args)
     } while (0);
 
     // Send FW Event
+    msg.data = NULL;
+    msg.xSender = NULL;
+    msg.complete = NULL;
     fw_phy_task_notify_isr(&msg, &xHigherPriorityTaskWoken);
     portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
+
+static void pll_vco_fll_start(vco_dev_t *p_vco, vco_cfg_t *p_vco_cfg)
+{
+    // Configure VCO for given frequency
+    vco_set_fll_control2_reg_if(p_vco,
+                                p_vco_cfg->fll_refclk_count,
+                                p_vco_cfg->fll_range,
+                                p_vco_cfg->fll_vco_count_target);
+    vco_set_fll_control1_reg_if(p_vco, p_vco_cfg->band, p_vco_cfg->fine, p_vco_cfg->lock_count_threshold);
+
+    // Enable VCO FLL
+    vco_set_fll_enable_reg_if(p_vco, true);
+}
+
+static bool pll_vco_fll_finish(vco_dev_t *p_vco, vco_cfg_t *p_vco_cfg)
+{
+    // Wait until locked
+    bool locked = wddr_poll(WDDR_POLL_SITE_VCO_FLL_LOCK, pll_vco_fll_locked, p_vco);
+
+    // Disable VCO FLL
+    vco_set_fll_enable_reg_if(p_vco, false);
+
+    // Get calibrated VCO values; previous values are kept if not locked
+    if (locked)
+    {
+        vco_get_fll_band_status_reg_if(p_vco, &p_vco_cfg->band, &p_vco_cfg->fine);
+    }
+
+    return locked;
+}
+
+static bool pll_vco_fll_locked(void *ctx)
+{
+    return vco_is_fll_locked((vco_dev_t *) ctx);
+}
+
+static void pll_prepare_vco(pll_dev_t *pll,
+                            vco_dev_t *p_vco,
+                            uint8_t freq_id,
+                            pll_freq_cfg_t *cfg)
+{
+    vco_cfg_t *p_vco_cfg = &cfg->vco_cfg[p_vco->vco_id - VCO_INDEX_PHY_START];
+
+    //  Configure VCO for given frequency
+    vco_set_enable_reg_if(p_vco, true);
+    vco_set_post_div_reg_if(p_vco, p_vco_cfg->post_div);
+    vco_set_int_frac_reg_if(p_vco, p_vco_cfg->int_comp, p_vco_cfg->prop_gain);
+    vco_set_band_reg_if(p_vco, p_vco_cfg->band, p_vco_cfg->fine, true);
+
+    // Set as next VCO
+    pll_set_vco_sel_reg_if(pll, p_vco->vco_id);
+    pll->p_vco_next = p_vco;
+    p_vco->freq_id = freq_id;
+}
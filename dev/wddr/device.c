@@ -11,12 +11,14 @@
 
 /* Kernel includes. */
 #include <kernel/io.h>
+#include <cycles.h>
 
 /* LPDDR includes. */
 #include <wddr/device.h>
 #include <wddr/driver.h>
 #include <wddr/memory_map.h>
 #include <wddr/irq_map.h>
+#include <wddr/poll.h>
 #include <channel/device.h>
 #include <cmn/device.h>
 #include <ctrl/device.h>
@@ -24,14 +26,29 @@
 #include <dram/device.h>
 #include <fsw/device.h>
 
+/* Firmware includes. */
+#include <firmware/phy_stats.h>
+
 /*******************************************************************************
 **                           VARIABLE DECLARATIONS
 *******************************************************************************/
 packet_item_t packets[56] __attribute__ ((section (".data"))) = {0};
 
+// Stage timing of last boot
+static wddr_boot_report_t boot_report;
+
 /*******************************************************************************
 **                            FUNCTION DECLARATIONS
 *******************************************************************************/
+/** @brief  Internal Function to run PHY boot sequence */
+static wddr_return_t wddr_boot_sequence(wddr_dev_t *wddr, wddr_boot_cfg_t cfg);
+
+/** @brief  Internal Function to add cycles since start to a boot stage and restart */
+static void wddr_boot_stage_end(wddr_boot_stage_t stage, uint32_t *start);
+
+/** @brief  Internal Function to calibrate idle PHY VCO for frequency if it isn't yet */
+static wddr_return_t wddr_calibrate_vco_on_use(wddr_dev_t *wddr, uint8_t freq_id);
+
 /** @brief  Internal Function to enable all PHY LPDEs and Phase Interpolators */
 static void wddr_enable(wddr_dev_t *wddr);
 
@@ -46,18 +63,15 @@ static void wddr_dfi_buffer_flush(dfi_dev_t *dfi);
  */
 static void wddr_dfi_buffer_prime(dfi_dev_t *dfi);
 
-/** @brief  Internal Function to prepare MRW updates for frequency switch */
-static void wddr_prep_freq_switch_mrw_update(wddr_dev_t *wddr,
-                                             dfi_dev_t *dfi,
-                                             dram_freq_cfg_t *dram_cfg);
-
 /** @brief  Internal Function to clear FIFO for all channels */
 static void wddr_clear_fifo_all_channels(wddr_dev_t *wddr);
 
-/** @brief  Internal Function for preparing WDDR PHY for frequency switch */
-static void wddr_configure_phy(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr);
-
-/** @brief  Internal weak declaration of WDDR Training Function */
+/**
+ * @brief   Internal weak declaration of WDDR Training Function
+ *
+ * @note    Provided externally; NULL if no training is linked in, in which
+ *          case no frequency is ever marked as trained.
+ */
 __attribute__(( weak ))
 wddr_return_t wddr_train(wddr_dev_t *wddr);
 /*******************************************************************************
@@ -66,11 +80,14 @@ wddr_return_t wddr_train(wddr_dev_t *wddr);
 
 void wddr_init(wddr_dev_t *wddr, uint32_t base, wddr_table_t *table)
 {
+    // Nothing has been written yet; don't trust any shadowed CSR
+    csr_shadow_invalidate();
+
     // Early init to get MCU to clk speed
     fsw_init(&wddr->fsw, base);
     cmn_init(&wddr->cmn, base);
     ctrl_init(&wddr->ctrl, base);
-    pll_init(&wddr->pll, WDDR_MEMORY_MAP_PLL);
+    pll_init(&wddr->pll, base + WDDR_MEMORY_MAP_PLL);
 
     // Enable Common Block
     cmn_enable(&wddr->cmn);
@@ -114,19 +131,42 @@ void wddr_init(wddr_dev_t *wddr, uint32_t base, wddr_table_t *table)
 }
 
 wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg)
+{
+    wddr_return_t ret;
+    uint32_t start = get_cycles();
+    csr_profile_phase_t phase = csr_profile_set_phase(CSR_PROFILE_PHASE_BOOT);
+
+    memset(&boot_report, 0, sizeof(wddr_boot_report_t));
+    ret = wddr_boot_sequence(wddr, cfg);
+    boot_report.total = get_cycles() - start;
+
+    csr_profile_set_phase(phase);
+    return ret;
+}
+
+const wddr_boot_report_t *wddr_get_boot_report(void)
+{
+    return &boot_report;
+}
+
+static wddr_return_t wddr_boot_sequence(wddr_dev_t *wddr, wddr_boot_cfg_t cfg)
 {
     uint8_t current_vco_id;
+    wddr_return_t ret;
+    csr_profile_phase_t phase;
+    bool pll_cal = false;
+    uint32_t start = get_cycles();
 
-    // Calibrate all frequencies
+    // Start calibrating boot frequency; FLLs lock while CS / CKE are overridden
     if (GET_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_PLL_CAL))
     {
-        for (uint8_t freq_id = 0; freq_id < WDDR_PHY_VALID_FREQ_NUM; freq_id++)
-        {
-            pll_calibrate_vco(&wddr->pll,
-                              &wddr->table->cfg.freq[freq_id].pll);
-        }
+        pll_cal = pll_calibrate_vco_start(&wddr->pll, &wddr->table->cfg.freq[WDDR_PHY_BOOT_FREQ].pll);
     }
 
+    // Table values are used as is when not calibrating
+    memset(wddr->table->vco_cal, pll_cal ? 0 : PLL_PHY_VCO_MASK_ALL, sizeof(wddr->table->vco_cal));
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_PLL_CAL, &start);
+
     /**
      * @note Override CS / CKE as not sure of state of memory controller
      *       at this point.
@@ -157,22 +197,54 @@ wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg)
         ca_dq_driver_set_oe_reg_if(wddr->channel[channel].ca_reg, WDDR_MSR_0, CA_SLICE_CKE_0, true);
         ca_dq_driver_set_oe_reg_if(wddr->channel[channel].ca_reg, WDDR_MSR_0, CA_SLICE_CKE_1, true);
     }
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_OVERRIDE, &start);
+
+    // Calibrate all frequencies
+    if (pll_cal)
+    {
+        PROPAGATE_ERROR(pll_calibrate_vco_finish(&wddr->pll, &wddr->table->cfg.freq[WDDR_PHY_BOOT_FREQ].pll));
+        wddr->table->vco_cal[WDDR_PHY_BOOT_FREQ] = PLL_PHY_VCO_MASK_ALL;
+
+        /**
+         * @note    With lazy calibration, other frequencies are calibrated
+         *          on the idle VCO when first prepared or when firmware is
+         *          idle (see wddr_calibrate_idle_vco).
+         */
+        for (uint8_t freq_id = 0;
+             freq_id < WDDR_PHY_VALID_FREQ_NUM && !GET_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_PLL_CAL_LAZY);
+             freq_id++)
+        {
+            if (freq_id != WDDR_PHY_BOOT_FREQ)
+            {
+                PROPAGATE_ERROR(pll_calibrate_vco(&wddr->pll,
+                                                  &wddr->table->cfg.freq[freq_id].pll));
+                wddr->table->vco_cal[freq_id] = PLL_PHY_VCO_MASK_ALL;
+            }
+        }
+    }
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_PLL_CAL, &start);
 
     // Switch to PHY_BOOT Frequency
-    wddr_sw_freq_switch(wddr, WDDR_PHY_BOOT_FREQ, WDDR_MSR_0);
+    PROPAGATE_ERROR(wddr_sw_freq_switch(wddr, WDDR_PHY_BOOT_FREQ, WDDR_MSR_0));
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_FREQ_SWITCH, &start);
 
     // Turn on LPDE / Phase Interpolators in PHY
     wddr_enable(wddr);
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_ENABLE, &start);
 
     // Flush PHY through DFI buffer
     wddr_clear_fifo_all_channels(wddr);
-    fsw_csp_sync_reg_if(wddr->fsw.fsw_reg);
+    if (!fsw_csp_sync_reg_if(wddr->fsw.fsw_reg))
+    {
+        return WDDR_ERROR_POLL_TIMEOUT;
+    }
 
     wddr_configure_phy(wddr, WDDR_PHY_BOOT_FREQ, WDDR_MSR_0);
 
     wddr_dfi_buffer_flush(&wddr->dfi);
 
     wddr_clear_fifo_all_channels(wddr);
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_CONFIGURE, &start);
 
     // Perfrom ZQCAL Calibartion
     if (GET_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_ZQCAL_CAL))
@@ -180,6 +252,7 @@ wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg)
         wddr_iocal_calibrate(wddr);
         wddr_iocal_update_phy(wddr);
     }
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_ZQCAL, &start);
 
     // Set VREF code
     cmn_vref_set_code_reg_if(wddr->cmn.cmn_reg, WDDR_MSR_0, wddr->table->cfg.freq[WDDR_PHY_BOOT_FREQ].common.vref.code);
@@ -202,10 +275,13 @@ wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg)
             dq_dqs_rx_gb_set_mode_reg_if(wddr->channel[channel].dq_reg[byte], WDDR_MSR_0, &gb_cfg);
 
             // Perform Sense Amp calibration
-            PROPAGATE_ERROR(channel_rx_sa_dqbyte_configure(&wddr->channel[channel],
-                                                           byte,
-                                                           GET_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_SA_CAL) == 1,
-                                                           &wddr->table->cfg.common.channel[channel].dq[byte].rx.sa));
+            phase = csr_profile_set_phase(CSR_PROFILE_PHASE_SA_CAL);
+            ret = channel_rx_sa_dqbyte_configure(&wddr->channel[channel],
+                                                 byte,
+                                                 GET_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_SA_CAL) == 1,
+                                                 &wddr->table->cfg.common.channel[channel].dq[byte].rx.sa);
+            csr_profile_set_phase(phase);
+            PROPAGATE_ERROR(ret);
 
             // Reset Gearbox settings
             dq_dq_rx_gb_set_mode_reg_if(wddr->channel[channel].dq_reg[byte],
@@ -221,38 +297,73 @@ wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg)
         wddr_set_chip_select_reg_if(wddr, channel, WDDR_RANK_0, false);
 
     } // Channel loop
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_SA_CAL, &start);
 
     if (GET_BOOT_OPTION(cfg, WDDR_BOOT_OPTION_TRAIN_DRAM))
     {
-        PROPAGATE_ERROR(wddr_train(wddr));
+        PROPAGATE_ERROR(wddr_train_current_freq(wddr));
     }
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_TRAINING, &start);
 
     // Prime DFI buffer
     wddr_dfi_buffer_prime(&wddr->dfi);
     wddr_clear_fifo_all_channels(wddr);
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_DFI_PRIME, &start);
 
     // Switch VCOs until on VCO_INDEX_PHY_1
     pll_get_current_vco(&wddr->pll, &current_vco_id);
     while (current_vco_id != VCO_INDEX_PHY_1)
     {
-        wddr_sw_freq_switch(wddr, WDDR_PHY_BOOT_FREQ, WDDR_MSR_0);
+        PROPAGATE_ERROR(wddr_sw_freq_switch(wddr, WDDR_PHY_BOOT_FREQ, WDDR_MSR_0));
         pll_get_current_vco(&wddr->pll, &current_vco_id);
     }
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_VCO_WALK, &start);
 
-    fsw_switch_to_dfi_mode(&wddr->fsw, &wddr->dfi);
+    PROPAGATE_ERROR(fsw_switch_to_dfi_mode(&wddr->fsw, &wddr->dfi));
+    wddr_boot_stage_end(WDDR_BOOT_STAGE_DFI_MODE, &start);
     wddr->is_booted = true;
     return WDDR_SUCCESS;
 }
 
+static void wddr_boot_stage_end(wddr_boot_stage_t stage, uint32_t *start)
+{
+    uint32_t now = get_cycles();
+
+    boot_report.cycles[stage] += now - *start;
+    *start = now;
+}
+
 wddr_return_t wddr_prep_switch(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr)
 {
+    wddr_return_t ret;
+    csr_profile_phase_t phase;
+
     if (freq_id >= WDDR_PHY_FREQ_NUM ||
         !wddr->table->valid[freq_id])
     {
         return WDDR_ERROR;
     }
 
-    // Configure PHY
+    // Idle PHY VCO can't be prepared while PLL is parked
+    if (wddr->pll.p_vco_parked != NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    /**
+     * @note    Training results are written back into the frequency
+     *          configuration, so configuring from the table loads trained
+     *          values when present. No retraining is done here to keep
+     *          frequency switch time minimal.
+     */
+    phase = csr_profile_set_phase(CSR_PROFILE_PHASE_PREP);
+    ret = wddr_calibrate_vco_on_use(wddr, freq_id);
+    if (ret != WDDR_SUCCESS)
+    {
+        csr_profile_set_phase(phase);
+        return ret;
+    }
+
     wddr_configure_phy(wddr, freq_id, msr);
 
     // Prepare MRW sequence in DFI Buffer
@@ -265,15 +376,127 @@ wddr_return_t wddr_prep_switch(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr
                            freq_id,
                            &wddr->table->cfg.freq[freq_id].pll);
 
+    csr_profile_set_phase(phase);
     return WDDR_SUCCESS;
 }
 
+wddr_return_t wddr_train_current_freq(wddr_dev_t *wddr)
+{
+    uint8_t freq_id;
+    wddr_return_t ret;
+    wddr_train_state_t *state;
+    csr_profile_phase_t phase;
+
+    // Training is provided externally
+    if (wddr_train == NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    // PLL is parked on MCU VCO while in deep sleep
+    pll_get_current_freq(&wddr->pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    state = &wddr->table->trained[freq_id];
+
+    phase = csr_profile_set_phase(CSR_PROFILE_PHASE_TRAINING);
+    ret = wddr_train(wddr);
+    csr_profile_set_phase(phase);
+    PROPAGATE_ERROR(ret);
+
+    state->valid = true;
+    state->generation++;
+    return WDDR_SUCCESS;
+}
+
+bool wddr_calibrate_idle_vco(wddr_dev_t *wddr)
+{
+    uint8_t vco_id;
+    uint8_t freq_id;
+    uint8_t *vco_cal = wddr->table->vco_cal;
+    pll_dev_t *pll = &wddr->pll;
+
+    // Idle VCO is in use while a switch is prepared, completing or parked
+    if (pll->p_vco_next != NULL ||
+        pll->p_vco_prev != NULL ||
+        pll->p_vco_parked != NULL)
+    {
+        return false;
+    }
+
+    pll_get_idle_vco(pll, &vco_id);
+    if (vco_id == UNDEFINED_VCO_ID)
+    {
+        return false;
+    }
+
+    for (freq_id = 0; freq_id < WDDR_PHY_VALID_FREQ_NUM; freq_id++)
+    {
+        if (!(vco_cal[freq_id] & PLL_PHY_VCO_MASK(vco_id)))
+        {
+            break;
+        }
+    }
+
+    if (freq_id == WDDR_PHY_VALID_FREQ_NUM ||
+        pll_calibrate_idle_vco(pll, vco_id, &wddr->table->cfg.freq[freq_id].pll) != WDDR_SUCCESS)
+    {
+        return false;
+    }
+
+    vco_cal[freq_id] |= PLL_PHY_VCO_MASK(vco_id);
+    fw_phy_stats_inc(FW_PHY_STAT_VCO_CAL_IDLE);
+
+    // More work if any remaining frequency isn't calibrated on idle VCO
+    while (++freq_id < WDDR_PHY_VALID_FREQ_NUM)
+    {
+        if (!(vco_cal[freq_id] & PLL_PHY_VCO_MASK(vco_id)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool wddr_is_freq_trained(wddr_dev_t *wddr, uint8_t freq_id)
+{
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return false;
+    }
+
+    return wddr->table->trained[freq_id].valid;
+}
+
+bool wddr_is_switch_prepared(wddr_dev_t *wddr)
+{
+    return wddr->pll.p_vco_next != NULL;
+}
+
+void wddr_invalidate_training(wddr_dev_t *wddr, uint8_t freq_id)
+{
+    if (freq_id < WDDR_PHY_FREQ_NUM)
+    {
+        // New generation so that state derived from old training is dropped
+        wddr->table->trained[freq_id].valid = false;
+        wddr->table->trained[freq_id].generation++;
+    }
+}
+
 void wddr_iocal_update_phy(wddr_dev_t *wddr)
 {
     uint8_t freq_id;
 
-    // Get current pll frequency id
+    // Get current pll frequency id; nothing to update while parked
     pll_get_current_freq(&wddr->pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return;
+    }
 
     // Get current msr
     wddr_msr_t msr = fsw_get_current_msr(&wddr->fsw);
@@ -304,13 +527,23 @@ void wddr_iocal_update_phy(wddr_dev_t *wddr)
 void wddr_iocal_calibrate(wddr_dev_t *wddr)
 {
     __UNUSED__ wddr_return_t ret;
-    ret = cmn_zqcal_calibrate(&wddr->cmn, &wddr->table->cfg.common.common.zqcal);
+    zqcal_cfg_t *zqcal = &wddr->table->cfg.common.common.zqcal;
+    zqcal_cfg_t prev = *zqcal;
+    csr_profile_phase_t phase = csr_profile_set_phase(CSR_PROFILE_PHASE_ZQCAL);
+
+    ret = cmn_zqcal_calibrate(&wddr->cmn, zqcal);
+    csr_profile_set_phase(phase);
     configASSERT(ret == WDDR_SUCCESS);
+
+    // Code changes show how much the IO drifted between calibrations
+    if (memcmp(&prev, zqcal, sizeof(zqcal_cfg_t)) != 0)
+    {
+        fw_phy_stats_inc(FW_PHY_STAT_ZQCAL_CHANGE);
+    }
 }
 
 wddr_return_t wddr_sw_freq_switch(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr)
 {
-    uint32_t reg_val;
     uint8_t next_vco;
     pll_dev_t *pll = &wddr->pll;
 
@@ -320,6 +553,9 @@ wddr_return_t wddr_sw_freq_switch(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t
         return WDDR_ERROR;
     }
 
+    // Idle PHY VCO must be calibrated before it can be prepared
+    PROPAGATE_ERROR(wddr_calibrate_vco_on_use(wddr, freq_id));
+
     // Don't toggle MSR
     fsw_ctrl_set_msr_toggle_en_reg_if(wddr->fsw.fsw_reg, false);
 
@@ -338,10 +574,14 @@ wddr_return_t wddr_sw_freq_switch(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t
     pll_switch_vco(pll, true);
 
     // Block until PLL is ready
-    do
+    if (!wddr_poll_reg(WDDR_POLL_SITE_PLL_CORE_READY,
+                       (volatile uint32_t *) (uintptr_t) (pll->base + DDR_MVP_PLL_CORE_STATUS__ADR),
+                       DDR_MVP_PLL_CORE_STATUS_CORE_READY__MSK,
+                       DDR_MVP_PLL_CORE_STATUS_CORE_READY__MSK,
+                       NULL))
     {
-        reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_STATUS__ADR);
-    } while (!GET_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_STATUS_CORE_READY));
+        return WDDR_ERROR_POLL_TIMEOUT;
+    }
 
     // Put back to normal state
     fsw_ctrl_set_msr_toggle_en_reg_if(wddr->fsw.fsw_reg, true);
@@ -352,6 +592,25 @@ wddr_return_t wddr_sw_freq_switch(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t
     return WDDR_SUCCESS;
 }
 
+static wddr_return_t wddr_calibrate_vco_on_use(wddr_dev_t *wddr, uint8_t freq_id)
+{
+    uint8_t vco_id;
+
+    // Same VCO that pll_prepare_vco_switch selects
+    pll_get_idle_vco(&wddr->pll, &vco_id);
+    if (vco_id == UNDEFINED_VCO_ID ||
+        (wddr->table->vco_cal[freq_id] & PLL_PHY_VCO_MASK(vco_id)))
+    {
+        return WDDR_SUCCESS;
+    }
+
+    // Switching to an uncalibrated VCO wouldn't lock
+    PROPAGATE_ERROR(pll_calibrate_idle_vco(&wddr->pll, vco_id, &wddr->table->cfg.freq[freq_id].pll));
+    wddr->table->vco_cal[freq_id] |= PLL_PHY_VCO_MASK(vco_id);
+    fw_phy_stats_inc(FW_PHY_STAT_VCO_CAL_PREP);
+    return WDDR_SUCCESS;
+}
+
 static void wddr_enable(wddr_dev_t *wddr)
 {
     for (uint8_t channel = WDDR_CHANNEL_0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
@@ -429,9 +688,9 @@ static void wddr_dfi_buffer_prime(dfi_dev_t *dfi)
     dfi_buffer_disable(dfi);
 }
 
-static void wddr_prep_freq_switch_mrw_update(wddr_dev_t *wddr,
-                                             dfi_dev_t *dfi,
-                                             dram_freq_cfg_t *dram_cfg)
+void wddr_prep_freq_switch_mrw_update(wddr_dev_t *wddr,
+                                      dfi_dev_t *dfi,
+                                      dram_freq_cfg_t *dram_cfg)
 {
     dfi_tx_packet_buffer_t packet_buffer;
     packet_storage_t storage = {
@@ -560,30 +819,30 @@ static inline void rx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_REN_PI_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.ren.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_REN_PI_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.ren.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_REN_PI_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_RX_REN_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_REN_PI_CFG[msr][rank], reg_val);
 
         // RCS PI
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_RX_RCS_PI_M1_R0_CFG_CODE, cfg->rank[rank].dqs.pi.rcs.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RCS_PI_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.rcs.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RCS_PI_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.rcs.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RCS_PI_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_RX_RCS_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_RCS_PI_CFG[msr][rank], reg_val);
 
         // RDQS PI
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_RX_RDQS_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].dqs.pi.rdqs.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RDQS_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.rdqs.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RDQS_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.rdqs.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RDQS_PI_0_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_RX_RDQS_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_RDQS_PI_0_CFG[msr][rank], reg_val);
 
         // SDR LPDE
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_RX_SDR_LPDE_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.sdr_lpde.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_SDR_LPDE_M1_R0_CFG_CTRL_BIN, cfg->rank[rank].dqs.sdr_lpde.delay);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_SDR_LPDE_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_RX_SDR_LPDE_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_SDR_LPDE_CFG[msr][rank], reg_val);
 
         // Receiver
-        reg_val = UPDATE_REG_FIELD(dq_reg->DDR_DQ_DQS_RX_IO_CMN_CFG[msr][rank],
+        reg_val = UPDATE_REG_FIELD(CSR_READ(dq_reg->DDR_DQ_DQS_RX_IO_CMN_CFG[msr][rank]),
                                    DDR_DQ_DQS_RX_IO_CMN_M1_R0_CFG_CAL_P_C,
                                    common_cfg->rank[rank].dqs.receiver.code[REC_P_SIDE][REC_C_SIDE]);
 
@@ -611,7 +870,7 @@ static inline void rx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
                                    DDR_DQ_DQS_RX_IO_CMN_M1_R0_CFG_DCPATH_EN,
                                    cfg->rank[rank].dqs.receiver.path_state);
 
-        dq_reg->DDR_DQ_DQS_RX_IO_CMN_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_IO_CMN_CFG[msr][rank], reg_val);
 
 
         reg_val = UPDATE_REG_FIELD(0,
@@ -622,18 +881,18 @@ static inline void rx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
                                    DDR_DQ_DQS_RX_IO_M1_R0_CFG_0_DLY_CTRL_C,
                                    cfg->rank[rank].dqs.receiver.rx_delay[REC_C_SIDE]);
 
-        dq_reg->DDR_DQ_DQS_RX_IO_CFG[msr][rank][1] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_IO_CFG[msr][rank][1], reg_val);
 
         // Gearbox
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_RX_M1_CFG_RGB_MODE, cfg->rank_cmn.cmn.gearbox.data_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_M1_CFG_FGB_MODE, cfg->rank_cmn.cmn.gearbox.fifo_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_M1_CFG_WCK_MODE, cfg->rank_cmn.cmn.gearbox.wck_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_M1_CFG_PRE_FILTER_SEL, cfg->rank_cmn.cmn.gearbox.pre_filter_sel);
-        dq_reg->DDR_DQ_DQS_RX_CFG[msr] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_CFG[msr], reg_val);
 
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_RX_M1_CFG_RGB_MODE, cfg->rank_cmn.cmn.gearbox.data_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_RX_M1_CFG_FGB_MODE, cfg->rank_cmn.cmn.gearbox.fifo_mode);
-        dq_reg->DDR_DQ_DQ_RX_CFG[msr] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_RX_CFG[msr], reg_val);
     }
 }
 
@@ -661,17 +920,17 @@ static inline void rx_path_ca_block_freq_switch_prep(ca_reg_t *ca_reg,
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_RX_SDR_LPDE_M1_R0_CFG_GEAR, cfg->rank[rank].ck.sdr_lpde.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_RX_SDR_LPDE_M1_R0_CFG_CTRL_BIN, cfg->rank[rank].ck.sdr_lpde.delay);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_RX_SDR_LPDE_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_RX_SDR_LPDE_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_RX_SDR_LPDE_CFG[msr][rank], reg_val);
 
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_RX_M1_CFG_RGB_MODE, cfg->rank_cmn.cmn.gearbox.data_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_RX_M1_CFG_FGB_MODE, cfg->rank_cmn.cmn.gearbox.fifo_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_RX_M1_CFG_WCK_MODE, cfg->rank_cmn.cmn.gearbox.wck_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_RX_M1_CFG_PRE_FILTER_SEL, cfg->rank_cmn.cmn.gearbox.pre_filter_sel);
-        ca_reg->DDR_CA_DQS_RX_CFG[msr] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_RX_CFG[msr], reg_val);
 
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQ_RX_M1_CFG_RGB_MODE, cfg->rank_cmn.cmn.gearbox.data_mode);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_RX_M1_CFG_FGB_MODE, cfg->rank_cmn.cmn.gearbox.fifo_mode);
-        ca_reg->DDR_CA_DQ_RX_CFG[msr] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_RX_CFG[msr], reg_val);
     }
 }
 
@@ -699,32 +958,32 @@ static inline void tx_bit_pipeline_prep_ca(ca_reg_t *ca_reg,
 
         // SDR
         // FC Delay
-        ca_reg->DDR_CA_DQ_TX_SDR_FC_DLY_CFG[msr][rank][bit_index] = cfg->rank[rank].ca.pipeline.sdr.fc_delay;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_SDR_FC_DLY_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.sdr.fc_delay);
 
         // PIPE EN
-        ca_reg->DDR_CA_DQ_TX_SDR_CFG[msr][rank][bit_index] = cfg->rank[rank].ca.pipeline.sdr.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_SDR_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.sdr.pipe_en);
 
         // X SEL
-        ca_reg->DDR_CA_DQ_TX_SDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].ca.pipeline.sdr.x_sel;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_SDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.sdr.x_sel);
 
         // DDR
         // PIPE EN
-        ca_reg->DDR_CA_DQ_TX_DDR_CFG[msr][rank][bit_index] = cfg->rank[rank].ca.pipeline.ddr.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_DDR_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.ddr.pipe_en);
 
         // X SEL
-        ca_reg->DDR_CA_DQ_TX_DDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].ca.pipeline.ddr.x_sel;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_DDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.ddr.x_sel);
 
         // QDR
         // PIPE EN
-        ca_reg->DDR_CA_DQ_TX_QDR_CFG[msr][rank][bit_index] = cfg->rank[rank].ca.pipeline.qdr.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_QDR_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.qdr.pipe_en);
 
         // X SEL
-        ca_reg->DDR_CA_DQ_TX_QDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].ca.pipeline.qdr.x_sel;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_QDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].ca.pipeline.qdr.x_sel);
 
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_GEAR, cfg->rank[rank].ca.lpde[bit_index].gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_CTRL_BIN, cfg->rank[rank].ca.lpde[bit_index].delay);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_EN, 0x1);
-        ca_reg->DDR_CA_DQ_TX_LPDE_CFG[msr][rank][bit_index] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_LPDE_CFG[msr][rank][bit_index], reg_val);
     }
 }
 
@@ -751,32 +1010,32 @@ static inline void tx_bit_pipeline_prep_ck(ca_reg_t *ca_reg,
 
         // SDR
         // FC Delay
-        ca_reg->DDR_CA_DQS_TX_SDR_FC_DLY_CFG[msr][rank][bit_index] = cfg->rank[rank].ck.pipeline.sdr.fc_delay;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_FC_DLY_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.sdr.fc_delay);
 
         // PIPE EN
-        ca_reg->DDR_CA_DQS_TX_SDR_CFG[msr][rank][bit_index] = cfg->rank[rank].ck.pipeline.sdr.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.sdr.pipe_en);
 
         // X SEL
-        ca_reg->DDR_CA_DQS_TX_SDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].ck.pipeline.sdr.x_sel;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.sdr.x_sel);
 
         // DDR
         // PIPE EN
-        ca_reg->DDR_CA_DQS_TX_DDR_CFG[msr][rank][bit_index] = cfg->rank[rank].ck.pipeline.ddr.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_DDR_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.ddr.pipe_en);
 
         // X SEL
-        ca_reg->DDR_CA_DQS_TX_DDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].ck.pipeline.ddr.x_sel;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_DDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.ddr.x_sel);
 
         // QDR
         // PIPE EN
-        ca_reg->DDR_CA_DQS_TX_QDR_CFG[msr][rank][bit_index] = cfg->rank[rank].ck.pipeline.qdr.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_QDR_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.qdr.pipe_en);
 
         // X SEL
-        ca_reg->DDR_CA_DQS_TX_QDR_X_SEL_CFG[msr][rank][bit_index] = cfg->rank[rank].ck.pipeline.qdr.x_sel;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_QDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].ck.pipeline.qdr.x_sel);
 
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_LPDE_M1_R0_CFG_0_GEAR, cfg->rank[rank].ck.lpde[bit_index].gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M1_R0_CFG_0_CTRL_BIN, cfg->rank[rank].ck.lpde[bit_index].delay);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M1_R0_CFG_0_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_LPDE_CFG[msr][rank][bit_index] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_LPDE_CFG[msr][rank][bit_index], reg_val);
     }
 }
 
@@ -803,80 +1062,80 @@ static inline void tx_path_ca_block_freq_switch_prep(ca_reg_t *ca_reg,
         **                     CA
         ************************************************/
 
-        ca_reg->DDR_CA_DQ_TX_RT_CFG[msr][rank] = cfg->rank[rank].ca.rt.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_RT_CFG[msr][rank], cfg->rank[rank].ca.rt.pipe_en);
 
         // ODR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQ_TX_ODR_PI_M1_R0_CFG_CODE, cfg->rank[rank].ca.pi.odr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_ODR_PI_M1_R0_CFG_GEAR, cfg->rank[rank].ca.pi.odr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_ODR_PI_M1_R0_CFG_XCPL, cfg->rank[rank].ca.pi.odr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_ODR_PI_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQ_TX_ODR_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_ODR_PI_CFG[msr][rank], reg_val);
 
         // QDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQ_TX_QDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].ca.pi.qdr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_QDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].ca.pi.qdr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_QDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].ca.pi.qdr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_QDR_PI_0_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQ_TX_QDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_QDR_PI_0_CFG[msr][rank], reg_val);
 
         // DDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQ_TX_DDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].ca.pi.ddr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_DDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].ca.pi.ddr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_DDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].ca.pi.ddr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_DDR_PI_0_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQ_TX_DDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_DDR_PI_0_CFG[msr][rank], reg_val);
 
         // RT
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQ_TX_PI_RT_M1_R0_CFG_CODE, cfg->rank[rank].ca.pi.rt.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_PI_RT_M1_R0_CFG_GEAR, cfg->rank[rank].ca.pi.rt.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_PI_RT_M1_R0_CFG_XCPL, cfg->rank[rank].ca.pi.rt.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_PI_RT_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQ_TX_PI_RT_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_PI_RT_CFG[msr][rank], reg_val);
 
         /************************************************
         **                     CK
         ************************************************/
-        ca_reg->DDR_CA_DQS_TX_RT_CFG[msr][rank] = cfg->rank[rank].ck.rt.pipe_en;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_RT_CFG[msr][rank], cfg->rank[rank].ck.rt.pipe_en);
 
         // ODR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_ODR_PI_M1_R0_CFG_CODE, cfg->rank[rank].ck.pi.odr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_ODR_PI_M1_R0_CFG_GEAR, cfg->rank[rank].ck.pi.odr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_ODR_PI_M1_R0_CFG_XCPL, cfg->rank[rank].ck.pi.odr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_ODR_PI_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_ODR_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_ODR_PI_CFG[msr][rank], reg_val);
 
         // QDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_QDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].ck.pi.qdr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_QDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].ck.pi.qdr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_QDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].ck.pi.qdr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_QDR_PI_0_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_QDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_QDR_PI_0_CFG[msr][rank], reg_val);
 
         // DDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_DDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].ca.pi.ddr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_DDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].ca.pi.ddr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_DDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].ca.pi.ddr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_DDR_PI_0_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_DDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_DDR_PI_0_CFG[msr][rank], reg_val);
 
         // RT
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_PI_RT_M1_R0_CFG_CODE, cfg->rank[rank].ck.pi.rt.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_PI_RT_M1_R0_CFG_GEAR, cfg->rank[rank].ck.pi.rt.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_PI_RT_M1_R0_CFG_XCPL, cfg->rank[rank].ck.pi.rt.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_PI_RT_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_PI_RT_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_PI_RT_CFG[msr][rank], reg_val);
 
         // SDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_SDR_PI_M1_R0_CFG_GEAR, cfg->rank[rank].ck.pi.sdr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_SDR_PI_M1_R0_CFG_XCPL, cfg->rank[rank].ck.pi.sdr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_SDR_PI_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_SDR_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_PI_CFG[msr][rank], reg_val);
 
         // DFI
         reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_DFI_PI_M1_R0_CFG_GEAR, cfg->rank[rank].ck.pi.dfi.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_DFI_PI_M1_R0_CFG_XCPL, cfg->rank[rank].ck.pi.dfi.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_DFI_PI_M1_R0_CFG_EN, 0x1);
-        ca_reg->DDR_CA_DQS_TX_DFI_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_DFI_PI_CFG[msr][rank], reg_val);
 
         reg_val = UPDATE_REG_FIELD(0,
                                    DDR_CA_DQS_TX_IO_CMN_M1_R0_CFG_NCAL,
@@ -890,13 +1149,13 @@ static inline void tx_path_ca_block_freq_switch_prep(ca_reg_t *ca_reg,
                                    DDR_CA_DQS_TX_IO_CMN_M1_R0_CFG_SE_MODE,
                                    cfg->rank[rank].ck.driver.mode);
 
-        ca_reg->DDR_CA_DQS_TX_IO_CMN_CFG[msr][rank] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_IO_CMN_CFG[msr][rank], reg_val);
     }
 
     /************************************************
     **                     CA
     ************************************************/
-    reg_val = UPDATE_REG_FIELD(ca_reg->DDR_CA_DQ_TX_IO_CFG[msr][0], DDR_CA_DQ_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.ca.driver.override.sel);
+    reg_val = UPDATE_REG_FIELD(CSR_READ(ca_reg->DDR_CA_DQ_TX_IO_CFG[msr][0]), DDR_CA_DQ_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.ca.driver.override.sel);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_IO_M1_CFG_0_OVRD_VAL, cfg->rank_cmn.ca.driver.override.val_t);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_IO_M1_CFG_0_TX_IMPD, cfg->rank_cmn.ca.driver.tx_impd);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQ_TX_IO_M1_CFG_0_RX_IMPD, cfg->rank_cmn.ca.driver.rx_impd);
@@ -906,15 +1165,15 @@ static inline void tx_path_ca_block_freq_switch_prep(ca_reg_t *ca_reg,
     {
         tx_bit_pipeline_prep_ca(ca_reg, msr, bit_index, cfg);
 
-        ca_reg->DDR_CA_DQ_TX_IO_CFG[msr][bit_index] = reg_val;
-        ca_reg->DDR_CA_DQ_TX_EGRESS_DIG_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.dig_mode;
-        ca_reg->DDR_CA_DQ_TX_EGRESS_ANA_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.ana_mode;
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_IO_CFG[msr][bit_index], reg_val);
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_EGRESS_DIG_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.dig_mode);
+        CSR_WRITE(ca_reg->DDR_CA_DQ_TX_EGRESS_ANA_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.ana_mode);
     }
 
     /************************************************
     **                     CK
     ************************************************/
-    reg_val = UPDATE_REG_FIELD(ca_reg->DDR_CA_DQS_TX_IO_CFG[msr][0], DDR_CA_DQS_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.ck.driver.override.sel);
+    reg_val = UPDATE_REG_FIELD(CSR_READ(ca_reg->DDR_CA_DQS_TX_IO_CFG[msr][0]), DDR_CA_DQS_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.ck.driver.override.sel);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_IO_M1_CFG_0_OVRD_VAL_T, cfg->rank_cmn.ck.driver.override.val_t);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_IO_M1_CFG_0_OVRD_VAL_C, cfg->rank_cmn.ck.driver.override.val_c);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_IO_M1_CFG_0_TX_IMPD, cfg->rank_cmn.ck.driver.tx_impd);
@@ -924,17 +1183,17 @@ static inline void tx_path_ca_block_freq_switch_prep(ca_reg_t *ca_reg,
     for (uint8_t bit_index = 0; bit_index < WDDR_PHY_CK_SLICE_NUM; bit_index++)
     {
         tx_bit_pipeline_prep_ck(ca_reg, msr, bit_index, cfg);
-        ca_reg->DDR_CA_DQS_TX_IO_CFG[msr][bit_index] = reg_val;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_IO_CFG[msr][bit_index], reg_val);
         // Egress
-        ca_reg->DDR_CA_DQS_TX_EGRESS_DIG_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.dig_mode;
-        ca_reg->DDR_CA_DQS_TX_EGRESS_ANA_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.ana_mode;
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_EGRESS_DIG_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.dig_mode);
+        CSR_WRITE(ca_reg->DDR_CA_DQS_TX_EGRESS_ANA_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.ana_mode);
     }
 
     // Gearbox
     reg_val = UPDATE_REG_FIELD(0x0, DDR_CA_DQS_TX_M1_CFG_TGB_MODE, cfg->rank_cmn.ck.gearbox.data_mode);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_M1_CFG_WGB_MODE, cfg->rank_cmn.ck.gearbox.write_mode);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CA_DQS_TX_M1_CFG_CK2WCK_RATIO, cfg->rank_cmn.ck.gearbox.ck2wck_ratio);
-    ca_reg->DDR_CA_DQS_TX_CFG[msr] = reg_val;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_CFG[msr], reg_val);
 }
 
 /**
@@ -960,32 +1219,32 @@ static inline void tx_bit_pipeline_prep_dq(dq_reg_t *dq_reg,
 
         // SDR
         // FC Delay
-        dq_reg->DDR_DQ_DQ_TX_SDR_FC_DLY_CFG[msr][rank][bit_index] = cfg->rank[rank].dq.pipeline.sdr.fc_delay;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_SDR_FC_DLY_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.sdr.fc_delay);
 
         // PIPE EN
-        dq_reg->DDR_DQ_DQ_TX_SDR_CFG[msr][rank][bit_index] = cfg->rank[rank].dq.pipeline.sdr.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_SDR_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.sdr.pipe_en);
 
         // X SEL
-        dq_reg->DDR_DQ_DQ_TX_SDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].dq.pipeline.sdr.x_sel;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_SDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.sdr.x_sel);
 
         // DDR
         // PIPE EN
-        dq_reg->DDR_DQ_DQ_TX_DDR_CFG[msr][rank][bit_index] = cfg->rank[rank].dq.pipeline.ddr.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_DDR_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.ddr.pipe_en);
 
         // X SEL
-        dq_reg->DDR_DQ_DQ_TX_DDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].dq.pipeline.ddr.x_sel;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_DDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.ddr.x_sel);
 
         // QDR
         // PIPE EN
-        dq_reg->DDR_DQ_DQ_TX_QDR_CFG[msr][rank][bit_index] = cfg->rank[rank].dq.pipeline.qdr.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_QDR_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.qdr.pipe_en);
 
         // X SEL
-        dq_reg->DDR_DQ_DQ_TX_QDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].dq.pipeline.qdr.x_sel;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_QDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].dq.pipeline.qdr.x_sel);
 
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_GEAR, cfg->rank[rank].dq.lpde[bit_index].gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_CTRL_BIN, cfg->rank[rank].dq.lpde[bit_index].delay);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_EN, 0x1);
-        dq_reg->DDR_DQ_DQ_TX_LPDE_CFG[msr][rank][bit_index] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_LPDE_CFG[msr][rank][bit_index], reg_val);
     }
 }
 
@@ -1011,34 +1270,34 @@ static inline void tx_bit_pipeline_prep_dqs(dq_reg_t *dq_reg,
     {
         // SDR
         // FC Delay
-        dq_reg->DDR_DQ_DQS_TX_SDR_FC_DLY_CFG[msr][rank][bit_index] = cfg->rank[rank].dqs.pipeline[bit_index].sdr.fc_delay;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_SDR_FC_DLY_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].sdr.fc_delay);
 
         // PIPE EN
-        dq_reg->DDR_DQ_DQS_TX_SDR_CFG[msr][rank][bit_index] = cfg->rank[rank].dqs.pipeline[bit_index].sdr.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_SDR_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].sdr.pipe_en);
 
         // X SEL
-        dq_reg->DDR_DQ_DQS_TX_SDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].dqs.pipeline[bit_index].sdr.x_sel;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_SDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].sdr.x_sel);
 
         // DDR
         // PIPE EN
-        dq_reg->DDR_DQ_DQS_TX_DDR_CFG[msr][rank][bit_index] = cfg->rank[rank].dqs.pipeline[bit_index].ddr.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_DDR_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].ddr.pipe_en);
 
         // X SEL
-        dq_reg->DDR_DQ_DQS_TX_DDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].dqs.pipeline[bit_index].ddr.x_sel;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_DDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].ddr.x_sel);
 
         // QDR
         // PIPE EN
-        dq_reg->DDR_DQ_DQS_TX_QDR_CFG[msr][rank][bit_index] = cfg->rank[rank].dqs.pipeline[bit_index].qdr.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_QDR_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].qdr.pipe_en);
 
         // X SEL
-        dq_reg->DDR_DQ_DQS_TX_QDR_X_SEL_CFG[msr][rank][bit_index] =cfg->rank[rank].dqs.pipeline[bit_index].qdr.x_sel;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_QDR_X_SEL_CFG[msr][rank][bit_index], cfg->rank[rank].dqs.pipeline[bit_index].qdr.x_sel);
 
         if (bit_index < WDDR_PHY_DQS_TXRX_SLICE_NUM)
         {
             reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_LPDE_M0_R0_CFG_0_GEAR, cfg->rank[rank].dqs.lpde[bit_index].gear);
             reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_LPDE_M0_R0_CFG_0_CTRL_BIN, cfg->rank[rank].dqs.lpde[bit_index].delay);
             reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_LPDE_M0_R0_CFG_0_EN, 0x1);
-            dq_reg->DDR_DQ_DQS_TX_LPDE_CFG[msr][rank][bit_index] = reg_val;
+            CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_LPDE_CFG[msr][rank][bit_index], reg_val);
         }
     }
 }
@@ -1064,80 +1323,80 @@ static inline void tx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
         /************************************************
         **                  DQ
         ************************************************/
-        dq_reg->DDR_DQ_DQ_TX_RT_CFG[msr][rank] = cfg->rank[rank].dq.rt.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_RT_CFG[msr][rank], cfg->rank[rank].dq.rt.pipe_en);
 
         // ODR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_ODR_PI_M1_R0_CFG_CODE, cfg->rank[rank].dq.pi.odr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_ODR_PI_M1_R0_CFG_GEAR, cfg->rank[rank].dq.pi.odr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_ODR_PI_M1_R0_CFG_XCPL, cfg->rank[rank].dq.pi.odr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_ODR_PI_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQ_TX_ODR_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_ODR_PI_CFG[msr][rank], reg_val);
 
         // QDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_QDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].dq.pi.qdr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_QDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].dq.pi.qdr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_QDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].dq.pi.qdr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_QDR_PI_0_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQ_TX_QDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_QDR_PI_0_CFG[msr][rank], reg_val);
 
         // DDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_DDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].dq.pi.ddr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_DDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].dq.pi.ddr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_DDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].dq.pi.ddr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_DDR_PI_0_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQ_TX_DDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_DDR_PI_0_CFG[msr][rank], reg_val);
 
         // RT
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQ_TX_PI_RT_M1_R0_CFG_CODE, cfg->rank[rank].dq.pi.rt.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_PI_RT_M1_R0_CFG_GEAR, cfg->rank[rank].dq.pi.rt.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_PI_RT_M1_R0_CFG_XCPL, cfg->rank[rank].dq.pi.rt.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_PI_RT_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQ_TX_PI_RT_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_PI_RT_CFG[msr][rank], reg_val);
 
         /************************************************
         **                  DQS
         ************************************************/
-        dq_reg->DDR_DQ_DQS_TX_RT_CFG[msr][rank] = cfg->rank[rank].dqs.rt.pipe_en;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_RT_CFG[msr][rank], cfg->rank[rank].dqs.rt.pipe_en);
 
         // ODR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_ODR_PI_M1_R0_CFG_CODE, cfg->rank[rank].dqs.pi.odr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_ODR_PI_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.odr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_ODR_PI_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.odr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_ODR_PI_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_TX_ODR_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_ODR_PI_CFG[msr][rank], reg_val);
 
         // QDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_QDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].dqs.pi.qdr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_QDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.qdr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_QDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.qdr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_QDR_PI_0_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_TX_QDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_QDR_PI_0_CFG[msr][rank], reg_val);
 
         // DDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_DDR_PI_0_M1_R0_CFG_CODE, cfg->rank[rank].dqs.pi.ddr.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DDR_PI_0_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.ddr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DDR_PI_0_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.ddr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DDR_PI_0_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_TX_DDR_PI_0_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_DDR_PI_0_CFG[msr][rank], reg_val);
 
         // RT
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_PI_RT_M1_R0_CFG_CODE, cfg->rank[rank].dqs.pi.rt.code);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_PI_RT_M1_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.rt.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_PI_RT_M1_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.rt.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_PI_RT_M1_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_TX_PI_RT_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_PI_RT_CFG[msr][rank], reg_val);
 
         // SDR
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_SDR_PI_M0_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.sdr.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_SDR_PI_M0_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.sdr.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_SDR_PI_M0_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_TX_SDR_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_SDR_PI_CFG[msr][rank], reg_val);
 
         // DFI
         reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_DFI_PI_M0_R0_CFG_GEAR, cfg->rank[rank].dqs.pi.dfi.gear);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DFI_PI_M0_R0_CFG_XCPL, cfg->rank[rank].dqs.pi.dfi.xcpl);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DFI_PI_M0_R0_CFG_EN, 0x1);
-        dq_reg->DDR_DQ_DQS_TX_DFI_PI_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_DFI_PI_CFG[msr][rank], reg_val);
 
         reg_val = UPDATE_REG_FIELD(0,
                                    DDR_DQ_DQS_TX_IO_CMN_M1_R0_CFG_NCAL,
@@ -1151,14 +1410,14 @@ static inline void tx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
                                    DDR_DQ_DQS_TX_IO_CMN_M1_R0_CFG_SE_MODE,
                                    cfg->rank[rank].dqs.driver.mode);
 
-        dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank], reg_val);
     }
 
     /************************************************
     **                  DQ
     ************************************************/
     // DQ Driver
-    reg_val = UPDATE_REG_FIELD(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][0], DDR_DQ_DQ_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.dq.driver.override.sel);
+    reg_val = UPDATE_REG_FIELD(CSR_READ(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][0]), DDR_DQ_DQ_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.dq.driver.override.sel);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M1_CFG_0_OVRD_VAL, cfg->rank_cmn.dq.driver.override.val_t);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M1_CFG_0_TX_IMPD, cfg->rank_cmn.dq.driver.tx_impd);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M1_CFG_0_RX_IMPD, cfg->rank_cmn.dq.driver.rx_impd);
@@ -1167,10 +1426,10 @@ static inline void tx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
     for (uint8_t bit_index = 0; bit_index < WDDR_PHY_DQ_SLICE_NUM; bit_index++)
     {
         tx_bit_pipeline_prep_dq(dq_reg, msr, bit_index, cfg);
-        dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit_index] = reg_val;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit_index], reg_val);
         // Egress
-        dq_reg->DDR_DQ_DQ_TX_EGRESS_DIG_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.dig_mode;
-        dq_reg->DDR_DQ_DQ_TX_EGRESS_ANA_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.ana_mode;
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_EGRESS_DIG_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.dig_mode);
+        CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_EGRESS_ANA_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.ana_mode);
     }
 
     /************************************************
@@ -1178,7 +1437,7 @@ static inline void tx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
     ************************************************/
 
     // DQS Driver
-    reg_val = UPDATE_REG_FIELD(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][0], DDR_DQ_DQS_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.dqs.driver.override.sel);
+    reg_val = UPDATE_REG_FIELD(CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][0]), DDR_DQ_DQS_TX_IO_M1_CFG_0_OVRD_SEL, cfg->rank_cmn.dqs.driver.override.sel);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M1_CFG_0_OVRD_VAL_T, cfg->rank_cmn.dqs.driver.override.val_t);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M1_CFG_0_OVRD_VAL_C, cfg->rank_cmn.dqs.driver.override.val_c);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M1_CFG_0_TX_IMPD, cfg->rank_cmn.dqs.driver.tx_impd);
@@ -1190,12 +1449,12 @@ static inline void tx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
         tx_bit_pipeline_prep_dqs(dq_reg, msr, bit_index, cfg);
 
         // Egress
-        dq_reg->DDR_DQ_DQS_TX_EGRESS_DIG_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.dig_mode;
-        dq_reg->DDR_DQ_DQS_TX_EGRESS_ANA_CFG[msr][bit_index] = cfg->rank_cmn.cmn.egress.ana_mode;
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_EGRESS_DIG_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.dig_mode);
+        CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_EGRESS_ANA_CFG[msr][bit_index], cfg->rank_cmn.cmn.egress.ana_mode);
 
         if (bit_index < WDDR_PHY_DQS_TXRX_SLICE_NUM)
         {
-            dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit_index] = reg_val;
+            CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit_index], reg_val);
         }
     }
 
@@ -1203,7 +1462,7 @@ static inline void tx_path_dq_block_freq_switch_prep(dq_reg_t *dq_reg,
     reg_val = UPDATE_REG_FIELD(0x0, DDR_DQ_DQS_TX_M1_CFG_TGB_MODE, cfg->rank_cmn.dqs.gearbox.data_mode);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_M1_CFG_WGB_MODE, cfg->rank_cmn.dqs.gearbox.write_mode);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_M1_CFG_CK2WCK_RATIO, cfg->rank_cmn.dqs.gearbox.ck2wck_ratio);
-    dq_reg->DDR_DQ_DQS_TX_CFG[msr] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_CFG[msr], reg_val);
 }
 
 /**
@@ -1311,7 +1570,7 @@ static inline void dfi_freq_switch_prep(dfi_dev_t *dfi, wddr_msr_t msr, dfi_freq
  * This preps PHY only. Another call to the Frequency Switch FSM must be made to
  * prep PLL and pefrom the switch (if desired).
  */
-static void wddr_configure_phy(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr)
+void wddr_configure_phy(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr)
 {
     channel_dev_t *channel_dev;
 
@@ -1342,9 +1601,3 @@ static void wddr_configure_phy(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr
     // DFI Prep
     dfi_freq_switch_prep(&wddr->dfi, msr, &wddr->table->cfg.freq[freq_id].dfi);
 }
-
-wddr_return_t wddr_train(wddr_dev_t *wddr)
-{
-    // This must be implemented in an external function.
-    return WDDR_SUCCESS;
-}
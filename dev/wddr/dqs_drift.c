@@ -0,0 +1,318 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+/* LPDDR includes. */
+#include <wddr/dqs_drift.h>
+#include <wddr/driver.h>
+#include <dfi/buffer.h>
+#include <dram/device.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define MR_DQS_OSC_LSB              (0x12)
+#define MR_DQS_OSC_MSB              (0x13)
+#define PI_CODE_MAX                 (0x3F)
+
+// Number of EG packets that cover a single MRR burst
+#define DQS_DRIFT_RX_PACKET_NUM     (8)
+
+/**
+ * @note    RX packets hold all DQ bytes of all channels. DQ byte 0 of
+ *          each channel carries the mode register data.
+ */
+#define DQS_DRIFT_RX_DQ(channel)    ((channel) * WDDR_PHY_DQ_BYTE_NUM)
+
+// Reads first valid phase of the given RX DQ byte in a packet
+#define RX_FIRST_VALID(p, n, op)                                                    \
+    ((p)->dq##n##_dfi_rddata_valid_w0 ? (*(op) = (p)->dq##n##_dfi_rddata_w0, true) : \
+     (p)->dq##n##_dfi_rddata_valid_w1 ? (*(op) = (p)->dq##n##_dfi_rddata_w1, true) : \
+     (p)->dq##n##_dfi_rddata_valid_w2 ? (*(op) = (p)->dq##n##_dfi_rddata_w2, true) : \
+     (p)->dq##n##_dfi_rddata_valid_w3 ? (*(op) = (p)->dq##n##_dfi_rddata_w3, true) : \
+     false)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static wddr_dqs_drift_t drift_state[WDDR_PHY_FREQ_NUM] = {0};
+
+/** @note Too large for the FW task stack */
+static dfi_rx_packet_buffer_t rx_buffer;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to read DQS oscillator count of all channels */
+static wddr_return_t wddr_dqs_drift_read_count(wddr_dev_t *wddr,
+                                               wddr_rank_t rank,
+                                               uint16_t count[WDDR_PHY_CHANNEL_NUM]);
+
+/** @brief  Internal Function to send MRR sequence and read back its data */
+static wddr_return_t wddr_dqs_drift_mrr(wddr_dev_t *wddr,
+                                        dfi_tx_packet_buffer_t *buffer,
+                                        uint8_t op[WDDR_PHY_CHANNEL_NUM]);
+
+/** @brief  Internal Function to extract MRR data for a single RX DQ byte */
+static bool wddr_dqs_drift_extract(uint8_t dq, uint8_t *op);
+
+/**
+ * @brief   WDDR DQS Drift Codes
+ *
+ * @details Internal Function to convert change in oscillator count into a
+ *          Phase Interpolator code offset.
+ *
+ *          tDQS2DQ = run_time * 16 tCK / (2 * count), so the change in delay
+ *          since training is 8 * run_time * (1 / count - 1 / base) tCK.
+ *
+ * @param[in]   base    oscillator count captured after training.
+ * @param[in]   count   current oscillator count.
+ *
+ * @return      code offset, rounded to nearest code.
+ */
+static int16_t wddr_dqs_drift_codes(uint16_t base, uint16_t count);
+
+/** @brief  Internal Function to move PI codes of a channel / rank to target offset */
+static void wddr_dqs_drift_apply(wddr_dev_t *wddr,
+                                 uint8_t freq_id,
+                                 wddr_channel_t channel,
+                                 wddr_rank_t rank,
+                                 int16_t target);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+wddr_return_t wddr_dqs_drift_track(wddr_dev_t *wddr, wddr_rank_t rank)
+{
+    uint8_t freq_id;
+    int16_t target;
+    uint16_t count[WDDR_PHY_CHANNEL_NUM];
+    wddr_dqs_drift_t *drift;
+    wddr_train_state_t *trained;
+
+    if (rank >= WDDR_PHY_RANK)
+    {
+        return WDDR_ERROR;
+    }
+
+    pll_get_current_freq(&wddr->pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    trained = &wddr->table->trained[freq_id];
+    drift = &drift_state[freq_id];
+
+    // Drift is measured relative to training
+    if (!trained->valid)
+    {
+        return WDDR_ERROR;
+    }
+
+    // Retraining invalidates baseline and offsets
+    if (drift->generation != trained->generation)
+    {
+        memset(drift, 0, sizeof(wddr_dqs_drift_t));
+        drift->generation = trained->generation;
+    }
+
+    PROPAGATE_ERROR(wddr_dqs_drift_read_count(wddr, rank, count));
+
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        drift->count[channel][rank] = count[channel];
+
+        if (drift->base[channel][rank] == 0)
+        {
+            drift->base[channel][rank] = count[channel];
+            continue;
+        }
+
+        target = wddr_dqs_drift_codes(drift->base[channel][rank], count[channel]);
+        wddr_dqs_drift_apply(wddr, freq_id, channel, rank, target);
+    }
+
+    return WDDR_SUCCESS;
+}
+
+const wddr_dqs_drift_t *wddr_dqs_drift_get_state(uint8_t freq_id)
+{
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return NULL;
+    }
+
+    return &drift_state[freq_id];
+}
+
+static wddr_return_t wddr_dqs_drift_read_count(wddr_dev_t *wddr,
+                                               wddr_rank_t rank,
+                                               uint16_t count[WDDR_PHY_CHANNEL_NUM])
+{
+    wddr_return_t ret;
+    uint8_t lsb[WDDR_PHY_CHANNEL_NUM], msb[WDDR_PHY_CHANNEL_NUM];
+    dfi_tx_packet_buffer_t buffer;
+
+    // Run oscillator and read LSB
+    dfi_tx_packet_buffer_init(&buffer);
+    ret = dram_prepare_dqs_osc_sequence(&wddr->dram, &buffer, (chipselect_t) rank, WDDR_DQS_DRIFT_RUN_TIME);
+    if (ret == WDDR_SUCCESS)
+    {
+        ret = dram_prepare_mrr_sequence(&wddr->dram, &buffer, (chipselect_t) rank, MR_DQS_OSC_LSB, 0);
+    }
+    if (ret == WDDR_SUCCESS)
+    {
+        ret = wddr_dqs_drift_mrr(wddr, &buffer, lsb);
+    }
+    dfi_tx_packet_buffer_free(&buffer);
+    PROPAGATE_ERROR(ret);
+
+    // Read MSB
+    dfi_tx_packet_buffer_init(&buffer);
+    ret = dram_prepare_mrr_sequence(&wddr->dram, &buffer, (chipselect_t) rank, MR_DQS_OSC_MSB, 0);
+    if (ret == WDDR_SUCCESS)
+    {
+        ret = wddr_dqs_drift_mrr(wddr, &buffer, msb);
+    }
+    dfi_tx_packet_buffer_free(&buffer);
+    PROPAGATE_ERROR(ret);
+
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        count[channel] = (msb[channel] << 8) | lsb[channel];
+
+        // Oscillator didn't run
+        if (count[channel] == 0)
+        {
+            return WDDR_ERROR;
+        }
+    }
+
+    return WDDR_SUCCESS;
+}
+
+static wddr_return_t wddr_dqs_drift_mrr(wddr_dev_t *wddr,
+                                        dfi_tx_packet_buffer_t *buffer,
+                                        uint8_t op[WDDR_PHY_CHANNEL_NUM])
+{
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        wddr_clear_fifo_reg_if(wddr, channel);
+    }
+
+    if (dfi_buffer_fill_and_send_packets(&wddr->dfi, &buffer->list) != DFI_SUCCESS)
+    {
+        dfi_buffer_disable(&wddr->dfi);
+        return WDDR_ERROR;
+    }
+
+    // Short read is expected; packets that weren't read stay invalid
+    dfi_rx_packet_buffer_init(&rx_buffer);
+    dfi_buffer_read_packets(&wddr->dfi, &rx_buffer, DQS_DRIFT_RX_PACKET_NUM);
+
+    // Must disable buffer when done
+    dfi_buffer_disable(&wddr->dfi);
+
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        if (!wddr_dqs_drift_extract(DQS_DRIFT_RX_DQ(channel), &op[channel]))
+        {
+            return WDDR_ERROR;
+        }
+    }
+
+    return WDDR_SUCCESS;
+}
+
+static bool wddr_dqs_drift_extract(uint8_t dq, uint8_t *op)
+{
+    bool found = false;
+    const dfi_rx_packet_desc_t *packet;
+
+    for (uint8_t nn = 0; nn < DQS_DRIFT_RX_PACKET_NUM && !found; nn++)
+    {
+        packet = &rx_buffer.buffer[nn].packet;
+        switch (dq)
+        {
+            case 0:
+                found = RX_FIRST_VALID(packet, 0, op);
+                break;
+            case 1:
+                found = RX_FIRST_VALID(packet, 1, op);
+                break;
+            case 2:
+                found = RX_FIRST_VALID(packet, 2, op);
+                break;
+            case 3:
+                found = RX_FIRST_VALID(packet, 3, op);
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return found;
+}
+
+static int16_t wddr_dqs_drift_codes(uint16_t base, uint16_t count)
+{
+    int32_t num = (int32_t) WDDR_DQS_DRIFT_PI_CODES_PER_TCK * 8 *
+                  WDDR_DQS_DRIFT_RUN_TIME * ((int32_t) base - count);
+    int32_t den = (int32_t) base * count;
+
+    // Round to nearest code
+    num += (num >= 0) ? den / 2 : -den / 2;
+    return (int16_t) (num / den);
+}
+
+static void wddr_dqs_drift_apply(wddr_dev_t *wddr,
+                                 uint8_t freq_id,
+                                 wddr_channel_t channel,
+                                 wddr_rank_t rank,
+                                 int16_t target)
+{
+    int16_t code;
+    pi_cfg_t *pi;
+    dq_reg_t *dq_reg;
+    int16_t *applied = drift_state[freq_id].applied[channel][rank];
+    channel_freq_cfg_t *ch_cfg = &wddr->table->cfg.freq[freq_id].channel[channel];
+    bool prepared = wddr_is_switch_prepared(wddr);
+
+    for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+    {
+        if (target == applied[byte])
+        {
+            continue;
+        }
+
+        dq_reg = wddr->channel[channel].dq_reg[byte];
+        pi = &ch_cfg->dq[byte].tx.rank[rank].dq.pi.ddr;
+
+        code = (int16_t) pi->code + target - applied[byte];
+        code = code < 0 ? 0 : code;
+        code = code > PI_CODE_MAX ? PI_CODE_MAX : code;
+
+        // Track what was written, not what was measured, if code was clamped
+        applied[byte] += code - (int16_t) pi->code;
+        pi->code = code;
+
+        /**
+         * @note    Inactive MSR first so the active MSR is never ahead of
+         *          it. A prepared switch owns the inactive MSR; it is
+         *          loaded from the table on the next PREP instead.
+         */
+        if (!prepared)
+        {
+            dq_dq_pi_ddr_set_cfg_reg_if(dq_reg, fsw_get_next_msr(&wddr->fsw), rank, true, pi->val);
+        }
+        dq_dq_pi_ddr_set_cfg_reg_if(dq_reg, fsw_get_current_msr(&wddr->fsw), rank, true, pi->val);
+    }
+}
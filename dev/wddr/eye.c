@@ -0,0 +1,647 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* LPDDR includes. */
+#include <wddr/eye.h>
+#include <wddr/driver.h>
+#include <dfi/buffer.h>
+#include <dram/device.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define EYE_WORD_INDEX(code)        ((code) >> 5)
+#define EYE_BIT_INDEX(code)         ((code) & 0x1F)
+#define EYE_RANK_SELECTED(cfg, r)   ((cfg)->rank_mask & (1 << (r)))
+#define EYE_FIFO_PATTERN_EVEN       (0x5A)
+#define EYE_FIFO_PATTERN_ODD        (0xA5)
+
+// MR14 OP[5:0] is the VREF setting (51 to 63 reserved); OP[6] is the range
+#define EYE_DRAM_VREF_SETTING_MSK   (0x3F)
+#define EYE_DRAM_VREF_SETTING_MAX   (50)
+#define EYE_DRAM_VREF_MAX           (0x7F)
+#define EYE_PHY_VREF_MAX            (DDR_CMN_VREF_M0_CFG_CTRL__MSK >> DDR_CMN_VREF_M0_CFG_CTRL__SHFT)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+/** @note Result of the most recent scan; kept for readback over the messenger */
+static wddr_eye_t eye_result;
+
+// Scan in progress; rows can be scanned in separate PHYMSTR windows
+static struct
+{
+    wddr_eye_test_t test;       // Test of the scan; NULL if none in progress
+    void            *ctx;       // Context passed to the test
+    uint16_t        orig_vref;  // VREF restored after each row
+    uint8_t         rows;       // Number of rows scanned
+} eye_scan;
+
+/** @note Too large for the FW task stack */
+static dfi_rx_packet_buffer_t rx_buffer;
+static command_data_t fifo_pattern;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to check every VREF of the sweep is in range */
+static bool wddr_eye_vref_valid(const wddr_eye_scan_cfg_t *cfg);
+
+/** @brief  Internal Function to program a VREF setting / code */
+static void wddr_eye_set_vref(wddr_dev_t *wddr,
+                              const wddr_eye_scan_cfg_t *cfg,
+                              wddr_msr_t msr,
+                              uint16_t vref);
+
+/** @brief  Internal Function to program a timing code for one DQ byte */
+static void wddr_eye_set_timing(wddr_dev_t *wddr,
+                                const wddr_eye_scan_cfg_t *cfg,
+                                channel_freq_cfg_t *ch_cfg,
+                                wddr_msr_t msr,
+                                uint8_t rank,
+                                uint8_t byte,
+                                uint8_t code);
+
+/** @brief  Internal Function to restore table timing code for one DQ byte */
+static void wddr_eye_restore_timing(wddr_dev_t *wddr,
+                                    const wddr_eye_scan_cfg_t *cfg,
+                                    channel_freq_cfg_t *ch_cfg,
+                                    wddr_msr_t msr,
+                                    uint8_t rank,
+                                    uint8_t byte);
+
+/** @brief  Internal Function to save timing code for one DQ byte to table */
+static void wddr_eye_save_timing(const wddr_eye_scan_cfg_t *cfg,
+                                 channel_freq_cfg_t *ch_cfg,
+                                 uint8_t rank,
+                                 uint8_t byte,
+                                 uint8_t code);
+
+/**
+ * @brief   WDDR Eye Widest Run
+ *
+ * @details Internal Function to find the widest contiguous run of passing
+ *          codes in a packed row.
+ *
+ * @param[in]   row     packed pass / fail row.
+ * @param[out]  center  pointer to store center code of the widest run.
+ *
+ * @return      width of the widest run.
+ */
+static uint8_t wddr_eye_widest_run(const uint32_t row[WDDR_EYE_ROW_WORD_NUM],
+                                   uint8_t *center);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+wddr_return_t wddr_eye_scan(wddr_dev_t *wddr,
+                            const wddr_eye_scan_cfg_t *cfg,
+                            wddr_eye_test_t test,
+                            void *ctx)
+{
+    PROPAGATE_ERROR(wddr_eye_scan_start(wddr, cfg, test, ctx));
+
+    for (uint8_t row = 0; row < cfg->vref_num; row++)
+    {
+        PROPAGATE_ERROR(wddr_eye_scan_row(wddr, row));
+    }
+
+    return wddr_eye_scan_finish(wddr);
+}
+
+wddr_return_t wddr_eye_scan_start(wddr_dev_t *wddr,
+                                  const wddr_eye_scan_cfg_t *cfg,
+                                  wddr_eye_test_t test,
+                                  void *ctx)
+{
+    uint8_t freq_id;
+
+    if (test == NULL ||
+        cfg->timing_axis > WDDR_EYE_TIMING_AXIS_RX_RDQS_PI ||
+        cfg->channel >= WDDR_PHY_CHANNEL_NUM ||
+        cfg->rank_mask == 0 ||
+        cfg->rank_mask > WDDR_EYE_RANK_MASK_ALL ||
+        cfg->vref_num == 0 ||
+        cfg->vref_num > WDDR_EYE_VREF_STEP_MAX ||
+        !wddr_eye_vref_valid(cfg))
+    {
+        return WDDR_ERROR;
+    }
+
+    // RX packet helpers only cover DQ bytes of channel 0
+    if (test == wddr_eye_fifo_test && cfg->channel != WDDR_CHANNEL_0)
+    {
+        return WDDR_ERROR;
+    }
+
+    // PLL is parked on MCU VCO while in deep sleep
+    pll_get_current_freq(&wddr->pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    // Readers check valid and read in a critical section; rows aren't touched until then
+    taskENTER_CRITICAL();
+    memset(&eye_result, 0, sizeof(eye_result));
+    eye_result.cfg = *cfg;
+    taskEXIT_CRITICAL();
+
+    eye_scan.test = test;
+    eye_scan.ctx = ctx;
+    eye_scan.rows = 0;
+    if (cfg->vref_axis == WDDR_EYE_VREF_AXIS_DRAM)
+    {
+        eye_scan.orig_vref = wddr->table->cfg.freq[freq_id].dram.mr14;
+    }
+    else
+    {
+        eye_scan.orig_vref = wddr->table->cfg.freq[freq_id].common.vref.code;
+    }
+
+    return WDDR_SUCCESS;
+}
+
+wddr_return_t wddr_eye_scan_row(wddr_dev_t *wddr, uint8_t row)
+{
+    wddr_return_t ret = WDDR_SUCCESS;
+    uint8_t freq_id;
+    uint8_t row_width;
+    uint16_t vref;
+    uint8_t pass[WDDR_PHY_RANK];
+    wddr_msr_t msr;
+    wddr_eye_map_t *map;
+    channel_freq_cfg_t *ch_cfg;
+    const wddr_eye_scan_cfg_t *cfg = &eye_result.cfg;
+
+    // Rows are scanned in order after a scan is started
+    if (eye_scan.test == NULL || row != eye_scan.rows || row >= cfg->vref_num)
+    {
+        return WDDR_ERROR;
+    }
+
+    pll_get_current_freq(&wddr->pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    msr = fsw_get_current_msr(&wddr->fsw);
+    ch_cfg = &wddr->table->cfg.freq[freq_id].channel[cfg->channel];
+
+    vref = cfg->vref_start + row * cfg->vref_step;
+    wddr_eye_set_vref(wddr, cfg, msr, vref);
+
+    for (uint8_t code = 0; code < WDDR_EYE_TIMING_CODE_NUM; code++)
+    {
+        // Ranks are interleaved; every selected rank moves to this step
+        for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+        {
+            if (!EYE_RANK_SELECTED(cfg, rank))
+            {
+                continue;
+            }
+
+            for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+            {
+                wddr_eye_set_timing(wddr, cfg, ch_cfg, msr, rank, byte, code);
+            }
+        }
+
+        // One test covers every rank and byte of the channel
+        memset(pass, 0, sizeof(pass));
+        ret = eye_scan.test(wddr, cfg, eye_scan.ctx, pass);
+        if (ret != WDDR_SUCCESS)
+        {
+            break;
+        }
+
+        for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+        {
+            for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+            {
+                if (EYE_RANK_SELECTED(cfg, rank) && (pass[rank] & (1 << byte)))
+                {
+                    map = &eye_result.map[rank][byte];
+                    map->row[row][EYE_WORD_INDEX(code)] |= (1UL << EYE_BIT_INDEX(code));
+                }
+            }
+        }
+    }
+
+    // Leave PHY / DRAM as they were; bus may be handed back between rows
+    for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+    {
+        if (!EYE_RANK_SELECTED(cfg, rank))
+        {
+            continue;
+        }
+
+        for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+        {
+            wddr_eye_restore_timing(wddr, cfg, ch_cfg, msr, rank, byte);
+        }
+    }
+    wddr_eye_set_vref(wddr, cfg, msr, eye_scan.orig_vref);
+
+    // Test couldn't run; partial map isn't meaningful
+    PROPAGATE_ERROR(ret);
+
+    // VREF is shared; eye at this step is limited by the narrowest byte
+    row_width = WDDR_EYE_TIMING_CODE_NUM;
+    for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+    {
+        if (!EYE_RANK_SELECTED(cfg, rank))
+        {
+            continue;
+        }
+
+        for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+        {
+            map = &eye_result.map[rank][byte];
+            map->width[row] = wddr_eye_widest_run(map->row[row], &map->center[row]);
+            if (map->width[row] < row_width)
+            {
+                row_width = map->width[row];
+            }
+        }
+    }
+
+    if (row_width > eye_result.best_width)
+    {
+        eye_result.best_width = row_width;
+        eye_result.best_row = row;
+        eye_result.best_vref = vref;
+    }
+
+    eye_scan.rows++;
+    return WDDR_SUCCESS;
+}
+
+wddr_return_t wddr_eye_scan_finish(wddr_dev_t *wddr)
+{
+    uint8_t freq_id;
+    wddr_msr_t msr;
+    wddr_eye_map_t *map;
+    channel_freq_cfg_t *ch_cfg;
+    const wddr_eye_scan_cfg_t *cfg = &eye_result.cfg;
+
+    if (eye_scan.test == NULL || eye_scan.rows != cfg->vref_num)
+    {
+        return WDDR_ERROR;
+    }
+
+    pll_get_current_freq(&wddr->pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    msr = fsw_get_current_msr(&wddr->fsw);
+    ch_cfg = &wddr->table->cfg.freq[freq_id].channel[cfg->channel];
+    eye_scan.test = NULL;
+    eye_result.valid = true;
+
+    // Nothing passed; VREF and timing codes were left as they were
+    if (eye_result.best_width == 0)
+    {
+        return WDDR_ERROR;
+    }
+
+    // Rank specific eye centers go to their own table slots
+    if (cfg->train)
+    {
+        for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+        {
+            if (!EYE_RANK_SELECTED(cfg, rank))
+            {
+                continue;
+            }
+
+            for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+            {
+                map = &eye_result.map[rank][byte];
+                wddr_eye_save_timing(cfg, ch_cfg, rank, byte, map->center[eye_result.best_row]);
+                wddr_eye_restore_timing(wddr, cfg, ch_cfg, msr, rank, byte);
+            }
+        }
+    }
+
+    // Apply and save selected VREF
+    wddr_eye_set_vref(wddr, cfg, msr, eye_result.best_vref);
+    if (cfg->vref_axis == WDDR_EYE_VREF_AXIS_PHY)
+    {
+        wddr->table->cfg.freq[freq_id].common.vref.code = eye_result.best_vref;
+    }
+
+    return WDDR_SUCCESS;
+}
+
+wddr_return_t wddr_eye_fifo_test(wddr_dev_t *wddr,
+                                 const wddr_eye_scan_cfg_t *cfg,
+                                 void *ctx,
+                                 uint8_t pass[WDDR_PHY_RANK])
+{
+    wddr_return_t ret = WDDR_ERROR;
+    uint8_t is_same;
+    dfi_tx_packet_buffer_t buffer;
+    command_data_t *data = (command_data_t *) ctx;
+    uint8_t phases = 2 << wddr->dram.cfg->ratio;
+    uint8_t num_packets = BL_16 / phases;
+
+    // RX packet helpers only cover DQ bytes of channel 0
+    if (cfg->channel != WDDR_CHANNEL_0)
+    {
+        return WDDR_ERROR;
+    }
+
+    if (data == NULL)
+    {
+        for (uint8_t nn = 0; nn < MAX_DATA_SIZE; nn++)
+        {
+            for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+            {
+                fifo_pattern.dq[byte][nn] = (nn & 0x1) ? EYE_FIFO_PATTERN_ODD : EYE_FIFO_PATTERN_EVEN;
+            }
+        }
+        data = &fifo_pattern;
+    }
+
+    // Write all ranks, then read all ranks back to back
+    dfi_tx_packet_buffer_init(&buffer);
+    for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+    {
+        if (EYE_RANK_SELECTED(cfg, rank))
+        {
+            dram_prepare_wrfifo_sequence(&wddr->dram, &buffer, BL_16, (chipselect_t) rank, 0, data);
+        }
+    }
+
+    for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+    {
+        if (EYE_RANK_SELECTED(cfg, rank))
+        {
+            dram_prepare_rdfifo_sequence(&wddr->dram, &buffer, BL_16, (chipselect_t) rank, 0);
+        }
+    }
+
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        wddr_clear_fifo_reg_if(wddr, channel);
+    }
+
+    if (dfi_buffer_fill_and_send_packets(&wddr->dfi, &buffer.list) == DFI_SUCCESS)
+    {
+        ret = WDDR_SUCCESS;
+
+        // One readback per selected rank; EG FIFO holds read data in rank order
+        for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+        {
+            if (!EYE_RANK_SELECTED(cfg, rank))
+            {
+                continue;
+            }
+
+            dfi_rx_packet_buffer_init(&rx_buffer);
+            if (dfi_buffer_read_packets(&wddr->dfi, &rx_buffer, num_packets) != DFI_SUCCESS)
+            {
+                ret = WDDR_ERROR;
+                break;
+            }
+
+            for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+            {
+                dfi_rx_packet_buffer_data_compare(&rx_buffer,
+                                                  data,
+                                                  byte,
+                                                  PACKET_DATA_MASK_BOTH,
+                                                  num_packets,
+                                                  phases,
+                                                  &is_same);
+                pass[rank] |= (is_same ? 1 : 0) << byte;
+            }
+        }
+    }
+
+    // Must disable buffer when done
+    dfi_buffer_disable(&wddr->dfi);
+    dfi_tx_packet_buffer_free(&buffer);
+    return ret;
+}
+
+const wddr_eye_t *wddr_eye_get_result(void)
+{
+    return &eye_result;
+}
+
+wddr_return_t wddr_eye_read_word(uint8_t rank,
+                                 uint8_t byte,
+                                 uint8_t row,
+                                 uint8_t word,
+                                 uint32_t *data)
+{
+    wddr_return_t ret = WDDR_ERROR;
+
+    // Result is invalid while a scan is in progress
+    taskENTER_CRITICAL();
+    if (eye_result.valid &&
+        rank < WDDR_PHY_RANK &&
+        EYE_RANK_SELECTED(&eye_result.cfg, rank) &&
+        byte < WDDR_PHY_DQ_BYTE_NUM &&
+        row < eye_result.cfg.vref_num &&
+        word < WDDR_EYE_ROW_WORD_NUM)
+    {
+        *data = eye_result.map[rank][byte].row[row][word];
+        ret = WDDR_SUCCESS;
+    }
+    taskEXIT_CRITICAL();
+
+    return ret;
+}
+
+static bool wddr_eye_vref_valid(const wddr_eye_scan_cfg_t *cfg)
+{
+    uint32_t vref;
+
+    for (uint8_t row = 0; row < cfg->vref_num; row++)
+    {
+        vref = cfg->vref_start + (uint32_t) row * cfg->vref_step;
+
+        switch (cfg->vref_axis)
+        {
+            case WDDR_EYE_VREF_AXIS_DRAM:
+                if (vref > EYE_DRAM_VREF_MAX ||
+                    (vref & EYE_DRAM_VREF_SETTING_MSK) > EYE_DRAM_VREF_SETTING_MAX)
+                {
+                    return false;
+                }
+                break;
+            case WDDR_EYE_VREF_AXIS_PHY:
+                if (vref > EYE_PHY_VREF_MAX)
+                {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+static void wddr_eye_set_vref(wddr_dev_t *wddr,
+                              const wddr_eye_scan_cfg_t *cfg,
+                              wddr_msr_t msr,
+                              uint16_t vref)
+{
+    switch (cfg->vref_axis)
+    {
+        case WDDR_EYE_VREF_AXIS_DRAM:
+            // Also updates MR14 in the table of the current frequency; range
+            // is checked by wddr_eye_vref_valid
+            dram_set_dq_vref(&wddr->dram, &wddr->dfi, (uint8_t) vref);
+            break;
+        case WDDR_EYE_VREF_AXIS_PHY:
+            cmn_vref_set_code_reg_if(wddr->cmn.cmn_reg, msr, vref);
+            break;
+        default:
+            break;
+    }
+}
+
+static void wddr_eye_set_timing(wddr_dev_t *wddr,
+                                const wddr_eye_scan_cfg_t *cfg,
+                                channel_freq_cfg_t *ch_cfg,
+                                wddr_msr_t msr,
+                                uint8_t rank,
+                                uint8_t byte,
+                                uint8_t code)
+{
+    pi_cfg_t pi;
+    lpde_cfg_t lpde;
+    dq_reg_t *dq_reg = wddr->channel[cfg->channel].dq_reg[byte];
+
+    switch (cfg->timing_axis)
+    {
+        case WDDR_EYE_TIMING_AXIS_TX_DQ_PI:
+            pi.val = ch_cfg->dq[byte].tx.rank[rank].dq.pi.ddr.val;
+            pi.code = code;
+            dq_dq_pi_ddr_set_cfg_reg_if(dq_reg, msr, rank, true, pi.val);
+            break;
+        case WDDR_EYE_TIMING_AXIS_TX_DQ_LPDE:
+            for (uint8_t bit = 0; bit < WDDR_PHY_DQ_SLICE_NUM; bit++)
+            {
+                lpde.val = ch_cfg->dq[byte].tx.rank[rank].dq.lpde[bit].val;
+                lpde.delay = code;
+                dq_dq_lpde_set_cfg_reg_if(dq_reg, msr, rank, bit, true, lpde.val);
+            }
+            break;
+        case WDDR_EYE_TIMING_AXIS_RX_RDQS_PI:
+            pi.val = ch_cfg->dq[byte].rx.rank[rank].dqs.pi.rdqs.val;
+            pi.code = code;
+            dq_dqs_pi_rdqs_set_cfg_reg_if(dq_reg, msr, rank, true, pi.val);
+            break;
+        default:
+            break;
+    }
+}
+
+static void wddr_eye_restore_timing(wddr_dev_t *wddr,
+                                    const wddr_eye_scan_cfg_t *cfg,
+                                    channel_freq_cfg_t *ch_cfg,
+                                    wddr_msr_t msr,
+                                    uint8_t rank,
+                                    uint8_t byte)
+{
+    dq_reg_t *dq_reg = wddr->channel[cfg->channel].dq_reg[byte];
+
+    switch (cfg->timing_axis)
+    {
+        case WDDR_EYE_TIMING_AXIS_TX_DQ_PI:
+            dq_dq_pi_ddr_set_cfg_reg_if(dq_reg, msr, rank, true,
+                                        ch_cfg->dq[byte].tx.rank[rank].dq.pi.ddr.val);
+            break;
+        case WDDR_EYE_TIMING_AXIS_TX_DQ_LPDE:
+            for (uint8_t bit = 0; bit < WDDR_PHY_DQ_SLICE_NUM; bit++)
+            {
+                dq_dq_lpde_set_cfg_reg_if(dq_reg, msr, rank, bit, true,
+                                          ch_cfg->dq[byte].tx.rank[rank].dq.lpde[bit].val);
+            }
+            break;
+        case WDDR_EYE_TIMING_AXIS_RX_RDQS_PI:
+            dq_dqs_pi_rdqs_set_cfg_reg_if(dq_reg, msr, rank, true,
+                                          ch_cfg->dq[byte].rx.rank[rank].dqs.pi.rdqs.val);
+            break;
+        default:
+            break;
+    }
+}
+
+static void wddr_eye_save_timing(const wddr_eye_scan_cfg_t *cfg,
+                                 channel_freq_cfg_t *ch_cfg,
+                                 uint8_t rank,
+                                 uint8_t byte,
+                                 uint8_t code)
+{
+    switch (cfg->timing_axis)
+    {
+        case WDDR_EYE_TIMING_AXIS_TX_DQ_PI:
+            ch_cfg->dq[byte].tx.rank[rank].dq.pi.ddr.code = code;
+            break;
+        case WDDR_EYE_TIMING_AXIS_TX_DQ_LPDE:
+            for (uint8_t bit = 0; bit < WDDR_PHY_DQ_SLICE_NUM; bit++)
+            {
+                ch_cfg->dq[byte].tx.rank[rank].dq.lpde[bit].delay = code;
+            }
+            break;
+        case WDDR_EYE_TIMING_AXIS_RX_RDQS_PI:
+            ch_cfg->dq[byte].rx.rank[rank].dqs.pi.rdqs.code = code;
+            break;
+        default:
+            break;
+    }
+}
+
+static uint8_t wddr_eye_widest_run(const uint32_t row[WDDR_EYE_ROW_WORD_NUM],
+                                   uint8_t *center)
+{
+    uint8_t start = 0, run = 0;
+    uint8_t best_start = 0, best_run = 0;
+
+    for (uint8_t code = 0; code < WDDR_EYE_TIMING_CODE_NUM; code++)
+    {
+        if (row[EYE_WORD_INDEX(code)] & (1UL << EYE_BIT_INDEX(code)))
+        {
+            if (run++ == 0)
+            {
+                start = code;
+            }
+
+            if (run > best_run)
+            {
+                best_run = run;
+                best_start = start;
+            }
+        }
+        else
+        {
+            run = 0;
+        }
+    }
+
+    *center = best_start + best_run / 2;
+    return best_run;
+}
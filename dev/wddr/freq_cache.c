@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include <FreeRTOS.h>
+
+/* LPDDR includes. */
+#include <wddr/freq_cache.h>
+#include <wddr/table_pack.h>
+#include <pll/device.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+// Operating points at and above this index live in the pool
+#define FREQ_CACHE_OP_UPLOAD_START  (WDDR_PHY_FREQ_NUM)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+/**
+ * @brief   Frequency Cache Operating Point Structure
+ *
+ * delta    pointer to delta entries against the packed baseline; NULL if
+ *          operating point isn't valid.
+ * num      number of delta entries.
+ */
+typedef struct wddr_freq_cache_op_t
+{
+    const wddr_table_entry_t    *delta;
+    uint16_t                    num;
+} wddr_freq_cache_op_t;
+
+static struct
+{
+    wddr_freq_cache_op_t    op[WDDR_FREQ_CACHE_OP_NUM];     // Operating point store
+    wddr_table_entry_t      pool[WDDR_FREQ_CACHE_POOL_NUM]; // Uploaded delta entries
+    uint16_t                pool_used;                      // Pool entries in use
+    uint8_t                 freq_op[WDDR_PHY_FREQ_NUM];     // Operating point of each table frequency
+    uint32_t                freq_used[WDDR_PHY_FREQ_NUM];   // LRU stamp of each table frequency
+    uint32_t                clock;                          // Last LRU stamp
+} cache;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to get table frequency in use by the PLL */
+static uint8_t wddr_freq_cache_current(wddr_dev_t *wddr);
+
+/** @brief  Internal Function to remove an uploaded operating point from the pool */
+static void wddr_freq_cache_remove(uint8_t op_id);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void wddr_freq_cache_init(void)
+{
+    memset(&cache, 0, sizeof(cache));
+
+    for (uint8_t freq_id = 0; freq_id < WDDR_PHY_FREQ_NUM; freq_id++)
+    {
+        cache.freq_op[freq_id] = WDDR_FREQ_CACHE_OP_NONE;
+        if (wddr_table_get_packed_delta(freq_id,
+                                        &cache.op[freq_id].delta,
+                                        &cache.op[freq_id].num))
+        {
+            cache.freq_op[freq_id] = freq_id;
+        }
+    }
+}
+
+wddr_return_t wddr_freq_cache_get(wddr_dev_t *wddr,
+                                  uint8_t op_id,
+                                  uint8_t *freq_id,
+                                  bool *hit)
+{
+    uint8_t current;
+    uint8_t victim = WDDR_FREQ_CACHE_OP_NONE;
+    wddr_table_t *table = wddr->table;
+
+    if (op_id >= WDDR_FREQ_CACHE_OP_NUM || cache.op[op_id].delta == NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    for (uint8_t ii = 0; ii < WDDR_PHY_FREQ_NUM; ii++)
+    {
+        if (cache.freq_op[ii] == op_id)
+        {
+            cache.freq_used[ii] = ++cache.clock;
+            *freq_id = ii;
+            *hit = true;
+            return WDDR_SUCCESS;
+        }
+    }
+
+    // Refill least recently used frequency; current frequency is in use
+    current = wddr_freq_cache_current(wddr);
+    for (uint8_t ii = 0; ii < WDDR_PHY_FREQ_NUM; ii++)
+    {
+        if (ii != current &&
+            (victim == WDDR_FREQ_CACHE_OP_NONE || cache.freq_used[ii] < cache.freq_used[victim]))
+        {
+            victim = ii;
+        }
+    }
+    configASSERT(victim != WDDR_FREQ_CACHE_OP_NONE);
+
+    wddr_table_unpack_freq(table, victim, cache.op[op_id].delta, cache.op[op_id].num);
+    table->valid[victim] = FREQ_VALID;
+    table->vco_cal[victim] = 0;
+    wddr_invalidate_training(wddr, victim);
+
+    cache.freq_op[victim] = op_id;
+    cache.freq_used[victim] = ++cache.clock;
+    *freq_id = victim;
+    *hit = false;
+    return WDDR_SUCCESS;
+}
+
+wddr_return_t wddr_freq_cache_store(wddr_dev_t *wddr,
+                                    uint8_t op_id,
+                                    const wddr_table_entry_t *delta,
+                                    uint16_t num)
+{
+    uint8_t current;
+    uint16_t free_num;
+
+    if (op_id < FREQ_CACHE_OP_UPLOAD_START || op_id >= WDDR_FREQ_CACHE_OP_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    for (uint16_t ii = 0; ii < num; ii++)
+    {
+        if (!wddr_table_entry_is_valid(&delta[ii]))
+        {
+            return WDDR_ERROR;
+        }
+    }
+
+    // Current frequency must keep matching its operating point
+    current = wddr_freq_cache_current(wddr);
+    if (current < WDDR_PHY_FREQ_NUM && cache.freq_op[current] == op_id)
+    {
+        return WDDR_ERROR;
+    }
+
+    // Previous version is only dropped once the new one is known to fit
+    free_num = WDDR_FREQ_CACHE_POOL_NUM - cache.pool_used + cache.op[op_id].num;
+    if (num > free_num)
+    {
+        return WDDR_ERROR;
+    }
+
+    wddr_freq_cache_remove(op_id);
+    memcpy(&cache.pool[cache.pool_used], delta, num * sizeof(wddr_table_entry_t));
+    cache.op[op_id].delta = &cache.pool[cache.pool_used];
+    cache.op[op_id].num = num;
+    cache.pool_used += num;
+    return WDDR_SUCCESS;
+}
+
+static uint8_t wddr_freq_cache_current(wddr_dev_t *wddr)
+{
+    uint8_t freq_id = UNDEFINED_FREQ_ID;
+
+    if (!wddr->is_booted)
+    {
+        return freq_id;
+    }
+
+    // Unpark relocks the parked PHY VCO from its table frequency
+    if (wddr->pll.p_vco_parked != NULL)
+    {
+        return wddr->pll.p_vco_parked->freq_id;
+    }
+
+    pll_get_current_freq(&wddr->pll, &freq_id);
+    return freq_id;
+}
+
+static void wddr_freq_cache_remove(uint8_t op_id)
+{
+    wddr_freq_cache_op_t *op = &cache.op[op_id];
+    uint16_t start;
+
+    // Table frequency holding previous version becomes first to be refilled
+    for (uint8_t ii = 0; ii < WDDR_PHY_FREQ_NUM; ii++)
+    {
+        if (cache.freq_op[ii] == op_id)
+        {
+            cache.freq_op[ii] = WDDR_FREQ_CACHE_OP_NONE;
+            cache.freq_used[ii] = 0;
+        }
+    }
+
+    if (op->delta == NULL)
+    {
+        return;
+    }
+
+    // Compact pool; operating points stored after this one move down
+    start = op->delta - cache.pool;
+    memmove(&cache.pool[start],
+            &cache.pool[start + op->num],
+            (cache.pool_used - start - op->num) * sizeof(wddr_table_entry_t));
+
+    for (uint8_t ii = FREQ_CACHE_OP_UPLOAD_START; ii < WDDR_FREQ_CACHE_OP_NUM; ii++)
+    {
+        if (cache.op[ii].delta != NULL && cache.op[ii].delta > op->delta)
+        {
+            cache.op[ii].delta -= op->num;
+        }
+    }
+
+    cache.pool_used -= op->num;
+    op->delta = NULL;
+    op->num = 0;
+}
@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include <compiler.h>
+#include <kernel/io.h>
+
+/* LPDDR includes. */
+#include <wddr/lp.h>
+#include <wddr/driver.h>
+#include <wddr/memory_map.h>
+#include <wddr/poll.h>
+#include <dram/device.h>
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static wddr_lp_state_t lp_state = {0};
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to gate / ungate PHY clocks */
+static void wddr_lp_set_clk_gate(wddr_dev_t *wddr, bool gate);
+
+/** @brief  Internal Function to turn VREF and DQS receivers off / on */
+static void wddr_lp_set_analog_off(wddr_dev_t *wddr, bool off);
+
+/** @brief  Internal Function to enter / exit DRAM Power Down */
+static void wddr_lp_set_dram_pd(wddr_dev_t *wddr, bool pd);
+
+/** @brief  Internal Function to enter / exit Self-Refresh deep sleep */
+static wddr_return_t wddr_lp_set_deep_sleep(wddr_dev_t *wddr, bool sleep);
+
+/**
+ * @brief   WDDR LP PLL Switch
+ *
+ * @details Internal Function to switch PLL to the prepared VCO without
+ *          changing MSR. MSR / VCO override stays set while parked so that
+ *          hardware doesn't select a PHY VCO.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   park    flag to indicate if switching to the MCU VCO.
+ *
+ * @return      returns whether PLL became ready.
+ * @retval      WDDR_SUCCESS if ready.
+ * @retval      WDDR_ERROR if no VCO is prepared.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT otherwise.
+ */
+static wddr_return_t wddr_lp_pll_switch(wddr_dev_t *wddr, bool park);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+wddr_return_t wddr_lp_request(wddr_dev_t *wddr,
+                              dfi_lp_if_t intf,
+                              bool req,
+                              uint8_t wakeup,
+                              uint8_t allow)
+{
+    bool clk_gate, analog_off, dram_pd, deep_sleep;
+    bool ctrl, data;
+    uint8_t min_wakeup;
+    wddr_return_t ret;
+
+    if (intf >= DFI_LP_IF_NUM)
+    {
+        return WDDR_ERROR;
+    }
+
+    lp_state.active[intf] = req;
+    lp_state.wakeup[intf] = wakeup;
+
+    ctrl = lp_state.active[DFI_LP_IF_CTRL];
+    data = lp_state.active[DFI_LP_IF_DATA];
+    min_wakeup = lp_state.wakeup[DFI_LP_IF_CTRL] < lp_state.wakeup[DFI_LP_IF_DATA] ?
+                 lp_state.wakeup[DFI_LP_IF_CTRL] : lp_state.wakeup[DFI_LP_IF_DATA];
+
+    // Target levels; deep sleep implies all but DRAM Power Down
+    deep_sleep = (allow & WDDR_LP_ALLOW_DEEP_SLEEP) && ctrl && data &&
+                 min_wakeup >= WDDR_LP_WAKEUP_DEEP_SLEEP;
+    dram_pd = !deep_sleep && (allow & WDDR_LP_ALLOW_DRAM_PD) && ctrl &&
+              lp_state.wakeup[DFI_LP_IF_CTRL] >= WDDR_LP_WAKEUP_DRAM_PD;
+    analog_off = deep_sleep ||
+                 (data && lp_state.wakeup[DFI_LP_IF_DATA] >= WDDR_LP_WAKEUP_ANALOG);
+    clk_gate = deep_sleep || (ctrl && data && min_wakeup >= WDDR_LP_WAKEUP_CLK_GATE);
+
+    // Exit in reverse order: PLL and clocks must run before anything else
+    if (lp_state.deep_sleep && !deep_sleep)
+    {
+        PROPAGATE_ERROR(wddr_lp_set_deep_sleep(wddr, false));
+    }
+
+    if (lp_state.clk_gated && !clk_gate)
+    {
+        wddr_lp_set_clk_gate(wddr, false);
+    }
+
+    if (lp_state.analog_off && !analog_off)
+    {
+        wddr_lp_set_analog_off(wddr, false);
+    }
+
+    // DRAM Power Down entry / exit requires running clocks; regated below
+    if (lp_state.dram_pd != dram_pd)
+    {
+        if (lp_state.clk_gated)
+        {
+            wddr_lp_set_clk_gate(wddr, false);
+        }
+        wddr_lp_set_dram_pd(wddr, dram_pd);
+    }
+
+    if (!lp_state.analog_off && analog_off)
+    {
+        wddr_lp_set_analog_off(wddr, true);
+    }
+
+    if (!lp_state.clk_gated && clk_gate)
+    {
+        wddr_lp_set_clk_gate(wddr, true);
+    }
+
+    if (!lp_state.deep_sleep && deep_sleep)
+    {
+        ret = wddr_lp_set_deep_sleep(wddr, true);
+        if (ret != WDDR_SUCCESS)
+        {
+            // Drop request; back to the levels without it
+            wddr_lp_request(wddr, intf, false, wakeup, allow & ~WDDR_LP_ALLOW_DEEP_SLEEP);
+            return ret;
+        }
+    }
+
+    return WDDR_SUCCESS;
+}
+
+const wddr_lp_state_t *wddr_lp_get_state(void)
+{
+    return &lp_state;
+}
+
+uint8_t wddr_lp_get_levels(void)
+{
+    uint8_t levels = 0;
+
+    levels |= lp_state.clk_gated ? WDDR_LP_LEVEL_CLK_GATE : 0;
+    levels |= lp_state.analog_off ? WDDR_LP_LEVEL_ANALOG : 0;
+    levels |= lp_state.dram_pd ? WDDR_LP_LEVEL_DRAM_PD : 0;
+    levels |= lp_state.deep_sleep ? WDDR_LP_LEVEL_DEEP_SLEEP : 0;
+    return levels;
+}
+
+static void wddr_lp_set_clk_gate(wddr_dev_t *wddr, bool gate)
+{
+    dfi_clken_pext_cfg_t cfg = {.val = 0};
+    wddr_msr_t msr = fsw_get_current_msr(&wddr->fsw);
+    uint8_t freq_id;
+
+    if (gate)
+    {
+        // Drop pulse extensions so clocks stop right away
+        dfi_set_clken_pext_cfg_reg_if(wddr->dfi.dfich_reg, msr, &cfg);
+        fsw_csp_set_clk_disable_over_val_reg_if(wddr->fsw.fsw_reg, true);
+        lp_state.clk_gate_count++;
+    }
+    else
+    {
+        pll_get_current_freq(&wddr->pll, &freq_id);
+        fsw_csp_set_clk_disable_over_val_reg_if(wddr->fsw.fsw_reg, false);
+
+        // Pulse extensions are restored once PLL runs from a PHY VCO again
+        if (freq_id < WDDR_PHY_FREQ_NUM)
+        {
+            dfi_set_clken_pext_cfg_reg_if(wddr->dfi.dfich_reg,
+                                          msr,
+                                          &wddr->table->cfg.freq[freq_id].dfi.clken_pext);
+        }
+    }
+
+    lp_state.clk_gated = gate;
+}
+
+static void wddr_lp_set_analog_off(wddr_dev_t *wddr, bool off)
+{
+    wddr_msr_t msr = fsw_get_current_msr(&wddr->fsw);
+    receiver_state_t state = off ? REC_STATE_DISABLE : REC_STATE_ENABLE;
+
+    // VREF comes up first so receivers see a settled reference
+    if (!off)
+    {
+        cmn_vref_set_mode_enable(&wddr->cmn, msr);
+    }
+
+    for (uint8_t channel = 0; channel < WDDR_PHY_CHANNEL_NUM; channel++)
+    {
+        for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+        {
+            for (uint8_t rank = 0; rank < WDDR_PHY_RANK; rank++)
+            {
+                dq_dqs_receiver_set_state_reg_if(wddr->channel[channel].dq_reg[byte],
+                                                 msr,
+                                                 rank,
+                                                 state);
+            }
+        }
+    }
+
+    if (off)
+    {
+        cmn_vref_set_mode_disable(&wddr->cmn, msr);
+        lp_state.analog_count++;
+    }
+
+    lp_state.analog_off = off;
+}
+
+static void wddr_lp_set_dram_pd(wddr_dev_t *wddr, bool pd)
+{
+    if (pd)
+    {
+        dram_power_down(&wddr->dram, &wddr->dfi);
+        lp_state.dram_pd_count++;
+    }
+    else
+    {
+        dram_idle(&wddr->dram, &wddr->dfi);
+    }
+
+    lp_state.dram_pd = pd;
+}
+
+static wddr_return_t wddr_lp_set_deep_sleep(wddr_dev_t *wddr, bool sleep)
+{
+    uint8_t freq_id;
+    wddr_return_t ret = WDDR_SUCCESS;
+
+    if (sleep)
+    {
+        // Self-Refresh entry needs running clocks; analog is already off
+        wddr_lp_set_clk_gate(wddr, false);
+        dram_self_refresh_enter(&wddr->dram, &wddr->dfi);
+        wddr_lp_set_clk_gate(wddr, true);
+
+        // Park PLL on MCU VCO and turn PHY VCO off
+        pll_prepare_vco_park(&wddr->pll);
+        if (wddr->pll.p_vco_parked != NULL)
+        {
+            ret = wddr_lp_pll_switch(wddr, true);
+        }
+
+        if (ret != WDDR_SUCCESS)
+        {
+            // PHY VCO wasn't disabled; go back to it and leave Self-Refresh
+            PROPAGATE_ERROR(pll_abort_vco_park(&wddr->pll));
+            PROPAGATE_ERROR(wddr_lp_pll_switch(wddr, false));
+            wddr_lp_set_clk_gate(wddr, false);
+            dram_self_refresh_exit(&wddr->dram, &wddr->dfi);
+            return ret;
+        }
+        lp_state.deep_sleep_count++;
+    }
+    else
+    {
+        // Relock parked PHY VCO with retained configuration
+        if (wddr->pll.p_vco_parked != NULL)
+        {
+            freq_id = wddr->pll.p_vco_parked->freq_id;
+            if (freq_id >= WDDR_PHY_FREQ_NUM)
+            {
+                return WDDR_ERROR;
+            }
+
+            PROPAGATE_ERROR(pll_prepare_vco_unpark(&wddr->pll, &wddr->table->cfg.freq[freq_id].pll));
+            PROPAGATE_ERROR(wddr_lp_pll_switch(wddr, false));
+        }
+
+        // Self-Refresh exit; clocks are regated by caller if needed
+        wddr_lp_set_clk_gate(wddr, false);
+        dram_self_refresh_exit(&wddr->dram, &wddr->dfi);
+    }
+
+    lp_state.deep_sleep = sleep;
+    return WDDR_SUCCESS;
+}
+
+static wddr_return_t wddr_lp_pll_switch(wddr_dev_t *wddr, bool park)
+{
+    uint8_t next_vco;
+    pll_dev_t *pll = &wddr->pll;
+
+    if (pll->p_vco_next == NULL)
+    {
+        return WDDR_ERROR;
+    }
+
+    // Keep current MSR; only VCO changes
+    fsw_ctrl_set_msr_toggle_en_reg_if(wddr->fsw.fsw_reg, false);
+    fsw_ctrl_set_vco_toggle_en_reg_if(wddr->fsw.fsw_reg, false);
+    pll_get_next_vco(pll, &next_vco);
+    fsw_ctrl_set_msr_vco_ovr_val_reg_if(wddr->fsw.fsw_reg,
+                                        fsw_get_current_msr(&wddr->fsw),
+                                        next_vco);
+    fsw_ctrl_set_msr_vco_ovr_reg_if(wddr->fsw.fsw_reg, true);
+
+    pll_switch_vco(pll, true);
+
+    // Block until PLL is ready
+    if (!wddr_poll_reg(WDDR_POLL_SITE_LP_CORE_READY,
+                       (volatile uint32_t *) (uintptr_t) (pll->base + DDR_MVP_PLL_CORE_STATUS__ADR),
+                       DDR_MVP_PLL_CORE_STATUS_CORE_READY__MSK,
+                       DDR_MVP_PLL_CORE_STATUS_CORE_READY__MSK,
+                       NULL))
+    {
+        return WDDR_ERROR_POLL_TIMEOUT;
+    }
+
+    // Hand MSR / VCO back to hardware once PHY VCO is back
+    if (!park)
+    {
+        fsw_ctrl_set_msr_vco_ovr_reg_if(wddr->fsw.fsw_reg, false);
+        fsw_ctrl_set_msr_toggle_en_reg_if(wddr->fsw.fsw_reg, true);
+        fsw_ctrl_set_vco_toggle_en_reg_if(wddr->fsw.fsw_reg, true);
+    }
+
+    // Disable previous VCO
+    pll_disable_vco(pll);
+    return WDDR_SUCCESS;
+}
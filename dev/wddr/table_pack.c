@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include <FreeRTOS.h>
+
+/* LPDDR includes. */
+#include <wddr/table_pack.h>
+#include <wddr/table_pack_vals.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define PACK_REP_NUM        (sizeof(pack_rep) / sizeof(pack_rep[0]))
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static const uint8_t pack_valid[WDDR_PHY_FREQ_NUM] = WDDR_TABLE_PACK_VALID;
+static const wddr_table_rep_t pack_rep[] = WDDR_TABLE_PACK_REP;
+static const wddr_table_entry_t pack_common[] = WDDR_TABLE_PACK_COMMON;
+static const wddr_table_entry_t pack_base[] = WDDR_TABLE_PACK_BASE;
+static const wddr_table_entry_t pack_delta[] = WDDR_TABLE_PACK_DELTA;
+static const wddr_table_delta_t pack_delta_index[WDDR_PHY_FREQ_NUM] = WDDR_TABLE_PACK_DELTA_INDEX;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to apply packed entries to a configuration */
+static void wddr_table_apply(wddr_table_t *table,
+                             uint8_t *cfg,
+                             const wddr_table_entry_t *entries,
+                             uint16_t num);
+
+/** @brief  Internal Function to write a single field of a configuration */
+static void wddr_table_write(wddr_table_t *table,
+                             uint8_t *field,
+                             const wddr_table_entry_t *entry);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void wddr_table_unpack(wddr_table_t *table)
+{
+    const wddr_table_delta_t *delta;
+
+    wddr_table_apply(table, (uint8_t *) &table->cfg.common,
+                     pack_common, sizeof(pack_common) / sizeof(pack_common[0]));
+
+    for (uint8_t freq_id = 0; freq_id < WDDR_PHY_FREQ_NUM; freq_id++)
+    {
+        delta = &pack_delta_index[freq_id];
+        table->valid[freq_id] = pack_valid[freq_id];
+        wddr_table_unpack_freq(table, freq_id, &pack_delta[delta->start], delta->num);
+    }
+}
+
+void wddr_table_unpack_freq(wddr_table_t *table,
+                            uint8_t freq_id,
+                            const wddr_table_entry_t *delta,
+                            uint16_t num)
+{
+    uint8_t *cfg = (uint8_t *) &table->cfg.freq[freq_id];
+
+    memset(cfg, 0, sizeof(wddr_freq_cfg_t));
+    wddr_table_apply(table, cfg, pack_base, sizeof(pack_base) / sizeof(pack_base[0]));
+    wddr_table_apply(table, cfg, delta, num);
+}
+
+bool wddr_table_get_packed_delta(uint8_t freq_id,
+                                 const wddr_table_entry_t **delta,
+                                 uint16_t *num)
+{
+    if (freq_id >= WDDR_PHY_FREQ_NUM || !pack_valid[freq_id])
+    {
+        return false;
+    }
+
+    *delta = &pack_delta[pack_delta_index[freq_id].start];
+    *num = pack_delta_index[freq_id].num;
+    return true;
+}
+
+bool wddr_table_entry_is_valid(const wddr_table_entry_t *entry)
+{
+    const wddr_table_rep_t *rep;
+    uint32_t size;
+    uint32_t end;
+
+    if (entry->rep >= PACK_REP_NUM)
+    {
+        return false;
+    }
+
+    switch (entry->type)
+    {
+        case WDDR_TABLE_ENTRY_TYPE_PTR:
+            if (entry->value >= sizeof(wddr_table_t))
+            {
+                return false;
+            }
+            size = sizeof(uint8_t *);
+            break;
+        case sizeof(uint8_t):
+        case sizeof(uint16_t):
+        case sizeof(uint32_t):
+            size = entry->type;
+            break;
+        default:
+            return false;
+    }
+
+    // Field must be aligned and last replica within frequency configuration
+    rep = &pack_rep[entry->rep];
+    end = entry->offset + size;
+    for (uint8_t dim = 0; dim < WDDR_TABLE_REP_DIM_NUM; dim++)
+    {
+        end += (rep->num[dim] - 1) * rep->stride[dim];
+    }
+
+    return (entry->offset % size) == 0 && end <= sizeof(wddr_freq_cfg_t);
+}
+
+static void wddr_table_apply(wddr_table_t *table,
+                             uint8_t *cfg,
+                             const wddr_table_entry_t *entries,
+                             uint16_t num)
+{
+    const wddr_table_entry_t *entry;
+    const wddr_table_rep_t *rep;
+    uint8_t *field;
+
+    for (uint16_t ii = 0; ii < num; ii++)
+    {
+        entry = &entries[ii];
+        configASSERT(entry->rep < PACK_REP_NUM);
+        rep = &pack_rep[entry->rep];
+
+        for (uint8_t ch = 0; ch < rep->num[WDDR_TABLE_REP_DIM_CHANNEL]; ch++)
+        {
+            for (uint8_t byte = 0; byte < rep->num[WDDR_TABLE_REP_DIM_BYTE]; byte++)
+            {
+                for (uint8_t rank = 0; rank < rep->num[WDDR_TABLE_REP_DIM_RANK]; rank++)
+                {
+                    field = cfg + entry->offset +
+                            ch * rep->stride[WDDR_TABLE_REP_DIM_CHANNEL] +
+                            byte * rep->stride[WDDR_TABLE_REP_DIM_BYTE] +
+                            rank * rep->stride[WDDR_TABLE_REP_DIM_RANK];
+                    wddr_table_write(table, field, entry);
+                }
+            }
+        }
+    }
+}
+
+static void wddr_table_write(wddr_table_t *table,
+                             uint8_t *field,
+                             const wddr_table_entry_t *entry)
+{
+    switch (entry->type)
+    {
+        case WDDR_TABLE_ENTRY_TYPE_PTR:
+            *((uint8_t **) field) = (uint8_t *) table + entry->value;
+            break;
+        case sizeof(uint8_t):
+            *field = (uint8_t) entry->value;
+            break;
+        case sizeof(uint16_t):
+            *((uint16_t *) field) = (uint16_t) entry->value;
+            break;
+        case sizeof(uint32_t):
+            *((uint32_t *) field) = entry->value;
+            break;
+        default:
+            configASSERT(0);
+            break;
+    }
+}
@@ -10,7 +10,7 @@
 *******************************************************************************/
 void ca_dq_bscan_get_status_reg_if(ca_reg_t *ca_reg, uint8_t *status)
 {
-    *status = ca_reg->DDR_CA_DQ_RX_BSCAN_STA;
+    *status = CSR_READ_STA(ca_reg->DDR_CA_DQ_RX_BSCAN_STA);
 }
 
 /*******************************************************************************
@@ -18,5 +18,5 @@ void ca_dq_bscan_get_status_reg_if(ca_reg_t *ca_reg, uint8_t *status)
 *******************************************************************************/
 void ca_dqs_bscan_get_status_reg_if(ca_reg_t *ca_reg, uint8_t *status)
 {
-    *status = ca_reg->DDR_CA_DQS_RX_BSCAN_STA;
+    *status = CSR_READ_STA(ca_reg->DDR_CA_DQS_RX_BSCAN_STA);
 }
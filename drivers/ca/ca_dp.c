@@ -15,7 +15,7 @@ void ca_dq_rt_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                  wddr_rank_t rank,
                                  uint32_t pipe_en)
 {
-    ca_reg->DDR_CA_DQ_TX_RT_CFG[msr][rank] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_RT_CFG[msr][rank], pipe_en);
 }
 
 void ca_dq_sdr_set_fc_delay_reg_if(ca_reg_t *ca_reg,
@@ -25,7 +25,7 @@ void ca_dq_sdr_set_fc_delay_reg_if(ca_reg_t *ca_reg,
                                    uint32_t fc_delay)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_SDR_FC_DLY_CFG[msr][rank][bit] = fc_delay;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_SDR_FC_DLY_CFG[msr][rank][bit], fc_delay);
 }
 
 void ca_dq_sdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
@@ -35,7 +35,7 @@ void ca_dq_sdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                   uint32_t pipe_en)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_SDR_CFG[msr][rank][bit] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_SDR_CFG[msr][rank][bit], pipe_en);
 }
 
 void ca_dq_sdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
@@ -45,7 +45,7 @@ void ca_dq_sdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
                                 uint32_t x_sel)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_SDR_X_SEL_CFG[msr][rank][bit] = x_sel;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_SDR_X_SEL_CFG[msr][rank][bit], x_sel);
 }
 
 void ca_dq_ddr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
@@ -55,7 +55,7 @@ void ca_dq_ddr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                   uint32_t pipe_en)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_DDR_CFG[msr][rank][bit] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_DDR_CFG[msr][rank][bit], pipe_en);
 }
 
 void ca_dq_ddr_set_x_sel_reg_if(ca_reg_t *ca_reg,
@@ -65,7 +65,7 @@ void ca_dq_ddr_set_x_sel_reg_if(ca_reg_t *ca_reg,
                                 uint32_t x_sel)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_DDR_X_SEL_CFG[msr][rank][bit] = x_sel;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_DDR_X_SEL_CFG[msr][rank][bit], x_sel);
 }
 
 void ca_dq_qdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
@@ -75,7 +75,7 @@ void ca_dq_qdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                   uint32_t pipe_en)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_QDR_CFG[msr][rank][bit] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_QDR_CFG[msr][rank][bit], pipe_en);
 }
 
 void ca_dq_qdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
@@ -85,7 +85,7 @@ void ca_dq_qdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
                                 uint32_t x_sel)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_QDR_X_SEL_CFG[msr][rank][bit] = x_sel;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_QDR_X_SEL_CFG[msr][rank][bit], x_sel);
 }
 
 /*******************************************************************************
@@ -96,7 +96,7 @@ void ca_dqs_rt_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                   wddr_rank_t rank,
                                   uint32_t pipe_en)
 {
-    ca_reg->DDR_CA_DQS_TX_RT_CFG[msr][rank] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_RT_CFG[msr][rank], pipe_en);
 }
 
 void ca_dqs_sdr_set_fc_delay_reg_if(ca_reg_t *ca_reg,
@@ -106,7 +106,7 @@ void ca_dqs_sdr_set_fc_delay_reg_if(ca_reg_t *ca_reg,
                                     uint32_t fc_delay)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_SDR_FC_DLY_CFG[msr][rank][bit] = fc_delay;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_FC_DLY_CFG[msr][rank][bit], fc_delay);
 }
 
 void ca_dqs_sdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
@@ -116,7 +116,7 @@ void ca_dqs_sdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                    uint32_t pipe_en)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_SDR_CFG[msr][rank][bit] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_CFG[msr][rank][bit], pipe_en);
 }
 
 void ca_dqs_sdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
@@ -126,7 +126,7 @@ void ca_dqs_sdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
                                  uint32_t x_sel)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_SDR_X_SEL_CFG[msr][rank][bit] = x_sel;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_SDR_X_SEL_CFG[msr][rank][bit], x_sel);
 }
 
 void ca_dqs_ddr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
@@ -136,7 +136,7 @@ void ca_dqs_ddr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                    uint32_t pipe_en)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_DDR_CFG[msr][rank][bit] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_DDR_CFG[msr][rank][bit], pipe_en);
 }
 
 void ca_dqs_ddr_set_x_sel_reg_if(ca_reg_t *ca_reg,
@@ -146,7 +146,7 @@ void ca_dqs_ddr_set_x_sel_reg_if(ca_reg_t *ca_reg,
                                  uint32_t x_sel)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_DDR_X_SEL_CFG[msr][rank][bit] = x_sel;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_DDR_X_SEL_CFG[msr][rank][bit], x_sel);
 }
 
 void ca_dqs_qdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
@@ -156,7 +156,7 @@ void ca_dqs_qdr_set_pipe_en_reg_if(ca_reg_t *ca_reg,
                                    uint32_t pipe_en)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_QDR_CFG[msr][rank][bit] = pipe_en;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_QDR_CFG[msr][rank][bit], pipe_en);
 }
 
 void ca_dqs_qdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
@@ -166,5 +166,5 @@ void ca_dqs_qdr_set_x_sel_reg_if(ca_reg_t *ca_reg,
                                  uint32_t x_sel)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_QDR_X_SEL_CFG[msr][rank][bit] = x_sel;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_QDR_X_SEL_CFG[msr][rank][bit], x_sel);
 }
@@ -16,7 +16,7 @@ void ca_dq_egress_ana_set_mode_reg_if(ca_reg_t *ca_reg,
                                       egress_ana_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_EGRESS_ANA_CFG[msr][bit] = mode;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_EGRESS_ANA_CFG[msr][bit], mode);
 }
 
 void ca_dq_egress_dig_set_mode_reg_if(ca_reg_t *ca_reg,
@@ -25,7 +25,7 @@ void ca_dq_egress_dig_set_mode_reg_if(ca_reg_t *ca_reg,
                                       egress_dig_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_CA_SLICE_NUM);
-    ca_reg->DDR_CA_DQ_TX_EGRESS_DIG_CFG[msr][bit] = mode;
+    CSR_WRITE(ca_reg->DDR_CA_DQ_TX_EGRESS_DIG_CFG[msr][bit], mode);
 }
 
 /*******************************************************************************
@@ -37,7 +37,7 @@ void ca_dqs_egress_ana_set_mode_reg_if(ca_reg_t *ca_reg,
                                        egress_ana_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_EGRESS_ANA_CFG[msr][bit] = mode;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_EGRESS_ANA_CFG[msr][bit], mode);
 }
 
 void ca_dqs_egress_dig_set_mode_reg_if(ca_reg_t *ca_reg,
@@ -46,6 +46,6 @@ void ca_dqs_egress_dig_set_mode_reg_if(ca_reg_t *ca_reg,
                                        egress_dig_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_CK_SLICE_NUM);
-    ca_reg->DDR_CA_DQS_TX_EGRESS_DIG_CFG[msr][bit] = mode;
+    CSR_WRITE(ca_reg->DDR_CA_DQS_TX_EGRESS_DIG_CFG[msr][bit], mode);
 
 }
@@ -5,6 +5,7 @@
  */
 #include <cmn/driver.h>
 #include <kernel/io.h>
+#include <wddr/poll.h>
 
 void cmn_pmon_set_state_reg_if(cmn_reg_t *cmn_reg, pmon_state_t state)
 {
@@ -12,69 +13,76 @@ void cmn_pmon_set_state_reg_if(cmn_reg_t *cmn_reg, pmon_state_t state)
 
     reg_val = UPDATE_REG_FIELD(0x0, DDR_CMN_PMON_ANA_CFG_NAND_EN, state);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_ANA_CFG_NOR_EN,  state);
-    cmn_reg->DDR_CMN_PMON_ANA_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_PMON_ANA_CFG, reg_val);
 
     if (state == PMON_STATE_ENABLED)
     {
         // reset digital values of PMONs
-        reg_val = cmn_reg->DDR_CMN_PMON_DIG_CFG;
+        reg_val = CSR_READ(cmn_reg->DDR_CMN_PMON_DIG_CFG);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_DIG_CFG_REFCLK_RST, 0x1);
-        cmn_reg->DDR_CMN_PMON_DIG_CFG = reg_val;
+        CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_CFG, reg_val);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_DIG_CFG_REFCLK_RST, 0x0);
-        cmn_reg->DDR_CMN_PMON_DIG_CFG = reg_val;
+        CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_CFG, reg_val);
     }
 
-    reg_val = cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG;
+    reg_val = CSR_READ(cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val,  DDR_CMN_PMON_DIG_NAND_CFG_COUNT_EN, state);
-    cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG, reg_val);
 
-    reg_val = cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG;
+    reg_val = CSR_READ(cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val,  DDR_CMN_PMON_DIG_NOR_CFG_COUNT_EN, state);
-    cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG, reg_val);
 }
 
 void cmn_pmon_configure_reg_if(cmn_reg_t *cmn_reg,
                                uint16_t refcount,
                                uint8_t init_wait)
 {
-    uint32_t reg_val = cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG;
+    uint32_t reg_val = CSR_READ(cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_DIG_NAND_CFG_REFCOUNT, refcount);
-    cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG, reg_val);
 
-    reg_val = cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG;
+    reg_val = CSR_READ(cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_DIG_NOR_CFG_REFCOUNT, refcount);
-    cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG, reg_val);
 
-    reg_val = cmn_reg->DDR_CMN_PMON_DIG_CFG;
+    reg_val = CSR_READ(cmn_reg->DDR_CMN_PMON_DIG_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_DIG_CFG_INITWAIT, init_wait);
-    cmn_reg->DDR_CMN_PMON_DIG_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_PMON_DIG_CFG, reg_val);
 }
 
-static void __cmn_pmon_get_status_count_reg_if(volatile uint32_t *status_addr,
+static bool __cmn_pmon_get_status_count_reg_if(volatile uint32_t *status_addr,
                                                volatile uint32_t *cfg_addr,
                                                uint32_t *count)
 {
     uint32_t reg_val;
     uint32_t refcount;
-    uint8_t done = 0;
 
-    do
+    if (!wddr_poll_reg(WDDR_POLL_SITE_PMON_DONE,
+                       status_addr,
+                       DDR_CMN_PMON_NAND_STA_DONE__MSK,
+                       DDR_CMN_PMON_NAND_STA_DONE__MSK,
+                       &reg_val))
     {
-        reg_val = *status_addr;
-        done = GET_REG_FIELD(reg_val, DDR_CMN_PMON_NAND_STA_DONE);
-    } while (done == 0x0);
+        *count = 0;
+        return false;
+    }
     *count = GET_REG_FIELD(reg_val, DDR_CMN_PMON_NAND_STA_COUNT);
 
-    reg_val = *cfg_addr;
+    reg_val = CSR_READ(*cfg_addr);
     refcount = GET_REG_FIELD(reg_val, DDR_CMN_PMON_DIG_NAND_CFG_REFCOUNT);
     *count = *count / refcount;
+    return true;
 }
 
-void cmn_pmon_get_status_count_reg_if(cmn_reg_t *cmn_reg, uint32_t *count)
+bool cmn_pmon_get_status_count_reg_if(cmn_reg_t *cmn_reg, uint32_t *count)
 {
     uint32_t nand_count;
     uint32_t nor_count;
-    __cmn_pmon_get_status_count_reg_if(&cmn_reg->DDR_CMN_PMON_NAND_STA, &cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG, &nand_count);
-    __cmn_pmon_get_status_count_reg_if(&cmn_reg->DDR_CMN_PMON_NOR_STA, &cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG, &nor_count);
+    bool done;
+
+    done = __cmn_pmon_get_status_count_reg_if(&cmn_reg->DDR_CMN_PMON_NAND_STA, &cmn_reg->DDR_CMN_PMON_DIG_NAND_CFG, &nand_count);
+    done &= __cmn_pmon_get_status_count_reg_if(&cmn_reg->DDR_CMN_PMON_NOR_STA, &cmn_reg->DDR_CMN_PMON_DIG_NOR_CFG, &nor_count);
     *count = (nand_count >> 1) + (nor_count >> 1);
+    return done;
 }
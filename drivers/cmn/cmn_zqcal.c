@@ -8,21 +8,21 @@
 
 void cmn_zqcal_set_state_reg_if(cmn_reg_t *cmn_reg, zqcal_state_t state)
 {
-    uint32_t reg_val = cmn_reg->DDR_CMN_ZQCAL_CFG;
+    uint32_t reg_val = CSR_READ(cmn_reg->DDR_CMN_ZQCAL_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_ZQCAL_CFG_CAL_EN, state);
-    cmn_reg->DDR_CMN_ZQCAL_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_ZQCAL_CFG, reg_val);
 }
 
 void cmn_zqcal_set_mode_reg_if(cmn_reg_t *cmn_reg, zqcal_mode_t mode)
 {
-    uint32_t reg_val = cmn_reg->DDR_CMN_ZQCAL_CFG;
+    uint32_t reg_val = CSR_READ(cmn_reg->DDR_CMN_ZQCAL_CFG);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_ZQCAL_CFG_PD_SEL, mode);
-    cmn_reg->DDR_CMN_ZQCAL_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_ZQCAL_CFG, reg_val);
 }
 
 void cmn_zqcal_set_code_reg_if(cmn_reg_t *cmn_reg, zqcal_mode_t mode, uint8_t code)
 {
-    uint32_t reg_val = cmn_reg->DDR_CMN_ZQCAL_CFG;
+    uint32_t reg_val = CSR_READ(cmn_reg->DDR_CMN_ZQCAL_CFG);
 
     switch(mode)
     {
@@ -36,12 +36,12 @@ void cmn_zqcal_set_code_reg_if(cmn_reg_t *cmn_reg, zqcal_mode_t mode, uint8_t co
             return;
     }
 
-    cmn_reg->DDR_CMN_ZQCAL_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_ZQCAL_CFG, reg_val);
 }
 
 void cmn_zqcal_set_voh_reg_if(cmn_reg_t *cmn_reg, zqcal_voh_t voh)
 {
-    uint32_t reg_val = cmn_reg->DDR_CMN_ZQCAL_CFG;
+    uint32_t reg_val = CSR_READ(cmn_reg->DDR_CMN_ZQCAL_CFG);
     switch(voh)
     {
         case ZQCAL_VOH_0P5:
@@ -54,10 +54,10 @@ void cmn_zqcal_set_voh_reg_if(cmn_reg_t *cmn_reg, zqcal_voh_t voh)
             return;
     }
 
-    cmn_reg->DDR_CMN_ZQCAL_CFG = reg_val;
+    CSR_WRITE(cmn_reg->DDR_CMN_ZQCAL_CFG, reg_val);
 }
 
 void cmn_zqcal_get_output_reg_if(cmn_reg_t *cmn_reg, uint8_t *val)
 {
-    *val = GET_REG_FIELD(cmn_reg->DDR_CMN_ZQCAL_STA, DDR_CMN_ZQCAL_STA_COMP);
+    *val = GET_REG_FIELD(CSR_READ_STA(cmn_reg->DDR_CMN_ZQCAL_STA), DDR_CMN_ZQCAL_STA_COMP);
 }
@@ -10,7 +10,7 @@
 *******************************************************************************/
 void dq_dq_bscan_get_status_reg_if(dq_reg_t *dq_reg, uint8_t *status)
 {
-    *status = dq_reg->DDR_DQ_DQ_RX_BSCAN_STA;
+    *status = CSR_READ_STA(dq_reg->DDR_DQ_DQ_RX_BSCAN_STA);
 }
 
 /*******************************************************************************
@@ -18,5 +18,5 @@ void dq_dq_bscan_get_status_reg_if(dq_reg_t *dq_reg, uint8_t *status)
 *******************************************************************************/
 void dq_dqs_bscan_get_status_reg_if(dq_reg_t *dq_reg, uint8_t *status)
 {
-    *status = dq_reg->DDR_DQ_DQS_RX_BSCAN_STA;
+    *status = CSR_READ_STA(dq_reg->DDR_DQ_DQS_RX_BSCAN_STA);
 }
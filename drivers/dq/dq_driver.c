@@ -17,10 +17,10 @@ void dq_dq_driver_set_impedance_reg_if(dq_reg_t *dq_reg,
                                        driver_impedance_t rx)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M0_CFG_0_TX_IMPD, tx);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M0_CFG_0_RX_IMPD, rx);
-    dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit], reg_val);
 }
 
 void dq_dq_driver_set_oe_reg_if(dq_reg_t *dq_reg,
@@ -29,9 +29,9 @@ void dq_dq_driver_set_oe_reg_if(dq_reg_t *dq_reg,
                                 bool enable)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M0_CFG_0_SW_OVR, enable);
-    dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit], reg_val);
 }
 
 void dq_dq_driver_set_override_reg_if(dq_reg_t *dq_reg,
@@ -41,10 +41,10 @@ void dq_dq_driver_set_override_reg_if(dq_reg_t *dq_reg,
                                       uint8_t val_t)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M0_CFG_0_OVRD_SEL, sel);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_IO_M0_CFG_0_OVRD_VAL, val_t);
-    dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_IO_CFG[msr][bit], reg_val);
 }
 
 /*******************************************************************************
@@ -55,9 +55,9 @@ void dq_dqs_driver_set_mode_reg_if(dq_reg_t *dq_reg,
                                    wddr_rank_t rank,
                                    driver_mode_t mode)
 {
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_CMN_M0_R0_CFG_SE_MODE, mode);
-    dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_driver_set_code_reg_if(dq_reg_t *dq_reg,
@@ -65,10 +65,10 @@ void dq_dqs_driver_set_code_reg_if(dq_reg_t *dq_reg,
                                    wddr_rank_t rank,
                                    uint8_t code[DRVR_PN_CAL_NUM])
 {
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_CMN_M0_R0_CFG_NCAL, code[DRVR_N_CAL]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_CMN_M0_R0_CFG_PCAL, code[DRVR_P_CAL]);
-    dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_driver_set_loopback_mode_reg_if(dq_reg_t *dq_reg,
@@ -76,9 +76,9 @@ void dq_dqs_driver_set_loopback_mode_reg_if(dq_reg_t *dq_reg,
                                             wddr_rank_t rank,
                                             driver_loopback_mode_t mode)
 {
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_CMN_M0_R0_CFG_LPBK_EN, mode);
-    dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CMN_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_driver_set_impedance_reg_if(dq_reg_t *dq_reg,
@@ -88,10 +88,10 @@ void dq_dqs_driver_set_impedance_reg_if(dq_reg_t *dq_reg,
                                         driver_impedance_t rx)
 {
     configASSERT(bit < WDDR_PHY_DQS_TXRX_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M0_CFG_0_TX_IMPD, tx);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M0_CFG_0_RX_IMPD, rx);
-    dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit], reg_val);
 }
 
 void dq_dqs_driver_set_oe_reg_if(dq_reg_t *dq_reg,
@@ -100,9 +100,9 @@ void dq_dqs_driver_set_oe_reg_if(dq_reg_t *dq_reg,
                                  bool enable)
 {
     configASSERT(bit < WDDR_PHY_DQS_TXRX_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M0_CFG_0_SW_OVR, enable);
-    dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit], reg_val);
 }
 
 void dq_dqs_driver_set_override_reg_if(dq_reg_t *dq_reg,
@@ -113,9 +113,9 @@ void dq_dqs_driver_set_override_reg_if(dq_reg_t *dq_reg,
                                        uint8_t val_c)
 {
     configASSERT(bit < WDDR_PHY_DQS_TXRX_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit]);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M0_CFG_0_OVRD_SEL, sel);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M0_CFG_0_OVRD_VAL_T, val_t);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_IO_M0_CFG_0_OVRD_VAL_C, val_c);
-    dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_IO_CFG[msr][bit], reg_val);
 }
@@ -16,7 +16,7 @@ void dq_dq_egress_ana_set_mode_reg_if(dq_reg_t *dq_reg,
                                       egress_ana_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    dq_reg->DDR_DQ_DQ_TX_EGRESS_ANA_CFG[msr][bit] = mode;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_EGRESS_ANA_CFG[msr][bit], mode);
 }
 
 void dq_dq_egress_dig_set_mode_reg_if(dq_reg_t *dq_reg,
@@ -25,7 +25,7 @@ void dq_dq_egress_dig_set_mode_reg_if(dq_reg_t *dq_reg,
                                       egress_dig_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    dq_reg->DDR_DQ_DQ_TX_EGRESS_DIG_CFG[msr][bit] = mode;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_EGRESS_DIG_CFG[msr][bit], mode);
 }
 
 /*******************************************************************************
@@ -37,7 +37,7 @@ void dq_dqs_egress_ana_set_mode_reg_if(dq_reg_t *dq_reg,
                                        egress_ana_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_DQS_SLICE_NUM);
-    dq_reg->DDR_DQ_DQS_TX_EGRESS_ANA_CFG[msr][bit] = mode;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_EGRESS_ANA_CFG[msr][bit], mode);
 }
 
 void dq_dqs_egress_dig_set_mode_reg_if(dq_reg_t *dq_reg,
@@ -46,6 +46,6 @@ void dq_dqs_egress_dig_set_mode_reg_if(dq_reg_t *dq_reg,
                                        egress_dig_mode_t mode)
 {
     configASSERT(bit < WDDR_PHY_DQS_SLICE_NUM);
-    dq_reg->DDR_DQ_DQS_TX_EGRESS_DIG_CFG[msr][bit] = mode;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_EGRESS_DIG_CFG[msr][bit], mode);
 
 }
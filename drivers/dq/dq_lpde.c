@@ -20,7 +20,7 @@ void dq_dq_lpde_set_cfg_reg_if(dq_reg_t *dq_reg,
     uint32_t reg_val = cfg;
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_LPDE_M0_R0_CFG_0_EN, enable);
-    dq_reg->DDR_DQ_DQ_TX_LPDE_CFG[msr][rank][bit] = cfg;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_LPDE_CFG[msr][rank][bit], cfg);
 }
 
 /*******************************************************************************
@@ -37,7 +37,7 @@ void dq_dqs_lpde_set_cfg_reg_if(dq_reg_t *dq_reg,
 
     configASSERT(bit < WDDR_PHY_DQS_TXRX_SLICE_NUM);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_LPDE_M0_R0_CFG_0_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_LPDE_CFG[msr][rank][bit] = cfg;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_LPDE_CFG[msr][rank][bit], cfg);
 }
 
 void dq_dqs_lpde_rx_sdr_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -48,5 +48,5 @@ void dq_dqs_lpde_rx_sdr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_SDR_LPDE_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_RX_SDR_LPDE_CFG[msr][rank] = cfg;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_SDR_LPDE_CFG[msr][rank], cfg);
 }
@@ -17,7 +17,7 @@ void dq_dq_pi_odr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_ODR_PI_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQ_TX_ODR_PI_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_ODR_PI_CFG[msr][rank], reg_val);
 }
 
 void dq_dq_pi_qdr_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -28,7 +28,7 @@ void dq_dq_pi_qdr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_QDR_PI_0_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQ_TX_QDR_PI_0_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_QDR_PI_0_CFG[msr][rank], reg_val);
 }
 
 void dq_dq_pi_ddr_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -39,7 +39,7 @@ void dq_dq_pi_ddr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_DDR_PI_0_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQ_TX_DDR_PI_0_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_DDR_PI_0_CFG[msr][rank], reg_val);
 }
 
 void dq_dq_pi_rt_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -50,7 +50,7 @@ void dq_dq_pi_rt_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQ_TX_PI_RT_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQ_TX_PI_RT_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_TX_PI_RT_CFG[msr][rank], reg_val);
 }
 
 /*******************************************************************************
@@ -64,7 +64,7 @@ void dq_dqs_pi_odr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_ODR_PI_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_ODR_PI_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_ODR_PI_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_qdr_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -75,7 +75,7 @@ void dq_dqs_pi_qdr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_QDR_PI_0_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_QDR_PI_0_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_QDR_PI_0_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_ddr_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -86,7 +86,7 @@ void dq_dqs_pi_ddr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DDR_PI_0_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_DDR_PI_0_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_DDR_PI_0_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_rt_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -97,7 +97,7 @@ void dq_dqs_pi_rt_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_PI_RT_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_PI_RT_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_PI_RT_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_sdr_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -108,7 +108,7 @@ void dq_dqs_pi_sdr_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_SDR_PI_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_SDR_PI_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_SDR_PI_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_dfi_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -119,7 +119,7 @@ void dq_dqs_pi_dfi_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_TX_DFI_PI_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_TX_DFI_PI_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_TX_DFI_PI_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_ren_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -130,7 +130,7 @@ void dq_dqs_pi_ren_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_REN_PI_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_RX_REN_PI_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_REN_PI_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_rcs_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -141,7 +141,7 @@ void dq_dqs_pi_rcs_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RCS_PI_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_RX_RCS_PI_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_RCS_PI_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_rdqs_set_cfg_reg_if(dq_reg_t *dq_reg,
@@ -152,14 +152,14 @@ void dq_dqs_pi_rdqs_set_cfg_reg_if(dq_reg_t *dq_reg,
 {
     uint32_t reg_val = cfg;
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_DQ_DQS_RX_RDQS_PI_0_M0_R0_CFG_EN, enable);
-    dq_reg->DDR_DQ_DQS_RX_RDQS_PI_0_CFG[msr][rank] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_RDQS_PI_0_CFG[msr][rank], reg_val);
 }
 
 void dq_dqs_pi_get_status(dq_reg_t *dq_reg,
                           uint8_t *ren_status,
                           uint8_t *rcs_status)
 {
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_RX_PI_STA;
+    uint32_t reg_val = CSR_READ_STA(dq_reg->DDR_DQ_DQS_RX_PI_STA);
     if (ren_status)
     {
         *ren_status = GET_REG_FIELD(reg_val, DDR_DQ_DQS_RX_PI_STA_REN_PI_PHASE);
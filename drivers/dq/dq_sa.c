@@ -25,7 +25,7 @@ void dq_dq_sa_get_status_reg_if(dq_reg_t *dq_reg,
                                 uint8_t *status)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    uint32_t reg_val = dq_reg->DDR_DQ_DQ_RX_SA_STA[bit];
+    uint32_t reg_val = CSR_READ_STA(dq_reg->DDR_DQ_DQ_RX_SA_STA[bit]);
     switch (sa_index)
     {
         case SA_0_INDEX:
@@ -49,7 +49,7 @@ void dq_dq_sa_clear_cal_code_reg_if(dq_reg_t *dq_reg,
                                     uint8_t bit)
 {
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
-    dq_reg->DDR_DQ_DQ_RX_SA_CFG[msr][rank][bit] = 0x0;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_RX_SA_CFG[msr][rank][bit], 0x0);
 }
 
 void dq_dq_sa_set_cal_code_reg_if(dq_reg_t *dq_reg,
@@ -62,7 +62,7 @@ void dq_dq_sa_set_cal_code_reg_if(dq_reg_t *dq_reg,
     configASSERT(bit < WDDR_PHY_DQ_SLICE_NUM);
     uint32_t cal_code;
     uint8_t cal_dir;
-    uint32_t reg_val = dq_reg->DDR_DQ_DQ_RX_SA_CFG[msr][rank][bit];
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQ_RX_SA_CFG[msr][rank][bit]);
 
     if (code < WAV_SA_MID_CAL_CODE)
     {
@@ -97,7 +97,7 @@ void dq_dq_sa_set_cal_code_reg_if(dq_reg_t *dq_reg,
             return;
     }
 
-    dq_reg->DDR_DQ_DQ_RX_SA_CFG[msr][rank][bit] = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQ_RX_SA_CFG[msr][rank][bit], reg_val);
 }
 
 /*******************************************************************************
@@ -106,7 +106,7 @@ void dq_dq_sa_set_cal_code_reg_if(dq_reg_t *dq_reg,
 void dq_dqs_sa_cmn_set_state_reg_if(dq_reg_t *dq_reg,
                                     sensamp_state_t state)
 {
-    uint32_t reg_val = dq_reg->DDR_DQ_DQS_RX_SA_CMN_CFG;
+    uint32_t reg_val = CSR_READ(dq_reg->DDR_DQ_DQS_RX_SA_CMN_CFG);
 
     switch (state)
     {
@@ -144,5 +144,5 @@ void dq_dqs_sa_cmn_set_state_reg_if(dq_reg_t *dq_reg,
             return;
     }
 
-    dq_reg->DDR_DQ_DQS_RX_SA_CMN_CFG = reg_val;
+    CSR_WRITE(dq_reg->DDR_DQ_DQS_RX_SA_CMN_CFG, reg_val);
 }
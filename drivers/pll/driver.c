@@ -6,6 +6,7 @@
 #include <pll/driver.h>
 #include <kernel/io.h>
 #include <wddr/memory_map.h>
+#include <wddr/csr_shadow.h>
 
 void pll_init_reg_if(pll_dev_t *pll, uint32_t base)
 {
@@ -15,19 +16,19 @@ void pll_init_reg_if(pll_dev_t *pll, uint32_t base)
 void pll_reset_reg_if(pll_dev_t *pll)
 {
     uint32_t reg_val;
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_OVERRIDES_CORE_RESET_MUX, 0x1);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_OVERRIDES_CORE_RESET, 0x0);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR, reg_val);
 }
 
 void pll_set_vco_sel_reg_if(pll_dev_t *pll, vco_index_t vco_id)
 {
     uint32_t reg_val;
-    reg_val = reg_read(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR);
+    reg_val = CSR_REG_READ(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_OVERRIDES_CORE_VCO_SEL_MUX, 0x1);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_CORE_OVERRIDES_CORE_VCO_SEL, vco_id);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_OVERRIDES__ADR, reg_val);
 }
 
 void pll_switch_vco_reg_if(pll_dev_t *pll)
@@ -35,5 +36,5 @@ void pll_switch_vco_reg_if(pll_dev_t *pll)
     uint32_t reg_val;
     // Switch VCO
     reg_val = UPDATE_REG_FIELD(0, DDR_MVP_PLL_CORE_SWTICH_VCO_CORE_SWITCH_VCO, 0x1);
-    reg_write(pll->base + DDR_MVP_PLL_CORE_SWTICH_VCO__ADR, reg_val);
+    CSR_REG_WRITE(pll->base + DDR_MVP_PLL_CORE_SWTICH_VCO__ADR, reg_val);
 }
@@ -6,6 +6,7 @@
 #include <vco/driver.h>
 #include <kernel/io.h>
 #include <wddr/memory_map.h>
+#include <wddr/csr_shadow.h>
 
 #define VCO_0   (0x0)
 #define VCO_1   (0x1)
@@ -48,7 +49,7 @@ void vco_set_band_reg_if(vco_dev_t *vco, uint8_t band, uint8_t fine, bool mux)
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_BAND_VCO0_BAND, band);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_BAND_VCO0_FINE_MUX, mux);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_BAND_VCO0_FINE, fine);
-    reg_write(vco->base + VCO_BAND_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_BAND_OFFSET, reg_val);
 }
 
 void vco_set_int_frac_reg_if(vco_dev_t *vco, uint8_t int_comp, uint8_t prop_gain)
@@ -57,12 +58,12 @@ void vco_set_int_frac_reg_if(vco_dev_t *vco, uint8_t int_comp, uint8_t prop_gain
 
     // Prop Gain
     reg_val = UPDATE_REG_FIELD(0x0, DDR_MVP_PLL_VCO0_PROP_GAINS_VCO0_PROP_GAIN, prop_gain);
-    reg_write(vco->base + VCO_PROP_GAIN_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_PROP_GAIN_OFFSET, reg_val);
 
     // Int / Fraction
-    reg_val = reg_read(vco->base + VCO_INT_FRAC_SETTINGS_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_INT_FRAC_SETTINGS_OFFSET);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_INT_FRAC_SETTINGS_VCO0_INT, int_comp);
-    reg_write(vco->base + VCO_INT_FRAC_SETTINGS_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_INT_FRAC_SETTINGS_OFFSET, reg_val);
 }
 
 void vco_set_post_div_reg_if(vco_dev_t *vco, uint8_t post_div)
@@ -71,9 +72,9 @@ void vco_set_post_div_reg_if(vco_dev_t *vco, uint8_t post_div)
 
     if (vco->vco_id != VCO_0)
     {
-        reg_val = reg_read(vco->base + VCO_CONTROL_OFFSET);
+        reg_val = CSR_REG_READ(vco->base + VCO_CONTROL_OFFSET);
         reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO1_CONTROL_VCO1_POST_DIV, post_div);
-        reg_write(vco->base + VCO_CONTROL_OFFSET, reg_val);
+        CSR_REG_WRITE(vco->base + VCO_CONTROL_OFFSET, reg_val);
     }
 }
 
@@ -83,11 +84,11 @@ void vco_set_fll_control1_reg_if(vco_dev_t *vco,
                                  uint8_t lock_count_threshold)
 {
     uint32_t reg_val;
-    reg_val = reg_read(vco->base + VCO_FLL_CONTROL1_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_FLL_CONTROL1_OFFSET);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_BAND_START, band_start);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_FINE_START, fine_start);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_LOCKED_COUNT_THRESHOLD, lock_count_threshold);
-    reg_write(vco->base + VCO_FLL_CONTROL1_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_FLL_CONTROL1_OFFSET, reg_val);
 }
 
 void vco_set_fll_control2_reg_if(vco_dev_t *vco,
@@ -96,25 +97,25 @@ void vco_set_fll_control2_reg_if(vco_dev_t *vco,
                                  uint16_t fll_vco_count_target)
 {
     uint32_t reg_val;
-    reg_val = reg_read(vco->base + VCO_FLL_CONTROL2_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_FLL_CONTROL2_OFFSET);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL2_VCO0_FLL_REFCLK_COUNT, fll_refclk_count);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL2_VCO0_FLL_VCO_COUNT_TARGET, fll_vco_count_target);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL2_VCO0_FLL_RANGE, fll_range);
-    reg_write(vco->base + VCO_FLL_CONTROL2_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_FLL_CONTROL2_OFFSET, reg_val);
 }
 
 void vco_set_fll_enable_reg_if(vco_dev_t *vco, bool enable)
 {
     uint32_t reg_val;
-    reg_val = reg_read(vco->base + VCO_FLL_CONTROL1_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_FLL_CONTROL1_OFFSET);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_FLL_ENABLE, enable);
-    reg_write(vco->base + VCO_FLL_CONTROL1_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_FLL_CONTROL1_OFFSET, reg_val);
 }
 
 void vco_get_fll_band_status_reg_if(vco_dev_t *vco, uint8_t *band, uint8_t *fine)
 {
     uint32_t reg_val;
-    reg_val = reg_read(vco->base + VCO_FLL_BAND_STATUS_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_FLL_BAND_STATUS_OFFSET);
     *band = GET_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_BAND_STATUS_VCO0_BAND_STATUS);
     *fine = GET_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_BAND_STATUS_VCO0_FINE_STATUS);
 }
@@ -122,15 +123,22 @@ void vco_get_fll_band_status_reg_if(vco_dev_t *vco, uint8_t *band, uint8_t *fine
 bool vco_is_fll_locked(vco_dev_t *vco)
 {
     uint32_t reg_val;
-    reg_val = reg_read(vco->base + VCO_FLL_CONTROL1_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_FLL_CONTROL1_OFFSET);
     return GET_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_LOCKED) == 0x1;
 }
 
 void vco_set_enable_reg_if(vco_dev_t *vco, bool enable)
 {
     uint32_t reg_val;
-    reg_val = reg_read(vco->base + VCO_CONTROL_OFFSET);
+    reg_val = CSR_REG_READ(vco->base + VCO_CONTROL_OFFSET);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_CONTROL_VCO0_ENA, enable);
     reg_val = UPDATE_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_CONTROL_VCO0_ENA_MUX, 0x1);
-    reg_write(vco->base + VCO_CONTROL_OFFSET, reg_val);
+    CSR_REG_WRITE(vco->base + VCO_CONTROL_OFFSET, reg_val);
+}
+
+bool vco_get_enable_reg_if(vco_dev_t *vco)
+{
+    uint32_t reg_val;
+    reg_val = CSR_REG_READ(vco->base + VCO_CONTROL_OFFSET);
+    return GET_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_CONTROL_VCO0_ENA) == 0x1;
 }
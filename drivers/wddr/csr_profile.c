@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <cycles.h>
+#include <wddr/csr_shadow.h>
+#include <wddr/memory_map.h>
+
+#if CONFIG_CSR_PROFILE
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+// Offset of register within PHY; removes PHY base address
+#define CSR_PROFILE_OFFSET_MASK     (0x001FFFFF)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static csr_profile_entry_t profile[CSR_PROFILE_PHASE_NUM][CSR_PROFILE_MODULE_NUM];
+static csr_profile_phase_t current_phase = CSR_PROFILE_PHASE_IDLE;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to decode module from register address */
+static csr_profile_module_t csr_profile_decode(volatile uint32_t *reg);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+uint32_t csr_profile_read(volatile uint32_t *reg)
+{
+    uint32_t val;
+    uint32_t start = get_cycles();
+    csr_profile_entry_t *entry = &profile[current_phase][csr_profile_decode(reg)];
+
+#if CONFIG_CSR_SHADOW
+    val = csr_shadow_read(reg);
+#else
+    val = *reg;
+#endif /* CONFIG_CSR_SHADOW */
+
+    entry->read_cycles += get_cycles() - start;
+    entry->reads++;
+    return val;
+}
+
+uint32_t csr_profile_read_sta(volatile uint32_t *reg)
+{
+    uint32_t val;
+    uint32_t start = get_cycles();
+    csr_profile_entry_t *entry = &profile[current_phase][csr_profile_decode(reg)];
+
+    val = *reg;
+
+    entry->read_cycles += get_cycles() - start;
+    entry->reads++;
+    return val;
+}
+
+void csr_profile_write(volatile uint32_t *reg, uint32_t val, bool force)
+{
+    uint32_t start = get_cycles();
+    csr_profile_entry_t *entry = &profile[current_phase][csr_profile_decode(reg)];
+
+#if CONFIG_CSR_SHADOW
+    if (force)
+    {
+        csr_shadow_write_force(reg, val);
+    }
+    else
+    {
+        csr_shadow_write(reg, val);
+    }
+#else
+    *reg = val;
+#endif /* CONFIG_CSR_SHADOW */
+
+    entry->write_cycles += get_cycles() - start;
+    entry->writes++;
+}
+
+csr_profile_phase_t csr_profile_set_phase(csr_profile_phase_t phase)
+{
+    csr_profile_phase_t prev = current_phase;
+
+    if (phase < CSR_PROFILE_PHASE_NUM)
+    {
+        current_phase = phase;
+    }
+
+    return prev;
+}
+
+bool csr_profile_read_entry(uint16_t index, csr_profile_entry_t *entry)
+{
+    if (index >= CSR_PROFILE_ENTRY_NUM)
+    {
+        return false;
+    }
+
+    *entry = profile[index / CSR_PROFILE_MODULE_NUM][index % CSR_PROFILE_MODULE_NUM];
+    return true;
+}
+
+void csr_profile_clear(void)
+{
+    memset(profile, 0, sizeof(profile));
+}
+
+static csr_profile_module_t csr_profile_decode(volatile uint32_t *reg)
+{
+    uint32_t offset = ((uint32_t) (uintptr_t) reg) & CSR_PROFILE_OFFSET_MASK;
+
+    if (offset >= WDDR_MEMORY_MAP_PHY_CH_START && offset < WDDR_MEMORY_MAP_PHY_SLV_RSVD)
+    {
+        offset = (offset - WDDR_MEMORY_MAP_PHY_CH_START) % WDDR_MEMORY_MAP_PHY_CH_OFFSET;
+        return offset < WDDR_MEMORY_MAP_PHY_CA_OFFSET ? CSR_PROFILE_MODULE_DQ :
+                                                        CSR_PROFILE_MODULE_CA;
+    }
+
+    if (offset >= WDDR_MEMORY_MAP_DFI && offset < WDDR_MEMORY_MAP_PHY_CH_START)
+    {
+        return CSR_PROFILE_MODULE_DFI;
+    }
+
+    if (offset >= WDDR_MEMORY_MAP_FSW && offset < WDDR_MEMORY_MAP_CTRL)
+    {
+        return CSR_PROFILE_MODULE_FSW;
+    }
+
+    if (offset >= WDDR_MEMORY_MAP_PLL && offset < WDDR_MEMORY_MAP_FSW)
+    {
+        return CSR_PROFILE_MODULE_PLL;
+    }
+
+    if (offset >= WDDR_MEMORY_MAP_CMN && offset < WDDR_MEMORY_MAP_PLL)
+    {
+        return CSR_PROFILE_MODULE_CMN;
+    }
+
+    return CSR_PROFILE_MODULE_OTHER;
+}
+
+#endif /* CONFIG_CSR_PROFILE */
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <wddr/csr_shadow.h>
+
+#if CONFIG_CSR_SHADOW
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+// Registers are word aligned; bit 0 marks entry as valid
+#define CSR_SHADOW_TAG(addr)        ((addr) | 0x1)
+
+// Fold block offset into index so same register of each byte doesn't collide
+#define CSR_SHADOW_INDEX(addr)      ((((addr) >> 2) ^ ((addr) >> 12)) & (CSR_SHADOW_ENTRIES - 1))
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+/**
+ * @brief   CSR Shadow Entry Structure
+ *
+ * tag  address of shadowed register with valid bit set; 0 if empty.
+ * val  last value read from or written to the register.
+ */
+typedef struct csr_shadow_entry
+{
+    uint32_t    tag;
+    uint32_t    val;
+} csr_shadow_entry_t;
+
+static csr_shadow_entry_t shadow[CSR_SHADOW_ENTRIES];
+static csr_shadow_stats_t shadow_stats;
+
+#if CONFIG_CSR_WRITE_FILTER
+/**
+ * @brief   CSR Write Filter Statistics Entry Structure
+ *
+ * tag      address of register with valid bit set; 0 if empty.
+ * count    number of suppressed writes.
+ */
+typedef struct csr_filter_entry
+{
+    uint32_t    tag;
+    uint32_t    count;
+} csr_filter_entry_t;
+
+static csr_filter_entry_t filter_stats[CSR_FILTER_STATS_NUM];
+#endif /* CONFIG_CSR_WRITE_FILTER */
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+#if CONFIG_CSR_WRITE_FILTER
+/** @brief  Internal Function to count a suppressed write of a register */
+static void csr_filter_count(uint32_t addr);
+#endif /* CONFIG_CSR_WRITE_FILTER */
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+/**
+ * @note    Entries are shared by every task that accesses the PHY (FW task,
+ *          periodic calibration, IO calibration timer). Tag and value are
+ *          updated together with the bus access in a critical section so a
+ *          preempting task never sees one register's tag paired with
+ *          another register's value.
+ */
+uint32_t csr_shadow_read(volatile uint32_t *reg)
+{
+    uint32_t val;
+    uint32_t addr = (uint32_t) (uintptr_t) reg;
+    csr_shadow_entry_t *entry = &shadow[CSR_SHADOW_INDEX(addr)];
+
+    taskENTER_CRITICAL();
+    if (entry->tag == CSR_SHADOW_TAG(addr))
+    {
+        shadow_stats.hits++;
+        val = entry->val;
+    }
+    else
+    {
+        shadow_stats.misses++;
+        val = *reg;
+        entry->val = val;
+        entry->tag = CSR_SHADOW_TAG(addr);
+    }
+    taskEXIT_CRITICAL();
+
+    return val;
+}
+
+void csr_shadow_write(volatile uint32_t *reg, uint32_t val)
+{
+    uint32_t addr = (uint32_t) (uintptr_t) reg;
+    csr_shadow_entry_t *entry = &shadow[CSR_SHADOW_INDEX(addr)];
+
+    taskENTER_CRITICAL();
+    if (entry->tag == CSR_SHADOW_TAG(addr))
+    {
+#if CONFIG_CSR_WRITE_FILTER
+        // Register already holds value
+        if (entry->val == val)
+        {
+            shadow_stats.suppressed++;
+            csr_filter_count(addr);
+            taskEXIT_CRITICAL();
+            return;
+        }
+#endif /* CONFIG_CSR_WRITE_FILTER */
+        entry->val = val;
+    }
+
+    shadow_stats.writes++;
+    *reg = val;
+    taskEXIT_CRITICAL();
+}
+
+void csr_shadow_write_force(volatile uint32_t *reg, uint32_t val)
+{
+    uint32_t addr = (uint32_t) (uintptr_t) reg;
+    csr_shadow_entry_t *entry = &shadow[CSR_SHADOW_INDEX(addr)];
+
+    taskENTER_CRITICAL();
+    if (entry->tag == CSR_SHADOW_TAG(addr))
+    {
+        entry->val = val;
+    }
+
+    shadow_stats.writes++;
+    *reg = val;
+    taskEXIT_CRITICAL();
+}
+
+void csr_shadow_invalidate(void)
+{
+    taskENTER_CRITICAL();
+    memset(shadow, 0, sizeof(shadow));
+    taskEXIT_CRITICAL();
+}
+
+void csr_shadow_get_stats(csr_shadow_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = shadow_stats;
+    taskEXIT_CRITICAL();
+}
+
+bool csr_filter_read_stats(uint16_t index, uint32_t *addr, uint32_t *count)
+{
+#if CONFIG_CSR_WRITE_FILTER
+    if (index >= CSR_FILTER_STATS_NUM || filter_stats[index].tag == 0)
+    {
+        return false;
+    }
+
+    *addr = filter_stats[index].tag & ~0x1;
+    *count = filter_stats[index].count;
+    return true;
+#else
+    return false;
+#endif /* CONFIG_CSR_WRITE_FILTER */
+}
+
+#if CONFIG_CSR_WRITE_FILTER
+static void csr_filter_count(uint32_t addr)
+{
+    uint16_t index = CSR_SHADOW_INDEX(addr) & (CSR_FILTER_STATS_NUM - 1);
+
+    // Linear probe from hashed slot
+    for (uint16_t ii = 0; ii < CSR_FILTER_STATS_NUM; ii++)
+    {
+        csr_filter_entry_t *entry = &filter_stats[(index + ii) & (CSR_FILTER_STATS_NUM - 1)];
+
+        if (entry->tag == 0)
+        {
+            entry->tag = CSR_SHADOW_TAG(addr);
+        }
+
+        if (entry->tag == CSR_SHADOW_TAG(addr))
+        {
+            entry->count++;
+            return;
+        }
+    }
+
+    shadow_stats.untracked++;
+}
+#endif /* CONFIG_CSR_WRITE_FILTER */
+
+#endif /* CONFIG_CSR_SHADOW */
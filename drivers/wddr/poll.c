@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include <cycles.h>
+#include <FreeRTOS.h>
+#include <task.h>
+#include <wddr/poll.h>
+#include <wddr/csr_shadow.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+// Timeouts in MCU cycles
+#define POLL_TIMEOUT_SHORT      (2000000)   // Handshakes within the PHY
+#define POLL_TIMEOUT_LONG       (20000000)  // Analog settling / MC handshakes
+
+// Delay between checks of BACKOFF policy in MCU cycles
+#define POLL_BACKOFF_MIN        (16)
+#define POLL_BACKOFF_MAX        (1024)
+
+// Machine Interrupt Enable bit of mstatus
+#define MSTATUS_MIE             (0x8)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+/**
+ * @brief   Poll Site Configuration Structure
+ *
+ * timeout  cycles after which poll gives up.
+ * policy   how poll waits between checks.
+ */
+typedef struct wddr_poll_cfg
+{
+    uint32_t            timeout;
+    wddr_poll_policy_t  policy;
+} wddr_poll_cfg_t;
+
+/** Table that maps a poll site to its configuration */
+static const wddr_poll_cfg_t poll_cfg[WDDR_POLL_SITE_NUM] = {
+    {POLL_TIMEOUT_SHORT, WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_PLL_INT_EN
+    {POLL_TIMEOUT_SHORT, WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_PLL_CORE_READY
+    {POLL_TIMEOUT_SHORT, WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_LP_CORE_READY
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_YIELD},   // WDDR_POLL_SITE_VCO_FLL_LOCK
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_YIELD},   // WDDR_POLL_SITE_PMON_DONE
+    {POLL_TIMEOUT_SHORT, WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_IG_FIFO_EMPTY
+    {POLL_TIMEOUT_SHORT, WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_CSP_SYNC
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_BACKOFF}, // WDDR_POLL_SITE_DFI_MODE_INIT_START
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_FSW_INIT_START
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_SPIN},    // WDDR_POLL_SITE_FSW_INIT_COMPLETE
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_BACKOFF}, // WDDR_POLL_SITE_PHYMSTR_ACK_LOW
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_BACKOFF}, // WDDR_POLL_SITE_CTRLUPD_REQ_LOW
+    {POLL_TIMEOUT_LONG,  WDDR_POLL_POLICY_BACKOFF}, // WDDR_POLL_SITE_PHYUPD_ACK_LOW
+};
+
+static wddr_poll_stats_t poll_stats[WDDR_POLL_SITE_NUM];
+
+/**
+ * @brief   Poll Register Context Structure
+ *
+ * reg      pointer to register.
+ * mask     mask of field(s) to compare.
+ * value    value field(s) must have.
+ * reg_val  last register value.
+ */
+typedef struct wddr_poll_reg_ctx
+{
+    volatile uint32_t   *reg;
+    uint32_t            mask;
+    uint32_t            value;
+    uint32_t            reg_val;
+} wddr_poll_reg_ctx_t;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Internal Function to wait between checks according to policy */
+static void wddr_poll_wait(wddr_poll_policy_t policy, uint32_t *backoff);
+
+/** @brief  Internal Function to check register condition */
+static bool wddr_poll_reg_cond(void *ctx);
+
+/**
+ * @brief   Internal Function to mask interrupts around statistics access
+ *
+ * @details Polls run from tasks, ISRs and boot code before the scheduler
+ *          starts, so neither task nor ISR critical sections fit every
+ *          caller. Clears mstatus.MIE and returns its previous value.
+ */
+static uint32_t wddr_poll_stats_lock(void);
+
+/** @brief  Internal Function to restore interrupt state saved by lock */
+static void wddr_poll_stats_unlock(uint32_t mie);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+bool wddr_poll(wddr_poll_site_t site, wddr_poll_cond_t cond, void *ctx)
+{
+    const wddr_poll_cfg_t *cfg = &poll_cfg[site];
+    wddr_poll_stats_t *stats = &poll_stats[site];
+    uint32_t backoff = POLL_BACKOFF_MIN;
+    uint32_t start = get_cycles();
+    uint32_t cycles;
+    uint32_t mie;
+    bool done;
+
+    while (!(done = cond(ctx)))
+    {
+        if (get_cycles() - start >= cfg->timeout)
+        {
+            break;
+        }
+
+        wddr_poll_wait(cfg->policy, &backoff);
+    }
+
+    cycles = get_cycles() - start;
+
+    // Same site can be polled from task and ISR context
+    mie = wddr_poll_stats_lock();
+    stats->count++;
+    stats->timeouts += !done;
+    stats->cycles_total += cycles;
+    stats->cycles_max = cycles > stats->cycles_max ? cycles : stats->cycles_max;
+    wddr_poll_stats_unlock(mie);
+    return done;
+}
+
+bool wddr_poll_reg(wddr_poll_site_t site,
+                   volatile uint32_t *reg,
+                   uint32_t mask,
+                   uint32_t value,
+                   uint32_t *reg_val)
+{
+    bool done;
+    wddr_poll_reg_ctx_t ctx = {
+        .reg = reg,
+        .mask = mask,
+        .value = value,
+    };
+
+    done = wddr_poll(site, wddr_poll_reg_cond, &ctx);
+    if (reg_val != NULL)
+    {
+        *reg_val = ctx.reg_val;
+    }
+
+    return done;
+}
+
+bool wddr_poll_read_stats(uint16_t site, wddr_poll_stats_t *stats)
+{
+    uint32_t mie;
+
+    if (site >= WDDR_POLL_SITE_NUM)
+    {
+        return false;
+    }
+
+    mie = wddr_poll_stats_lock();
+    *stats = poll_stats[site];
+    wddr_poll_stats_unlock(mie);
+    return true;
+}
+
+void wddr_poll_clear_stats(void)
+{
+    uint32_t mie = wddr_poll_stats_lock();
+    memset(poll_stats, 0, sizeof(poll_stats));
+    wddr_poll_stats_unlock(mie);
+}
+
+static void wddr_poll_wait(wddr_poll_policy_t policy, uint32_t *backoff)
+{
+    uint32_t start;
+
+    switch (policy)
+    {
+        case WDDR_POLL_POLICY_BACKOFF:
+            start = get_cycles();
+            while (get_cycles() - start < *backoff);
+            *backoff = *backoff < POLL_BACKOFF_MAX ? *backoff << 1 : POLL_BACKOFF_MAX;
+            break;
+        case WDDR_POLL_POLICY_YIELD:
+            // Boot code runs before the scheduler does
+            if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+            {
+                taskYIELD();
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static bool wddr_poll_reg_cond(void *ctx)
+{
+    wddr_poll_reg_ctx_t *reg_ctx = (wddr_poll_reg_ctx_t *) ctx;
+
+    reg_ctx->reg_val = CSR_READ_STA(*reg_ctx->reg);
+    return (reg_ctx->reg_val & reg_ctx->mask) == reg_ctx->value;
+}
+
+static uint32_t wddr_poll_stats_lock(void)
+{
+    uint32_t mstatus;
+    __asm__ volatile ("csrrci %0, mstatus, %1" : "=r" (mstatus) : "i" (MSTATUS_MIE) : "memory");
+    return mstatus & MSTATUS_MIE;
+}
+
+static void wddr_poll_stats_unlock(uint32_t mie)
+{
+    __asm__ volatile ("csrs mstatus, %0" : : "r" (mie) : "memory");
+}
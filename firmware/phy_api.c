@@ -4,23 +4,58 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+/* Kernel includes. */
+#include <compiler.h>
+
+/* LPDDR includes. */
+#include <wddr/eye.h>
+
 /* Firmware includes. */
+#include <firmware/phy_api.h>
 #include <firmware/phy_task.h>
+#include <firmware/phy_prof.h>
+#include <firmware/phy_trace.h>
+#include <firmware/phy_stats.h>
 
 /*******************************************************************************
 **                                   MACROS
 *******************************************************************************/
-#define PREP_TIMEOUT        (pdMS_TO_TICKS(5)) // 5 milliseconds
 #define BOOT_TRY_COUNT      (1)
-#define PREP_TRY_COUNT      (3)
+#define PREP_TRY_COUNT      (3) // PREP is answered with RETRY if it's dropped
+#define STORE_TRY_COUNT     (1)
+#define EYE_SCAN_TRY_COUNT  (1)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+// Callback of the asynchronous PREP in flight
+static firmware_phy_prep_cb_t xPrepCallback;
+
+// Operating point being uploaded to the frequency cache
+static struct
+{
+    bool                open;
+    uint8_t             op_id;
+    uint16_t            num;
+    wddr_table_entry_t  entry[FIRMWARE_PHY_FREQ_STORE_NUM];
+} xFreqStore;
 
 /*******************************************************************************
 **                            FUNCTION DECLARATIONS
 *******************************************************************************/
-/** Internal Function for sending blocking message to the FW */
-static UBaseType_t __send_fw_msg(fw_msg_t *msg,
-                                 TickType_t xTicksToWait,
-                                 uint8_t try_count);
+/** Internal Function called by the FW when an asynchronous PREP completes */
+static void __prep_complete(uint8_t event, void *data, fw_response_t resp);
+
+/**
+ * @brief   Internal Function for sending blocking message to the FW
+ *
+ * @details Waits without a timeout: a blocked message is replayed by the FW
+ *          later, so giving up early would leave a stale copy queued and a
+ *          stray notification for the next request. Payload pointed to by
+ *          the message stays valid because the caller's frame outlives the
+ *          response.
+ */
+static UBaseType_t __send_fw_msg(fw_msg_t *msg, uint8_t try_count);
 
 /*******************************************************************************
 **                              IMPLEMENTATIONS
@@ -39,7 +74,7 @@ UBaseType_t firmware_phy_start(bool calibrate, bool train_dram)
     };
     msg.event = FW_PHY_EVENT_BOOT;
     msg.data = &cfg;
-    return __send_fw_msg(&msg, portMAX_DELAY, BOOT_TRY_COUNT);
+    return __send_fw_msg(&msg, BOOT_TRY_COUNT);
 }
 
 UBaseType_t firmware_phy_prep_switch(uint8_t freq_id)
@@ -47,14 +82,224 @@ UBaseType_t firmware_phy_prep_switch(uint8_t freq_id)
     fw_msg_t msg;
     msg.event = FW_PHY_EVENT_PREP;
     msg.data = (void *) (uintptr_t) freq_id;
-    return __send_fw_msg(&msg, PREP_TIMEOUT, PREP_TRY_COUNT);
+    return __send_fw_msg(&msg, PREP_TRY_COUNT);
+}
+
+UBaseType_t firmware_phy_prep_switch_async(uint8_t freq_id,
+                                          firmware_phy_prep_cb_t callback)
+{
+    fw_msg_t msg = {
+        .event = FW_PHY_EVENT_PREP,
+        .data = (void *) (uintptr_t) freq_id,
+        .xSender = NULL,
+        .complete = __prep_complete,
+    };
+
+    // Only one PREP can be in flight
+    if (callback == NULL || xPrepCallback != NULL)
+    {
+        return pdFAIL;
+    }
+
+    xPrepCallback = callback;
+    fw_phy_task_notify(&msg);
+    return pdPASS;
+}
+
+UBaseType_t firmware_phy_eye_scan(const wddr_eye_scan_cfg_t *cfg)
+{
+    fw_msg_t msg;
+
+    // Configuration is copied by the firmware before it responds
+    msg.event = FW_PHY_EVENT_EYE_SCAN;
+    msg.data = (void *) cfg;
+    return __send_fw_msg(&msg, EYE_SCAN_TRY_COUNT);
+}
+
+UBaseType_t firmware_phy_eye_get_info(uint8_t *vref_num,
+                                      uint8_t *best_row,
+                                      uint8_t *width)
+{
+    UBaseType_t ret = pdFAIL;
+    const wddr_eye_t *eye = wddr_eye_get_result();
+
+    // Periodic task may start a scan at any time
+    taskENTER_CRITICAL();
+    if (eye->valid)
+    {
+        *vref_num = eye->cfg.vref_num;
+        *best_row = eye->best_row;
+        *width = eye->best_width;
+        ret = pdPASS;
+    }
+    taskEXIT_CRITICAL();
+
+    return ret;
+}
+
+UBaseType_t firmware_phy_eye_read(uint8_t rank,
+                                  uint8_t byte,
+                                  uint8_t row,
+                                  uint8_t word,
+                                  uint32_t *data)
+{
+    return wddr_eye_read_word(rank, byte, row, word, data) == WDDR_SUCCESS ? pdPASS : pdFAIL;
+}
+
+UBaseType_t firmware_phy_prof_read(uint8_t event,
+                                   uint8_t kind,
+                                   uint8_t stat,
+                                   bool clear,
+                                   uint32_t *value)
+{
+    bool ret = fw_phy_prof_read(event, kind, stat, value);
+
+    if (clear)
+    {
+        fw_phy_prof_clear();
+    }
+
+    return ret ? pdPASS : pdFAIL;
+}
+
+UBaseType_t firmware_phy_trace_read(uint16_t word, uint32_t *data)
+{
+    return fw_phy_trace_read(word, data) ? pdPASS : pdFAIL;
+}
+
+UBaseType_t firmware_phy_stats_read(uint16_t stat, bool snapshot, uint32_t *value)
+{
+    bool ret = snapshot ? fw_phy_stats_read_snapshot(stat, value) :
+                          fw_phy_stats_read(stat, value);
+
+    return ret ? pdPASS : pdFAIL;
+}
+
+uint16_t firmware_phy_stats_snapshot(void)
+{
+    return fw_phy_stats_snapshot();
+}
+
+void firmware_phy_stats_clear(void)
+{
+    fw_phy_stats_clear();
+}
+
+UBaseType_t firmware_phy_csr_filter_read(uint16_t index, uint32_t *addr, uint32_t *count)
+{
+    if (index >= FIRMWARE_PHY_CSR_FILTER_NUM)
+    {
+        return pdFAIL;
+    }
+
+    if (!csr_filter_read_stats(index, addr, count))
+    {
+        *addr = 0;
+        *count = 0;
+    }
+
+    return pdPASS;
+}
+
+UBaseType_t firmware_phy_csr_profile_read(uint16_t index, csr_profile_entry_t *entry)
+{
+    if (index >= FIRMWARE_PHY_CSR_PROFILE_NUM)
+    {
+        return pdFAIL;
+    }
+
+    if (!csr_profile_read_entry(index, entry))
+    {
+        *entry = (csr_profile_entry_t) {0};
+    }
+
+    return pdPASS;
+}
+
+void firmware_phy_csr_profile_clear(void)
+{
+    csr_profile_clear();
+}
+
+UBaseType_t firmware_phy_boot_report_read(uint8_t index, uint32_t *cycles)
+{
+    const wddr_boot_report_t *report = wddr_get_boot_report();
+
+    if (index >= FIRMWARE_PHY_BOOT_REPORT_NUM)
+    {
+        return pdFAIL;
+    }
+
+    *cycles = index < WDDR_BOOT_STAGE_NUM ? report->cycles[index] : report->total;
+    return pdPASS;
+}
+
+UBaseType_t firmware_phy_poll_read(uint16_t site, wddr_poll_stats_t *stats)
+{
+    return wddr_poll_read_stats(site, stats) ? pdPASS : pdFAIL;
+}
+
+void firmware_phy_poll_clear(void)
+{
+    wddr_poll_clear_stats();
+}
+
+void firmware_phy_freq_store_begin(uint8_t op_id)
+{
+    xFreqStore.open = true;
+    xFreqStore.op_id = op_id;
+    xFreqStore.num = 0;
+}
+
+UBaseType_t firmware_phy_freq_store_entry(const wddr_table_entry_t *entry)
+{
+    if (!xFreqStore.open || xFreqStore.num >= FIRMWARE_PHY_FREQ_STORE_NUM)
+    {
+        return pdFAIL;
+    }
+
+    xFreqStore.entry[xFreqStore.num++] = *entry;
+    return pdPASS;
+}
+
+UBaseType_t firmware_phy_freq_store_commit(void)
+{
+    fw_msg_t msg;
+    fw_phy_freq_store_t store = {
+        .op_id = xFreqStore.op_id,
+        .delta = xFreqStore.entry,
+        .num = xFreqStore.num,
+    };
+
+    if (!xFreqStore.open)
+    {
+        return pdFAIL;
+    }
+
+    // Entries are copied by the firmware before it responds
+    xFreqStore.open = false;
+    msg.event = FW_PHY_EVENT_FREQ_STORE;
+    msg.data = &store;
+    return __send_fw_msg(&msg, STORE_TRY_COUNT);
+}
+
+static void __prep_complete(__UNUSED__ uint8_t event, void *data, fw_response_t resp)
+{
+    firmware_phy_prep_cb_t callback = xPrepCallback;
+
+    // Clear first so callback can issue next PREP
+    xPrepCallback = NULL;
+    callback((uint8_t) (uintptr_t) data,
+             resp == FW_RESP_SUCCESS ? pdPASS : pdFAIL,
+             resp == FW_RESP_RETRY);
 }
 
-static UBaseType_t __send_fw_msg(fw_msg_t *msg, TickType_t xTicksToWait, uint8_t ucTryCount)
+static UBaseType_t __send_fw_msg(fw_msg_t *msg, uint8_t ucTryCount)
 {
     UBaseType_t resp;
 
     msg->xSender = xTaskGetCurrentTaskHandle();
+    msg->complete = NULL;
 
     // Clear notifications
     xTaskNotifyWait(0, 0, NULL, 0);
@@ -64,8 +309,8 @@ static UBaseType_t __send_fw_msg(fw_msg_t *msg, TickType_t xTicksToWait, uint8_t
         // Send message
         fw_phy_task_notify(msg);
 
-        // Wait for it to be handled
-        xTaskNotifyWait(0, 0, &resp, xTicksToWait);
+        // Wait for it to be handled; blocked events are replayed by the FW
+        xTaskNotifyWait(0, 0, &resp, portMAX_DELAY);
 
         if (resp == FW_RESP_RETRY)
         {
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+#include <queue.h>
+
+/* Firmware includes. */
+#include <firmware/phy_job.h>
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+// Queue of jobs waiting for PHYMSTR windows
+static QueueHandle_t xJobQueue;
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void fw_phy_job_queue_init(void)
+{
+    configASSERT(xJobQueue == NULL);
+    xJobQueue = xQueueCreate(FW_PHY_JOB_QUEUE_LEN, sizeof(fw_phy_job_t *));
+    configASSERT(xJobQueue != NULL);
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_job_init(fw_phy_job_t *job, fw_phy_job_slice_t slice, void *ctx)
+{
+    memset(job, 0, sizeof(fw_phy_job_t));
+    job->slice = slice;
+    job->ctx = ctx;
+}
+
+/*-----------------------------------------------------------*/
+BaseType_t fw_phy_job_submit(fw_phy_job_t *job)
+{
+    if (job->queued)
+    {
+        return pdPASS;
+    }
+
+    job->started = false;
+    job->queued = true;
+    if (xQueueSendToBack(xJobQueue, &job, 0) != pdPASS)
+    {
+        job->queued = false;
+        return pdFAIL;
+    }
+
+    return pdPASS;
+}
+
+/*-----------------------------------------------------------*/
+bool fw_phy_job_pending(void)
+{
+    return uxQueueMessagesWaiting(xJobQueue) != 0;
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_job_run_window(wddr_dev_t *wddr)
+{
+    uint8_t freq_id;
+    fw_phy_job_t *job;
+    fw_phy_job_status_t status = FW_PHY_JOB_PENDING;
+
+    // Job stays at head of queue until it is done
+    if (xQueuePeek(xJobQueue, &job, 0) != pdPASS)
+    {
+        return;
+    }
+
+    pll_get_current_freq(&wddr->pll, &freq_id);
+
+    // Partial results are only valid for the frequency they were taken at
+    if (job->started && job->checkpoint.freq_id != freq_id)
+    {
+        job->started = false;
+        job->restarts++;
+    }
+
+    if (!job->started)
+    {
+        memset(&job->checkpoint, 0, sizeof(fw_phy_job_checkpoint_t));
+        job->checkpoint.freq_id = freq_id;
+        job->started = true;
+    }
+
+    for (uint8_t slice = 0; slice < FW_PHY_JOB_SLICES_PER_WINDOW; slice++)
+    {
+        status = job->slice(wddr, &job->checkpoint, job->ctx);
+        job->slices++;
+        if (status != FW_PHY_JOB_PENDING)
+        {
+            break;
+        }
+    }
+
+    if (status != FW_PHY_JOB_PENDING)
+    {
+        xQueueReceive(xJobQueue, &job, 0);
+        job->queued = false;
+    }
+}
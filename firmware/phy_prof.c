@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Firmware includes. */
+#include <firmware/phy_prof.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define HIST_COUNT_MAX      (UINT16_MAX)
+
+/*******************************************************************************
+**                            STRUCTURE DECLARATIONS
+*******************************************************************************/
+/**
+ * @brief   Profile Statistics Structure
+ *
+ * count    number of samples.
+ * min      minimum sample.
+ * max      maximum sample.
+ * total    sum of all samples.
+ * hist     log2 histogram of samples; saturates at HIST_COUNT_MAX.
+ */
+typedef struct prof_stats
+{
+    uint32_t    count;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    total;
+    uint16_t    hist[FW_PHY_PROF_HIST_BINS];
+} prof_stats_t;
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static prof_stats_t prof[FW_PHY_EVENT_NUM][FW_PHY_PROF_KIND_NUM];
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+static uint8_t __prof_hist_bin(uint32_t cycles)
+{
+    uint8_t bin = cycles ? 31 - __builtin_clz(cycles) : 0;
+    return bin < FW_PHY_PROF_HIST_BINS ? bin : FW_PHY_PROF_HIST_BINS - 1;
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_prof_record(fw_phy_event_t event, fw_phy_prof_kind_t kind, uint32_t cycles)
+{
+    prof_stats_t *stats;
+    uint8_t bin = __prof_hist_bin(cycles);
+
+    if (event >= FW_PHY_EVENT_NUM || kind >= FW_PHY_PROF_KIND_NUM)
+    {
+        return;
+    }
+
+    stats = &prof[event][kind];
+
+    // Readers run in other tasks
+    taskENTER_CRITICAL();
+    stats->min = (stats->count == 0 || cycles < stats->min) ? cycles : stats->min;
+    stats->max = cycles > stats->max ? cycles : stats->max;
+    stats->total += cycles;
+    stats->count++;
+    if (stats->hist[bin] < HIST_COUNT_MAX)
+    {
+        stats->hist[bin]++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*-----------------------------------------------------------*/
+bool fw_phy_prof_read(uint8_t event, uint8_t kind, uint8_t stat, uint32_t *value)
+{
+    prof_stats_t *stats;
+
+    if (event >= FW_PHY_EVENT_NUM ||
+        kind >= FW_PHY_PROF_KIND_NUM ||
+        stat >= FW_PHY_PROF_STAT_NUM)
+    {
+        return false;
+    }
+
+    stats = &prof[event][kind];
+
+    taskENTER_CRITICAL();
+    switch (stat)
+    {
+        case FW_PHY_PROF_STAT_COUNT:
+            *value = stats->count;
+            break;
+        case FW_PHY_PROF_STAT_MIN:
+            *value = stats->min;
+            break;
+        case FW_PHY_PROF_STAT_MAX:
+            *value = stats->max;
+            break;
+        case FW_PHY_PROF_STAT_MEAN:
+            *value = stats->count ? (uint32_t) (stats->total / stats->count) : 0;
+            break;
+        default:
+            *value = stats->hist[stat - FW_PHY_PROF_STAT_HIST];
+            break;
+    }
+    taskEXIT_CRITICAL();
+
+    return true;
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_prof_clear(void)
+{
+    taskENTER_CRITICAL();
+    memset(prof, 0, sizeof(prof));
+    taskEXIT_CRITICAL();
+}
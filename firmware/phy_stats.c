@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Firmware includes. */
+#include <firmware/phy_stats.h>
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static uint32_t stats[FW_PHY_STAT_NUM];
+static uint32_t snapshot[FW_PHY_STAT_NUM];
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void fw_phy_stats_inc(fw_phy_stat_t stat)
+{
+    // Single AMO; doesn't need a critical section on the hot path
+    __atomic_fetch_add(&stats[stat], 1, __ATOMIC_RELAXED);
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_stats_add(fw_phy_stat_t stat, uint32_t value)
+{
+    __atomic_fetch_add(&stats[stat], value, __ATOMIC_RELAXED);
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_stats_max(fw_phy_stat_t stat, uint32_t value)
+{
+    taskENTER_CRITICAL();
+    stats[stat] = value > stats[stat] ? value : stats[stat];
+    taskEXIT_CRITICAL();
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_stats_min(fw_phy_stat_t stat, uint32_t value)
+{
+    taskENTER_CRITICAL();
+    stats[stat] = (stats[stat] == 0 || value < stats[stat]) ? value : stats[stat];
+    taskEXIT_CRITICAL();
+}
+
+/*-----------------------------------------------------------*/
+bool fw_phy_stats_read(uint16_t stat, uint32_t *value)
+{
+    if (stat >= FW_PHY_STAT_NUM)
+    {
+        return false;
+    }
+
+    if (stat == FW_PHY_STAT_HEAP_FREE)
+    {
+        *value = xPortGetFreeHeapSize();
+        return true;
+    }
+
+    *value = stats[stat];
+    return true;
+}
+
+/*-----------------------------------------------------------*/
+uint16_t fw_phy_stats_snapshot(void)
+{
+    size_t heap_free = xPortGetFreeHeapSize();
+
+    taskENTER_CRITICAL();
+    memcpy(snapshot, stats, sizeof(snapshot));
+    snapshot[FW_PHY_STAT_HEAP_FREE] = heap_free;
+    taskEXIT_CRITICAL();
+
+    return FW_PHY_STAT_NUM;
+}
+
+/*-----------------------------------------------------------*/
+bool fw_phy_stats_read_snapshot(uint16_t stat, uint32_t *value)
+{
+    if (stat >= FW_PHY_STAT_NUM)
+    {
+        return false;
+    }
+
+    *value = snapshot[stat];
+    return true;
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_stats_clear(void)
+{
+    taskENTER_CRITICAL();
+    memset(stats, 0, sizeof(stats));
+    taskEXIT_CRITICAL();
+}
@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+/* Standard includes. */
+#include <string.h>
+
 /* FreeRTOS includes. */
 #include <FreeRTOS.h>
 #include <task.h>
@@ -12,6 +15,7 @@
 #include <queue.h>
 
 /* Kernel includes. */
+#include <cycles.h>
 #include <kernel/irq.h>
 #include <kernel/completion.h>
 #include <kernel/stateMachine.h>
@@ -20,22 +24,71 @@
 #include <wddr/memory_map.h>
 #include <wddr/irq_map.h>
 #include <wddr/device.h>
+#include <wddr/dqs_drift.h>
+#include <wddr/lp.h>
+#include <wddr/table_pack.h>
+#include <wddr/freq_cache.h>
+#include <wddr/poll.h>
+#include <wddr/eye.h>
 
 /* Firmware includes. */
 #include <firmware/phy_task.h>
+#include <firmware/phy_job.h>
+#include <firmware/phy_prof.h>
+#include <firmware/phy_trace.h>
+#include <firmware/phy_stats.h>
 
 /*******************************************************************************
 **                                   MACROS
 *******************************************************************************/
+// Host simulation maps the PHY elsewhere
+#ifndef WDDR_BASE_ADDR
 #define WDDR_BASE_ADDR              (0x00000000)
+#endif /* WDDR_BASE_ADDR */
+// Depth of each event lane
 #define MSG_QUEUE_LEN               (0x10)
 
+// Number of events that can be parked while blocked by the other FSM
+#define DEFERRED_LEN                (0x8)
+
+// Events of which at most one instance is queued at a time
+#define COALESCE_EVENT_MASK         ((1UL << FW_PHY_EVENT_PHYUPD_REQ) | \
+                                     (1UL << FW_PHY_EVENT_PHYMSTR_REQ) | \
+                                     (1UL << FW_PHY_EVENT_VCO_CAL))
+
 #define DFI_PHYUPD_PERIOD           (pdMS_TO_TICKS(2))
 #define PERIODIC_CAL_PERIOD         (pdMS_TO_TICKS(2))
 
+// Number of periodic calibration periods between DQS drift tracking
+#define DQS_DRIFT_PERIOD_NUM        (50)
+
+// Low power levels that change DRAM state
+#define LP_ALLOW                    ((CONFIG_LP_DRAM_POWER_DOWN ? WDDR_LP_ALLOW_DRAM_PD : 0) | \
+                                     (CONFIG_LP_DEEP_SLEEP ? WDDR_LP_ALLOW_DEEP_SLEEP : 0))
+
+#if CONFIG_TRAIN_ON_FIRST_USE && !CONFIG_CAL_PERIODIC
+#error "CONFIG_TRAIN_ON_FIRST_USE requires CONFIG_CAL_PERIODIC"
+#endif
+
+#if CONFIG_DQS_DRIFT_TRACK && !CONFIG_CAL_PERIODIC
+#error "CONFIG_DQS_DRIFT_TRACK requires CONFIG_CAL_PERIODIC"
+#endif
+
 /*******************************************************************************
 **                            FUNCTION DECLARATIONS
 *******************************************************************************/
+/**
+ * @brief   Firmware Lane Message Structure
+ *
+ * msg      message sent to firmware.
+ * cycles   cycle count when message was queued.
+ */
+typedef struct fw_lane_msg
+{
+    fw_msg_t    msg;
+    uint32_t    cycles;
+} fw_lane_msg_t;
+
 /** Firmware Task Entry Function */
 static void firmwareTask(void *pvParameters);
 
@@ -56,19 +109,67 @@ static fw_response_t handle_dfi_event(fw_phy_event_t event, void *data);
 /** Internal function for handling Low Power events */
 static fw_response_t handle_lp_event(fw_phy_event_t event, void *data);
 
+/** Internal function for handling background VCO calibration events */
+static fw_response_t handle_vco_cal_event(fw_phy_event_t event, void *data);
+
+/** Internal function for handling frequency store events */
+static fw_response_t handle_freq_store_event(fw_phy_event_t event, void *data);
+
+/** Internal function for handling eye scan events */
+static fw_response_t handle_eye_scan_event(fw_phy_event_t event, void *data);
+
+/** Internal function to queue background VCO calibration */
+static void __phy_vco_cal_post(void);
+
 /** Internal callback called when DFI PHYUPD Timer expires */
 static void dfi_phyupd_timer_callback(TimerHandle_t xTimer);
 
+#if CONFIG_CAL_PERIODIC
+/** Internal function that trains current frequency if requested; returns whether it did */
+static bool __phy_train_window(void);
+#endif /* CONFIG_CAL_PERIODIC */
+
+#if CONFIG_DQS_DRIFT_TRACK
+/** Internal job slice that tracks DQS drift of one rank */
+static fw_phy_job_status_t dqs_drift_job_slice(wddr_dev_t *wddr,
+                                               fw_phy_job_checkpoint_t *cp,
+                                               void *ctx);
+#endif /* CONFIG_DQS_DRIFT_TRACK */
+
+#if CONFIG_CAL_PERIODIC
+/** Internal job slice that runs a requested eye scan */
+static fw_phy_job_status_t eye_scan_job_slice(wddr_dev_t *wddr,
+                                              fw_phy_job_checkpoint_t *cp,
+                                              void *ctx);
+#endif /* CONFIG_CAL_PERIODIC */
+
 /*******************************************************************************
 **                           VARIABLE DECLARATIONS
 *******************************************************************************/
-static DECLARE_WDDR_TABLE(table);
+/** @note Unpacked from the packed table at init; see wddr/table_pack.h */
+static wddr_table_t table;
 /** @note Place in .data section at cost of image size */
 static wddr_dev_t wddr __attribute__ ((section (".data"))) = {0};
 
 // Handle to DFI PHYUPD Timer
 static TimerHandle_t xDfiPhyUpdTimer;
 
+#if CONFIG_CAL_PERIODIC
+// Set when a switch lands on a frequency that hasn't been trained yet
+static volatile bool train_pending;
+#endif /* CONFIG_CAL_PERIODIC */
+
+#if CONFIG_DQS_DRIFT_TRACK
+// Job that tracks DQS to DQ drift
+static fw_phy_job_t dqs_drift_job;
+#endif /* CONFIG_DQS_DRIFT_TRACK */
+
+#if CONFIG_CAL_PERIODIC
+// Job that runs eye scans requested by the host; needs DFI ownership
+static fw_phy_job_t eye_scan_job;
+static wddr_eye_scan_cfg_t eye_scan_cfg;
+#endif /* CONFIG_CAL_PERIODIC */
+
 // All Firmware states
 static struct state errorState;
 static struct state fswPrep, fswPending;
@@ -81,7 +182,20 @@ static struct state dfiIdle,
 static struct firmware_manager
 {
     TaskHandle_t  task;     // Firmware Task Handle
-    QueueHandle_t mq;       // Firmware Message Queue
+    QueueHandle_t doorbell; // One entry per queued message of any lane
+    struct
+    {
+        QueueHandle_t       mq;     // Lane Message Queue
+    } lane[FW_PHY_LANE_NUM];
+    struct
+    {
+        uint32_t pending;                   // Coalesced events that are queued
+    } coalesce;
+    struct
+    {
+        fw_msg_t msg[DEFERRED_LEN];         // Parked events, oldest first
+        uint8_t  count;                     // Number of parked events
+    } deferred;
 #if CONFIG_CAL_PERIODIC
     Completion_t phyMstrEvent;
 #endif /* CONFIG_CAL_PERIODIC */
@@ -89,6 +203,7 @@ static struct firmware_manager
     {
         bool ready;         // Status for if firmware has been started
         bool error;         // Status for if firmware is in error state
+        bool prep_failed;   // Status for if PREP being handled failed
     } status;
     struct
     {
@@ -120,6 +235,34 @@ static fw_response_t ( *event_handlers[FW_PHY_EVENT_NUM] )(fw_phy_event_t event,
     handle_dfi_event,   // FW_PHY_EVENT_CTRLUPD_DEASSERT
     handle_lp_event,    // FW_PHY_EVENT_LP_DATA_REQ
     handle_lp_event,    // FW_PHY_EVENT_LP_CTRL_REQ
+    handle_vco_cal_event, // FW_PHY_EVENT_VCO_CAL
+    handle_freq_store_event, // FW_PHY_EVENT_FREQ_STORE
+    handle_eye_scan_event, // FW_PHY_EVENT_EYE_SCAN
+};
+
+/** Table that maps an FW_PHY_EVENT to an event lane */
+static const fw_phy_lane_t event_lanes[FW_PHY_EVENT_NUM] = {
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_BOOT
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_PREP
+    FW_PHY_LANE_PERIODIC,   // FW_PHY_EVENT_PHYUPD_REQ
+    FW_PHY_LANE_PERIODIC,   // FW_PHY_EVENT_PHYMSTR_REQ
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_PHYMSTR_EXIT
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_INIT_START
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_INIT_COMPLETE
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_PLL_INIT_LOCK
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_PLL_LOCK
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_PLL_LOSS_LOCK
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_PHYMSTR_ACK
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_PHYMSTR_ABORT
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_PHYUPD_ACK
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_PHYUPD_ABORT
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_CTRLUPD_ASSERT
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_CTRLUPD_DEASSERT
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_LP_DATA_REQ
+    FW_PHY_LANE_DFI,        // FW_PHY_EVENT_LP_CTRL_REQ
+    FW_PHY_LANE_PERIODIC,   // FW_PHY_EVENT_VCO_CAL
+    FW_PHY_LANE_FSW,        // FW_PHY_EVENT_FREQ_STORE
+    FW_PHY_LANE_PERIODIC,   // FW_PHY_EVENT_EYE_SCAN
 };
 
 /*******************************************************************************
@@ -276,19 +419,33 @@ static struct state dfiCtrlUpd = {
 *******************************************************************************/
 void fw_phy_task_init(void)
 {
-    configASSERT(fw_manager.mq == NULL);
+    configASSERT(fw_manager.doorbell == NULL);
     configASSERT(fw_manager.task == NULL);
 
+    // Start tracing before any IRQ can fire
+    fw_phy_trace_init();
+
     // Initialize device and drivers
+    wddr_table_unpack(&table);
+#if CONFIG_FREQ_CACHE
+    wddr_freq_cache_init();
+#endif /* CONFIG_FREQ_CACHE */
     wddr_init(&wddr, WDDR_BASE_ADDR, &table);
 
     // State machine initialization
     stateM_init(&fw_manager.fsm.fsw, &fswPrep, &errorState);
     stateM_init(&fw_manager.fsm.dfi, &dfiIdle, &errorState);
 
-    // Create message queue
-    fw_manager.mq = xQueueCreate(MSG_QUEUE_LEN, sizeof(fw_msg_t));
-    configASSERT(fw_manager.mq != NULL);
+    // Create message queue for each lane
+    for (uint8_t lane = 0; lane < FW_PHY_LANE_NUM; lane++)
+    {
+        fw_manager.lane[lane].mq = xQueueCreate(MSG_QUEUE_LEN, sizeof(fw_lane_msg_t));
+        configASSERT(fw_manager.lane[lane].mq != NULL);
+    }
+
+    // Doorbell can hold an entry for every lane message; it is never full
+    fw_manager.doorbell = xQueueCreate(MSG_QUEUE_LEN * FW_PHY_LANE_NUM, sizeof(uint8_t));
+    configASSERT(fw_manager.doorbell != NULL);
 
     // Create PHYUPD Timer
     xDfiPhyUpdTimer = xTimerCreate("DFI PHYUPD Timer",
@@ -309,6 +466,12 @@ void fw_phy_task_init(void)
     configASSERT(fw_manager.task != NULL);
 
 #if CONFIG_CAL_PERIODIC
+    fw_phy_job_queue_init();
+#if CONFIG_DQS_DRIFT_TRACK
+    fw_phy_job_init(&dqs_drift_job, dqs_drift_job_slice, NULL);
+#endif /* CONFIG_DQS_DRIFT_TRACK */
+    fw_phy_job_init(&eye_scan_job, eye_scan_job_slice, &eye_scan_cfg);
+
     __UNUSED__ BaseType_t ret = xTaskCreate(firmwarePeriodicCalTask,
                                             "FW Periodic Cal Task",
                                             configMINIMAL_STACK_SIZE,
@@ -319,10 +482,136 @@ void fw_phy_task_init(void)
 #endif /* CONFIG_CAL_PERIODIC */
 }
 
+/*-----------------------------------------------------------*/
+static inline uint8_t __phy_event_lane(uint8_t event)
+{
+    // Out of bounds events are dropped by the task; keep them out of the way
+    return event < FW_PHY_EVENT_NUM ? event_lanes[event] : FW_PHY_LANE_PERIODIC;
+}
+
+/*-----------------------------------------------------------*/
+static inline bool __phy_event_coalesce(uint8_t event)
+{
+    uint32_t mask = event < FW_PHY_EVENT_NUM ? (1UL << event) : 0;
+
+    if (!(COALESCE_EVENT_MASK & mask))
+    {
+        return false;
+    }
+
+    // Merge into queued instance; otherwise mark as queued
+    if (fw_manager.coalesce.pending & mask)
+    {
+        fw_phy_stats_inc(FW_PHY_STAT_COALESCED);
+        return true;
+    }
+
+    fw_manager.coalesce.pending |= mask;
+    return false;
+}
+
+/*-----------------------------------------------------------*/
+static inline void __phy_event_uncoalesce(uint8_t event)
+{
+    if (event < FW_PHY_EVENT_NUM)
+    {
+        fw_manager.coalesce.pending &= ~(1UL << event);
+    }
+}
+
+/*-----------------------------------------------------------*/
+static inline bool __phy_lp_active(void)
+{
+    // PHY clocks may be gated or analog powered down
+    return wddr_lp_get_levels() != 0;
+}
+
+/*-----------------------------------------------------------*/
+static uint8_t __phy_trace_state(void)
+{
+    static struct state * const fsw_states[] = {&fswPrep, &fswPending};
+    static struct state * const dfi_states[] = {
+        &dfiIdle,
+        &dfiPhyMstrPending,
+        &dfiPhyMstr,
+        &dfiPhyUpd,
+        &dfiCtrlUpd,
+    };
+    uint8_t fsw = 0xF, dfi = 0xF;
+
+    for (uint8_t nn = 0; nn < sizeof(fsw_states) / sizeof(fsw_states[0]); nn++)
+    {
+        if (fw_manager.fsm.fsw.currentState == fsw_states[nn])
+        {
+            fsw = nn;
+        }
+    }
+
+    for (uint8_t nn = 0; nn < sizeof(dfi_states) / sizeof(dfi_states[0]); nn++)
+    {
+        if (fw_manager.fsm.dfi.currentState == dfi_states[nn])
+        {
+            dfi = nn;
+        }
+    }
+
+    return (fsw << 4) | dfi;
+}
+
+/*-----------------------------------------------------------*/
+static void __phy_event_respond(fw_msg_t *msg, fw_response_t resp)
+{
+    if (resp == FW_RESP_RETRY)
+    {
+        fw_phy_stats_inc(FW_PHY_STAT_RETRY);
+    }
+
+    if (msg->complete)
+    {
+        msg->complete(msg->event, msg->data, resp);
+    }
+    else if (msg->xSender)
+    {
+        xTaskNotify(msg->xSender, resp, eSetValueWithOverwrite);
+    }
+}
+
 /*-----------------------------------------------------------*/
 static BaseType_t __phy_task_notify(fw_msg_t *msg, TickType_t xTicksToWait)
 {
-    return xQueueSendToBack(fw_manager.mq, msg, xTicksToWait);
+    bool merged;
+    uint8_t lane = __phy_event_lane(msg->event);
+    fw_lane_msg_t item = {
+        .msg = *msg,
+        .cycles = get_cycles(),
+    };
+
+    taskENTER_CRITICAL();
+    merged = __phy_event_coalesce(msg->event);
+    taskEXIT_CRITICAL();
+
+    fw_phy_trace(merged ? FW_PHY_TRACE_MERGE : FW_PHY_TRACE_POST,
+                 msg->event,
+                 FW_PHY_TRACE_STATE_NONE,
+                 (uint32_t) (uintptr_t) msg->data);
+
+    if (merged)
+    {
+        // Queued instance answers its own sender; this one wasn't handled
+        __phy_event_respond(msg, FW_RESP_RETRY);
+        return pdPASS;
+    }
+
+    if (xQueueSendToBack(fw_manager.lane[lane].mq, &item, xTicksToWait) != pdPASS)
+    {
+        taskENTER_CRITICAL();
+        __phy_event_uncoalesce(msg->event);
+        taskEXIT_CRITICAL();
+        return pdFAIL;
+    }
+
+    // Message must be in lane before task is woken up
+    return xQueueSendToBack(fw_manager.doorbell, &lane, 0);
 }
 
 /*-----------------------------------------------------------*/
@@ -334,18 +623,185 @@ void fw_phy_task_notify(fw_msg_t *msg)
 /*-----------------------------------------------------------*/
 void fw_phy_task_notify_isr(fw_msg_t *msg, BaseType_t *pxHigherPriorityTaskWoken)
 {
-    xQueueSendToBackFromISR(fw_manager.mq, msg, pxHigherPriorityTaskWoken);
+    bool merged;
+    UBaseType_t uxSavedInterruptStatus;
+    uint8_t lane = __phy_event_lane(msg->event);
+    fw_lane_msg_t item = {
+        .msg = *msg,
+        .cycles = get_cycles(),
+    };
+
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    merged = __phy_event_coalesce(msg->event);
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+
+    fw_phy_trace(merged ? FW_PHY_TRACE_MERGE : FW_PHY_TRACE_POST_ISR,
+                 msg->event,
+                 FW_PHY_TRACE_STATE_NONE,
+                 (uint32_t) (uintptr_t) msg->data);
+
+    if (merged)
+    {
+        return;
+    }
+
+    if (xQueueSendToBackFromISR(fw_manager.lane[lane].mq, &item, pxHigherPriorityTaskWoken) == pdPASS)
+    {
+        xQueueSendToBackFromISR(fw_manager.doorbell, &lane, pxHigherPriorityTaskWoken);
+    }
+    else
+    {
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        __phy_event_uncoalesce(msg->event);
+        taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+    }
+}
+
+/*-----------------------------------------------------------*/
+static void __phy_task_receive(fw_msg_t *msg)
+{
+    uint8_t lane;
+    uint32_t depth;
+    uint32_t wait;
+    fw_lane_msg_t item;
+
+    // Block indefinitely
+    xQueueReceive(fw_manager.doorbell, &lane, portMAX_DELAY);
+
+    // Doorbell only counts messages; take from highest priority lane
+    for (lane = 0; lane < FW_PHY_LANE_NUM; lane++)
+    {
+        depth = uxQueueMessagesWaiting(fw_manager.lane[lane].mq);
+        if (xQueueReceive(fw_manager.lane[lane].mq, &item, 0) == pdPASS)
+        {
+            break;
+        }
+    }
+
+    configASSERT(lane < FW_PHY_LANE_NUM);
+
+    wait = get_cycles() - item.cycles;
+    fw_phy_trace(FW_PHY_TRACE_DEQUEUE, item.msg.event, __phy_trace_state(), lane);
+    fw_phy_prof_record(item.msg.event, FW_PHY_PROF_KIND_WAIT, wait);
+
+    fw_phy_stats_inc(FW_PHY_STAT_LANE_COUNT + lane);
+    fw_phy_stats_add(FW_PHY_STAT_LANE_WAIT_CYCLES + lane, wait);
+    fw_phy_stats_max(FW_PHY_STAT_LANE_WAIT_MAX + lane, wait);
+    fw_phy_stats_max(FW_PHY_STAT_LANE_DEPTH_MAX + lane, depth);
+
+    *msg = item.msg;
+}
+
+/*-----------------------------------------------------------*/
+static bool __phy_event_blocked(uint8_t event)
+{
+    // DFI events shouldn't be performed until switch completes or low power exits
+    if (event_handlers[event] == handle_dfi_event)
+    {
+        return fw_manager.fsm.fsw.currentState == &fswPending || __phy_lp_active();
+    }
+
+    // Low power can't be entered while DFI interface is in use
+    if (event_handlers[event] == handle_lp_event)
+    {
+        return fw_manager.fsm.fsw.currentState == &fswPending ||
+               fw_manager.fsm.dfi.currentState != &dfiIdle;
+    }
+
+    // Switch shouldn't be performed during CTRLUPD; PREP waits for low power exit
+    // and for PHYMSTR jobs to hand back the DFI buffer and inactive MSR
+    if (event_handlers[event] == handle_fsw_event)
+    {
+        return fw_manager.fsm.dfi.currentState == &dfiCtrlUpd ||
+               (event == FW_PHY_EVENT_PREP &&
+                (__phy_lp_active() ||
+                 fw_manager.fsm.dfi.currentState == &dfiPhyMstrPending ||
+                 fw_manager.fsm.dfi.currentState == &dfiPhyMstr));
+    }
+
+    return false;
+}
+
+/*-----------------------------------------------------------*/
+static void __phy_event_defer(fw_msg_t *msg)
+{
+    if (fw_manager.deferred.count < DEFERRED_LEN)
+    {
+        fw_manager.deferred.msg[fw_manager.deferred.count++] = *msg;
+        fw_phy_trace(FW_PHY_TRACE_DEFER, msg->event, __phy_trace_state(), fw_manager.deferred.count);
+        fw_phy_stats_max(FW_PHY_STAT_DEFERRED_MAX, fw_manager.deferred.count);
+        return;
+    }
+
+    fw_phy_stats_inc(FW_PHY_STAT_DROPPED);
+
+    // Event is lost; let sender know it has to try again
+    taskENTER_CRITICAL();
+    __phy_event_uncoalesce(msg->event);
+    taskEXIT_CRITICAL();
+
+    __phy_event_respond(msg, FW_RESP_RETRY);
+}
+
+/*-----------------------------------------------------------*/
+static void __phy_event_handle(fw_msg_t *msg)
+{
+    uint32_t start;
+    fw_response_t resp;
+
+    // Duplicates raised from now on need to be handled again
+    taskENTER_CRITICAL();
+    __phy_event_uncoalesce(msg->event);
+    taskEXIT_CRITICAL();
+
+    // Process event; includes state transition, entry and exit actions
+    fw_phy_trace(FW_PHY_TRACE_HANDLE_START, msg->event, __phy_trace_state(), (uint32_t) (uintptr_t) msg->data);
+    start = get_cycles();
+    resp = event_handlers[msg->event](msg->event, msg->data);
+    fw_phy_prof_record(msg->event, FW_PHY_PROF_KIND_HANDLER, get_cycles() - start);
+    fw_phy_trace(FW_PHY_TRACE_HANDLE_END, msg->event, __phy_trace_state(), resp);
+
+    // Let caller know message processed
+    __phy_event_respond(msg, resp);
+}
+
+/*-----------------------------------------------------------*/
+static void __phy_event_replay(void)
+{
+    fw_msg_t msg;
+    uint8_t nn = 0;
+
+    while (nn < fw_manager.deferred.count)
+    {
+        if (__phy_event_blocked(fw_manager.deferred.msg[nn].event))
+        {
+            nn++;
+            continue;
+        }
+
+        msg = fw_manager.deferred.msg[nn];
+        fw_manager.deferred.count--;
+        memmove(&fw_manager.deferred.msg[nn],
+                &fw_manager.deferred.msg[nn + 1],
+                (fw_manager.deferred.count - nn) * sizeof(fw_msg_t));
+
+        fw_phy_stats_inc(FW_PHY_STAT_REPLAYED);
+        fw_phy_trace(FW_PHY_TRACE_REPLAY, msg.event, __phy_trace_state(), fw_manager.deferred.count);
+        __phy_event_handle(&msg);
+
+        // Handled event may have changed state; rescan from oldest
+        nn = 0;
+    }
 }
 
 /*-----------------------------------------------------------*/
 static void firmwareTask(void *pvParameters)
 {
     fw_msg_t msg;
-    fw_response_t resp;
     for(;;)
     {
-        // Block indefinitely
-        xQueueReceive(fw_manager.mq, &msg, portMAX_DELAY);
+        // Highest priority pending message
+        __phy_task_receive(&msg);
 
         // skip out of bounds events
         if (msg.event >= FW_PHY_EVENT_NUM)
@@ -353,14 +809,20 @@ static void firmwareTask(void *pvParameters)
             continue;
         }
 
-        // Process event
-        resp = event_handlers[msg.event](msg.event, msg.data);
-
-        // Let caller know message processed
-        if (msg.xSender)
+        /**
+         * @note    Events blocked by the other state machine are parked and
+         *          their sender isn't notified until they are handled.
+         */
+        if (__phy_event_blocked(msg.event))
         {
-            xTaskNotify(msg.xSender, resp, eSetValueWithOverwrite);
+            __phy_event_defer(&msg);
+            continue;
         }
+
+        __phy_event_handle(&msg);
+
+        // Replay parked events that are no longer blocked
+        __phy_event_replay();
     }
 }
 
@@ -374,6 +836,7 @@ static fw_response_t handle_start_event(__UNUSED__ fw_phy_event_t event,
     if (start_cfg->calibrate)
     {
         boot_cfg = UPDATE_BOOT_OPTION(boot_cfg, WDDR_BOOT_OPTION_PLL_CAL, CONFIG_CALIBRATE_PLL);
+        boot_cfg = UPDATE_BOOT_OPTION(boot_cfg, WDDR_BOOT_OPTION_PLL_CAL_LAZY, CONFIG_LAZY_VCO_CAL);
         boot_cfg = UPDATE_BOOT_OPTION(boot_cfg, WDDR_BOOT_OPTION_SA_CAL, CONFIG_CALIBRATE_SA);
         boot_cfg = UPDATE_BOOT_OPTION(boot_cfg, WDDR_BOOT_OPTION_ZQCAL_CAL, CONFIG_CALIBRATE_ZQCAL);
     }
@@ -402,6 +865,9 @@ static fw_response_t handle_start_event(__UNUSED__ fw_phy_event_t event,
     // Turn on PLL interrupts
     pll_set_loss_lock_interrupt_state(&wddr.pll, true);
 
+    // Firmware acknowledges LP requests
+    dfi_lp_enable(&wddr.dfi);
+
     // Start the PHYUPD Timer
     if (xTimerStart(xDfiPhyUpdTimer, 0) == pdFAIL)
     {
@@ -411,6 +877,9 @@ static fw_response_t handle_start_event(__UNUSED__ fw_phy_event_t event,
     }
 
     fw_manager.status.ready = true;
+
+    // Calibrate remaining frequencies while idle
+    __phy_vco_cal_post();
     return FW_RESP_SUCCESS;
 }
 
@@ -428,12 +897,6 @@ static fw_response_t handle_dfi_event(fw_phy_event_t event, void *data)
         return FW_RESP_FAILURE;
     }
 
-    // DFI events shouldn't be performed until switch completes
-    if (fw_manager.fsm.fsw.currentState == &fswPending)
-    {
-        return FW_RESP_RETRY;
-    }
-
     ret = stateM_handleEvent(&fw_manager.fsm.dfi, &fsm_event);
     if (ret == stateM_errorStateReached)
     {
@@ -457,25 +920,151 @@ static fw_response_t handle_fsw_event(fw_phy_event_t event, void *data)
         return FW_RESP_FAILURE;
     }
 
-    // Switch shouldn't be performed during CTRLUPD
-    if (fw_manager.fsm.dfi.currentState == &dfiCtrlUpd)
+    fw_manager.status.prep_failed = false;
+    ret = stateM_handleEvent(&fw_manager.fsm.fsw, &fsm_event);
+    if (ret == stateM_errorStateReached || fw_manager.status.prep_failed)
     {
-        return FW_RESP_RETRY;
+        return FW_RESP_FAILURE;
     }
+    return FW_RESP_SUCCESS;
+}
 
-    ret = stateM_handleEvent(&fw_manager.fsm.fsw, &fsm_event);
-    if (ret == stateM_errorStateReached)
+/*-----------------------------------------------------------*/
+static fw_response_t handle_lp_event(fw_phy_event_t event, void *data)
+{
+    bool req = DFI_LP_EVENT_REQ(data);
+    bool was_active = __phy_lp_active();
+    dfi_lp_if_t intf = event == FW_PHY_EVENT_LP_CTRL_REQ ? DFI_LP_IF_CTRL : DFI_LP_IF_DATA;
+
+    if (!fw_manager.status.ready || fw_manager.status.error)
+    {
+        return FW_RESP_FAILURE;
+    }
+
+    if (wddr_lp_request(&wddr,
+                        intf,
+                        req,
+                        DFI_LP_EVENT_WAKEUP(data),
+                        LP_ALLOW) != WDDR_SUCCESS)
     {
+        // Failed entry is dropped; PHY can't run if exit failed
+        if (!req)
+        {
+            fw_manager.status.error = true;
+        }
         return FW_RESP_FAILURE;
     }
+
+    // Residency per level can be rebuilt from the trace
+    fw_phy_trace(FW_PHY_TRACE_LP, event, __phy_trace_state(), wddr_lp_get_levels());
+
+    // ACK follows REQ once PHY has entered / exited low power
+    dfi_lp_ack(&wddr.dfi, intf, req);
+
+    /**
+     * @note    IO calibration is suspended while in low power. Callback
+     *          checks low power as well in case it is already due.
+     */
+    if (!was_active && __phy_lp_active())
+    {
+        xTimerStop(xDfiPhyUpdTimer, 0);
+    }
+    else if (was_active && !__phy_lp_active())
+    {
+        if (xTimerStart(xDfiPhyUpdTimer, 0) == pdFAIL)
+        {
+            fw_manager.status.error = true;
+            return FW_RESP_FAILURE;
+        }
+    }
+
     return FW_RESP_SUCCESS;
 }
 
 /*-----------------------------------------------------------*/
-static fw_response_t handle_lp_event(fw_phy_event_t event, void *data)
+static fw_response_t handle_vco_cal_event(__UNUSED__ fw_phy_event_t event,
+                                          __UNUSED__ void *data)
 {
-    // Not supported
+    if (!fw_manager.status.ready || fw_manager.status.error)
+    {
+        return FW_RESP_FAILURE;
+    }
+
+    /**
+     * @note    One frequency per event so that higher priority lanes are
+     *          serviced between calibrations. Nothing is done while a switch
+     *          is prepared; event is queued again once switch completes.
+     */
+    if (wddr_calibrate_idle_vco(&wddr))
+    {
+        __phy_vco_cal_post();
+    }
+
+    return FW_RESP_SUCCESS;
+}
+
+/*-----------------------------------------------------------*/
+static fw_response_t handle_freq_store_event(__UNUSED__ fw_phy_event_t event,
+                                             __UNUSED__ void *data)
+{
+#if CONFIG_FREQ_CACHE
+    fw_phy_freq_store_t *store = (fw_phy_freq_store_t *) data;
+
+    if (!fw_manager.status.ready || fw_manager.status.error)
+    {
+        return FW_RESP_FAILURE;
+    }
+
+    // Runs on FSW lane so that it is ordered with PREP
+    if (wddr_freq_cache_store(&wddr, store->op_id, store->delta, store->num) != WDDR_SUCCESS)
+    {
+        return FW_RESP_FAILURE;
+    }
+
+    return FW_RESP_SUCCESS;
+#else
     return FW_RESP_FAILURE;
+#endif /* CONFIG_FREQ_CACHE */
+}
+
+/*-----------------------------------------------------------*/
+static fw_response_t handle_eye_scan_event(__UNUSED__ fw_phy_event_t event,
+                                           __UNUSED__ void *data)
+{
+#if CONFIG_CAL_PERIODIC
+    if (!fw_manager.status.ready || fw_manager.status.error)
+    {
+        return FW_RESP_FAILURE;
+    }
+
+    // Configuration belongs to the job until its scan is done
+    if (eye_scan_job.queued)
+    {
+        return FW_RESP_FAILURE;
+    }
+
+    eye_scan_cfg = *(const wddr_eye_scan_cfg_t *) data;
+    return fw_phy_job_submit(&eye_scan_job) == pdPASS ? FW_RESP_SUCCESS : FW_RESP_FAILURE;
+#else
+    // Scan needs PHYMSTR windows of the periodic task
+    return FW_RESP_FAILURE;
+#endif /* CONFIG_CAL_PERIODIC */
+}
+
+/*-----------------------------------------------------------*/
+static void __phy_vco_cal_post(void)
+{
+#if CONFIG_LAZY_VCO_CAL
+    fw_msg_t msg = {
+        .event = FW_PHY_EVENT_VCO_CAL,
+        .data = NULL,
+        .xSender = NULL,
+        .complete = NULL,
+    };
+
+    // Lost if lane is full; queued again after next switch
+    __phy_task_notify(&msg, 0);
+#endif /* CONFIG_LAZY_VCO_CAL */
 }
 
 /*-----------------------------------------------------------*/
@@ -488,10 +1077,16 @@ static void dfi_phyupd_timer_callback(TimerHandle_t xTimer)
         .xSender = NULL,
     };
 
+    // PHY may be clock gated or powered down; timer restarts on exit
+    if (__phy_lp_active())
+    {
+        return;
+    }
+
     // Perform calibration. Should there be a dedicated task instead?
     wddr_iocal_calibrate(&wddr);
 
-    // Submit event without blocking
+    // Submit event without blocking; merged if previous one is still queued
     ret = __phy_task_notify(&msg, 0);
     configASSERT(ret != pdFALSE);
 }
@@ -503,6 +1098,9 @@ static void firmwarePeriodicCalTask(void *pvParameters)
 {
     TickType_t xLastWakeTime;
     UBaseType_t resp;
+#if CONFIG_DQS_DRIFT_TRACK
+    uint32_t drift_period = 0;
+#endif /* CONFIG_DQS_DRIFT_TRACK */
     const TickType_t xFrequency = PERIODIC_CAL_PERIOD;
     const dfi_phymstr_req_t request = {
         .cs_state = DFI_MASTER_CS_STATE_ACTIVE,
@@ -522,6 +1120,33 @@ static void firmwarePeriodicCalTask(void *pvParameters)
         // Wait for the next cycle
         vTaskDelayUntil(&xLastWakeTime, xFrequency);
 
+        // Nothing is submitted or requested while in low power
+        if (__phy_lp_active())
+        {
+            continue;
+        }
+
+#if CONFIG_DQS_DRIFT_TRACK
+        // Drift is slow; only track every DQS_DRIFT_PERIOD_NUM periods
+        if (++drift_period >= DQS_DRIFT_PERIOD_NUM)
+        {
+            drift_period = 0;
+            fw_phy_job_submit(&dqs_drift_job);
+        }
+#endif /* CONFIG_DQS_DRIFT_TRACK */
+
+        // Don't take the bus unless there is work to do
+        if (!fw_phy_job_pending() && !train_pending)
+        {
+            continue;
+        }
+
+        // Jobs use the DFI buffer and inactive MSR that hold a prepared switch
+        if (wddr_is_switch_prepared(&wddr))
+        {
+            continue;
+        }
+
         // Try again later
         if (fw_manager.fsm.dfi.currentState != &dfiIdle)
         {
@@ -534,6 +1159,7 @@ static void firmwarePeriodicCalTask(void *pvParameters)
         // Request PHYMSTR control
         msg.event = FW_PHY_EVENT_PHYMSTR_REQ;
         msg.xSender = xTaskGetCurrentTaskHandle();
+        msg.complete = NULL;
 
         // Clear notifications
         xTaskNotifyWait(0, 0, NULL, 0);
@@ -559,18 +1185,114 @@ static void firmwarePeriodicCalTask(void *pvParameters)
             continue;
         }
 
-        // TODO: DRAM Calibration or Training goes here
+        /**
+         * @note    Long calibration work is split into slices that fit a
+         *          single PHYMSTR window. Progress is checkpointed and bus
+         *          is handed back after each window. Training isn't sliced
+         *          and takes a window of its own.
+         */
+        if (!__phy_train_window())
+        {
+            fw_phy_job_run_window(&wddr);
+        }
 
         // TODO: Put the DRAM back into correct state
 
         // Exit PHYMSTR
         msg.event = FW_PHY_EVENT_PHYMSTR_EXIT;
         msg.xSender = NULL;
+        msg.complete = NULL;
         fw_phy_task_notify(&msg);
     }
 }
 #endif /* CONFIG_CAL_PERIODIC */
 
+/*-----------------------------------------------------------*/
+#if CONFIG_CAL_PERIODIC
+static bool __phy_train_window(void)
+{
+#if CONFIG_TRAIN_ON_FIRST_USE
+    uint8_t freq_id;
+
+    if (!train_pending)
+    {
+        return false;
+    }
+
+    train_pending = false;
+
+    // Frequency may have been trained or switched away from since
+    pll_get_current_freq(&wddr.pll, &freq_id);
+    if (freq_id >= WDDR_PHY_FREQ_NUM || wddr_is_freq_trained(&wddr, freq_id))
+    {
+        return false;
+    }
+
+    /**
+     * @note    wddr_train is provided externally and can't be resumed, so
+     *          it isn't split into job slices; it runs in one window. It is
+     *          tried again on the next switch to the frequency if it fails.
+     */
+    wddr_train_current_freq(&wddr);
+    return true;
+#else
+    return false;
+#endif /* CONFIG_TRAIN_ON_FIRST_USE */
+}
+#endif /* CONFIG_CAL_PERIODIC */
+
+/*-----------------------------------------------------------*/
+#if CONFIG_DQS_DRIFT_TRACK
+static fw_phy_job_status_t dqs_drift_job_slice(wddr_dev_t *wddr,
+                                               fw_phy_job_checkpoint_t *cp,
+                                               __UNUSED__ void *ctx)
+{
+    // Nothing to track against until frequency is trained
+    if (!wddr_is_freq_trained(wddr, cp->freq_id))
+    {
+        return FW_PHY_JOB_DONE;
+    }
+
+    // One rank per window
+    if (wddr_dqs_drift_track(wddr, cp->rank) != WDDR_SUCCESS)
+    {
+        return FW_PHY_JOB_ERROR;
+    }
+
+    return ++cp->rank < WDDR_PHY_RANK ? FW_PHY_JOB_PENDING : FW_PHY_JOB_DONE;
+}
+#endif /* CONFIG_DQS_DRIFT_TRACK */
+
+/*-----------------------------------------------------------*/
+#if CONFIG_CAL_PERIODIC
+static fw_phy_job_status_t eye_scan_job_slice(wddr_dev_t *wddr,
+                                              fw_phy_job_checkpoint_t *cp,
+                                              void *ctx)
+{
+    const wddr_eye_scan_cfg_t *cfg = (const wddr_eye_scan_cfg_t *) ctx;
+
+    // Checkpoint is cleared on a frequency change; scan starts over
+    if (cp->step == 0 &&
+        wddr_eye_scan_start(wddr, cfg, wddr_eye_fifo_test, NULL) != WDDR_SUCCESS)
+    {
+        return FW_PHY_JOB_ERROR;
+    }
+
+    // One VREF step per window; result is read back with EYE_INFO / EYE_MAP
+    if (wddr_eye_scan_row(wddr, cp->step) != WDDR_SUCCESS)
+    {
+        return FW_PHY_JOB_ERROR;
+    }
+
+    if (++cp->step < cfg->vref_num)
+    {
+        return FW_PHY_JOB_PENDING;
+    }
+
+    return wddr_eye_scan_finish(wddr) == WDDR_SUCCESS ? FW_PHY_JOB_DONE : FW_PHY_JOB_ERROR;
+}
+#endif /* CONFIG_CAL_PERIODIC */
+
 /*******************************************************************************
 **                          STATE IMPLEMENTATIONS
 *******************************************************************************/
@@ -586,17 +1308,47 @@ static void fsw_prepare_switch_handler(__UNUSED__ void *currentStateData,
                                        struct event *event,
                                        __UNUSED__ void *newStateData)
 {
-    __UNUSED__ wddr_return_t ret;
+    wddr_return_t ret;
     wddr_msr_t next_msr;
+    uint32_t start;
     uint8_t freq_id = (uint8_t) (uintptr_t) event->data;
+#if CONFIG_FREQ_CACHE
+    uint32_t cycles;
+    bool hit;
+#endif /* CONFIG_FREQ_CACHE */
 
     // Make sure INIT_START IRQ not enabled
     disable_irq(MCU_FAST_IRQ_INIT_START);
 
     // Prepare PHY
+    start = get_cycles();
+#if CONFIG_FREQ_CACHE
+    // PREP carries an operating point; map it to the table frequency holding it
+    ret = wddr_freq_cache_get(&wddr, freq_id, &freq_id, &hit);
+    if (ret != WDDR_SUCCESS)
+    {
+        // Operating point isn't valid; PHY is left untouched
+        fw_manager.status.prep_failed = true;
+        return;
+    }
+
+    cycles = get_cycles() - start;
+    fw_phy_stats_inc(hit ? FW_PHY_STAT_FREQ_CACHE_HIT : FW_PHY_STAT_FREQ_CACHE_MISS);
+    fw_phy_stats_add(hit ? FW_PHY_STAT_FREQ_CACHE_HIT_CYCLES : FW_PHY_STAT_FREQ_CACHE_MISS_CYCLES, cycles);
+    fw_phy_stats_max(hit ? FW_PHY_STAT_FREQ_CACHE_HIT_MAX : FW_PHY_STAT_FREQ_CACHE_MISS_MAX, cycles);
+#endif /* CONFIG_FREQ_CACHE */
     next_msr = fsw_get_next_msr(&wddr.fsw);
     ret = wddr_prep_switch(&wddr, freq_id, next_msr);
-    configASSERT(ret == WDDR_SUCCESS);
+    if (ret != WDDR_SUCCESS)
+    {
+        // PREP_DONE isn't set; next PREP prepares the PHY again
+        fw_manager.status.prep_failed = true;
+        return;
+    }
+
+    start = get_cycles() - start;
+    fw_phy_stats_min(FW_PHY_STAT_PREP_MIN, start ? start : 1);
+    fw_phy_stats_max(FW_PHY_STAT_PREP_MAX, start);
 
     // Indicate Prep is done
     fsw_ctrl_set_prep_done_reg_if(wddr.fsw.fsw_reg, true);
@@ -611,6 +1363,8 @@ static void fsw_post_switch_handler(__UNUSED__ void *currentStateData,
                                     __UNUSED__ struct event *event,
                                     __UNUSED__ void *newStateData)
 {
+    uint8_t freq_id;
+
     // Indicate to PLL that switch occurred; disable previous vco
     pll_switch_vco(&wddr.pll, false);
     pll_disable_vco(&wddr.pll);
@@ -626,34 +1380,49 @@ static void fsw_post_switch_handler(__UNUSED__ void *currentStateData,
     fsw_ctrl_set_prep_done_reg_if(wddr.fsw.fsw_reg, false);
     fsw_ctrl_set_msr_toggle_en_reg_if(wddr.fsw.fsw_reg, 0x1);
     fsw_ctrl_set_vco_toggle_en_reg_if(wddr.fsw.fsw_reg, 0x1);
+
+    pll_get_current_freq(&wddr.pll, &freq_id);
+    if (freq_id < WDDR_PHY_FREQ_NUM)
+    {
+        fw_phy_stats_inc(FW_PHY_STAT_SWITCH + freq_id);
+    }
+
+#if CONFIG_TRAIN_ON_FIRST_USE
+    // Schedule training of frequency if it hasn't been trained yet
+    if (!wddr_is_freq_trained(&wddr, freq_id))
+    {
+        train_pending = true;
+    }
+#endif /* CONFIG_TRAIN_ON_FIRST_USE */
+
+    // Previous VCO is idle now; it may have frequencies left to calibrate
+    __phy_vco_cal_post();
 }
 
 /*-----------------------------------------------------------*/
 static void fsw_pending_entry_handler(__UNUSED__ void *stateData,
                                       __UNUSED__ struct event *event)
 {
-    uint8_t init_start, init_complete;
+    __UNUSED__ bool done;
+    __UNUSED__ dfi_return_t ret;
 
     // Wait for INIT_START to go low
-    do
-    {
-        init_start = dfi_get_init_start_status_reg_if(wddr.dfi.dfi_reg);
-    } while (init_start != 0x0);
+    done = wddr_poll(WDDR_POLL_SITE_FSW_INIT_START, dfi_init_start_low_cond, wddr.dfi.dfi_reg);
+    configASSERT(done);
 
     // Override Init Complete and force low to Complete MRW
     dfi_set_init_complete_ovr_reg_if(wddr.dfi.dfi_reg, true, 0x1);
 
     // Wait for PHY to deassert INIT_COMPLETE
-    do
-    {
-        init_complete = dfi_get_init_complete_status_reg_if(wddr.dfi.dfi_reg);
-    } while (init_complete != 0x1);
+    done = wddr_poll(WDDR_POLL_SITE_FSW_INIT_COMPLETE, dfi_init_complete_set_cond, wddr.dfi.dfi_reg);
+    configASSERT(done);
 
     // Set Post Work Done Override
     fsw_ctrl_set_post_work_done_reg_if(wddr.fsw.fsw_reg, true, 0x0);
 
     // Send MRW from DFI Buffer (This was filled during prep)
-    dfi_buffer_send_packets(&wddr.dfi);
+    ret = dfi_buffer_send_packets(&wddr.dfi);
+    configASSERT(ret == DFI_SUCCESS);
 
     // Must disable buffer when done
     dfi_buffer_disable(&wddr.dfi);
@@ -714,8 +1483,11 @@ static void dfi_phymstr_abort(void *currentStateData,
                              struct event *event,
                              void *newStateData)
 {
+    __UNUSED__ dfi_return_t ret;
+
     disable_irq(MCU_FAST_IRQ_PHYMSTR_ACK);
-    dfi_phymstr_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    ret = dfi_phymstr_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    configASSERT(ret == DFI_SUCCESS);
 #if CONFIG_CAL_PERIODIC
     // Notify Periodic Calibration Task that event was aborted
     vComplete(&fw_manager.phyMstrEvent);
@@ -733,24 +1505,32 @@ static void dfi_phymstr_enter_handler(void *stateData, struct event *event)
 /*-----------------------------------------------------------*/
 static void dfi_phymstr_exit_handler(void *stateData, struct event *event)
 {
+    __UNUSED__ dfi_return_t ret;
+
     /**
      * @note    It's expected that creator of PHYMSTR_EXIT event would have
      *          put the DRAM back into the correct state. The correct state
      *          is the state that the DRAM was put into by the Memory Controller
      *          per the PHY MASTER request parameters.
      */
-    dfi_phymstr_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    ret = dfi_phymstr_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    configASSERT(ret == DFI_SUCCESS);
 }
 
 /*-----------------------------------------------------------*/
 static void dfi_ctrlupd_entry_handler(void *stateData, struct event *event)
 {
+    __UNUSED__ dfi_return_t ret;
+
+    fw_phy_stats_inc(FW_PHY_STAT_CTRLUPD);
+
     // Perform IOCAL and update
     wddr_iocal_calibrate(&wddr);
     wddr_iocal_update_phy(&wddr);
 
     // Done with update; deassert acknowledge
-    dfi_ctrlupd_deassert_ack_reg_if(wddr.dfi.dfi_reg);
+    ret = dfi_ctrlupd_deassert_ack_reg_if(wddr.dfi.dfi_reg);
+    configASSERT(ret == DFI_SUCCESS);
 }
 
 /*-----------------------------------------------------------*/
@@ -759,6 +1539,8 @@ static void dfi_phyupd_entry_handler(void *stateData, struct event *event)
     // Get update type from event data
     dfi_phyupd_type_t type = (dfi_phyupd_type_t) (uintptr_t) event->data;
 
+    fw_phy_stats_inc(FW_PHY_STAT_PHYUPD);
+
     // Request PHY UPDATE
     dfi_phyupd_req_assert_reg_if(wddr.dfi.dfi_reg, type);
 
@@ -771,8 +1553,11 @@ static void dfi_phyupd_update(void *currentStateData,
                               struct event *event,
                               void *newStateData)
 {
+    __UNUSED__ dfi_return_t ret;
+
     wddr_iocal_update_phy(&wddr);
-    dfi_phyupd_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    ret = dfi_phyupd_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    configASSERT(ret == DFI_SUCCESS);
 }
 
 /*-----------------------------------------------------------*/
@@ -780,6 +1565,9 @@ static void dfi_phyupd_abort(void *currentStateData,
                              struct event *event,
                              void *newStateData)
 {
+    __UNUSED__ dfi_return_t ret;
+
     disable_irq(MCU_FAST_IRQ_PHYUPD_ACK);
-    dfi_phyupd_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    ret = dfi_phyupd_req_deassert_reg_if(wddr.dfi.dfi_reg);
+    configASSERT(ret == DFI_SUCCESS);
 }
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Kernel includes. */
+#include <cycles.h>
+
+/* Firmware includes. */
+#include <firmware/phy_trace.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define TRACE_WORD_NUM      (sizeof(fw_phy_trace_ring_t) / sizeof(uint32_t))
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+/** @note Not cleared at startup so that trace can be read after a crash */
+static fw_phy_trace_ring_t trace_ring __attribute__ ((section (".noinit.wddr_trace")));
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void fw_phy_trace_init(void)
+{
+    if (trace_ring.magic != FW_PHY_TRACE_MAGIC || trace_ring.len != FW_PHY_TRACE_LEN)
+    {
+        memset(&trace_ring, 0, sizeof(trace_ring));
+        trace_ring.len = FW_PHY_TRACE_LEN;
+        trace_ring.magic = FW_PHY_TRACE_MAGIC;
+    }
+
+    fw_phy_trace(FW_PHY_TRACE_BOOT, 0, FW_PHY_TRACE_STATE_NONE, ++trace_ring.boots);
+}
+
+/*-----------------------------------------------------------*/
+void fw_phy_trace(fw_phy_trace_id_t id, uint8_t event, uint8_t state, uint32_t arg)
+{
+    uint32_t seq;
+    fw_phy_trace_entry_t *entry;
+
+    // Claim entry; an ISR that preempts the writer claims the next one
+    seq = __atomic_fetch_add(&trace_ring.head, 1, __ATOMIC_RELAXED);
+    entry = &trace_ring.entry[seq & (FW_PHY_TRACE_LEN - 1)];
+
+    // Invalidate while entry is being written
+    entry->seq = 0;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+
+    entry->cycles = get_cycles();
+    entry->id = id;
+    entry->event = event;
+    entry->state = state;
+    entry->rsvd = 0;
+    entry->arg = arg;
+
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    entry->seq = seq + 1;
+}
+
+/*-----------------------------------------------------------*/
+bool fw_phy_trace_read(uint16_t word, uint32_t *data)
+{
+    if (word >= TRACE_WORD_NUM)
+    {
+        return false;
+    }
+
+    *data = ((const volatile uint32_t *) &trace_ring)[word];
+    return true;
+}
@@ -0,0 +1,27 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _CYCLES_H_
+#define _CYCLES_H_
+
+#include <stdint.h>
+
+/**
+ * @brief   Get Cycles
+ *
+ * @details Returns lower 32 bits of the RISC-V mcycle counter. Intended for
+ *          measuring short intervals; differences are wrap safe as long as
+ *          the interval is less than 2^32 cycles.
+ *
+ * @return  current cycle count.
+ */
+static inline uint32_t get_cycles(void)
+{
+    uint32_t cycles;
+    __asm__ volatile ("csrr %0, mcycle" : "=r" (cycles));
+    return cycles;
+}
+
+#endif /* _CYCLES_H_ */
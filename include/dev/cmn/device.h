@@ -76,9 +76,11 @@ void cmn_ibias_disable(cmn_dev_t *cmn_dev);
  * @param[in]   cmn_dev     pointer to common device.
  * @param[out]  count       pointer to where to store measured estimation.
  *
- * @return      void
+ * @return      returns whether estimation completed.
+ * @retval      WDDR_SUCCESS if completed.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if PMON didn't finish counting.
  */
-void cmn_pmon_run(cmn_dev_t *cmn_dev, uint32_t *count);
+wddr_return_t cmn_pmon_run(cmn_dev_t *cmn_dev, uint32_t *count);
 
 /**
  * @brief   Common Process Monitor Configure
@@ -60,9 +60,11 @@ dfi_return_t dfi_buffer_fill_packets(dfi_dev_t *dfi,
  *
  * @param[in]   dfi pointer to DFI Buffer device.
  *
- * @return      void
+ * @return      returns whether all packets were sent.
+ * @retval      DFI_SUCCESS if sent.
+ * @retval      DFI_ERROR_TIMEOUT if IG FIFO didn't drain in time.
  */
-void dfi_buffer_send_packets(dfi_dev_t *dfi);
+dfi_return_t dfi_buffer_send_packets(dfi_dev_t *dfi);
 
 /**
  * @brief   DFI Buffer Fill and Send Packets
@@ -76,6 +78,7 @@ void dfi_buffer_send_packets(dfi_dev_t *dfi);
  * @retval      DFI_SUCCESS if all packets successfully written.
  * @retval      DFI_ERROR_FIFO_FULL if IG FIFO is full before all
  *              packets have been written.
+ * @retval      DFI_ERROR_TIMEOUT if IG FIFO didn't drain in time.
  */
 dfi_return_t dfi_buffer_fill_and_send_packets(dfi_dev_t *dfi,
                                               const List_t *packet_list);
@@ -41,6 +41,7 @@ typedef struct command_frame_t
  * CKE          Clock Enable Command. (Holds CKE High and toggles CK).
  * CBT          Command Bus Training Command.
  * SR           Self-Refresh Command.
+ * MPC          Multi Purpose Command (without data).
  */
 typedef enum command_type_t
 {
@@ -53,6 +54,7 @@ typedef enum command_type_t
     COMMAND_TYPE_CKE,
     COMMAND_TYPE_CBT,
     COMMAND_TYPE_SR,
+    COMMAND_TYPE_MPC,
     COMMAND_TYPE_TOTAL_NUM,
 } command_type_t;
 
@@ -230,6 +232,18 @@ void create_rdfifo_command(command_t *command, chipselect_t cs);
  */
 void create_rddq_command(command_t *command, chipselect_t cs);
 
+/**
+ * @brief   Create Start DQS Oscillator Command
+ *
+ * @details Creates a Start DQS Interval Oscillator MPC command.
+ *
+ * @param[out]  command     pointer to command to fill in.
+ * @param[in]   cs          chip select.
+ *
+ * @return      void
+ */
+void create_dqs_osc_start_command(command_t *command, chipselect_t cs);
+
 /**
  * @brief   Create Self Refresh Entry Command
  *
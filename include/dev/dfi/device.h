@@ -9,6 +9,16 @@
 #include <dfi/driver.h>
 #include <dfi/table.h>
 
+/**
+ * @brief   DFI LP Event Data
+ *
+ * @details Low power firmware events carry REQ state and WAKEUP encoding of
+ *          the interface, sampled in the IRQ handler, in the event data.
+ */
+#define DFI_LP_EVENT_DATA(req, wakeup)  ((void *) (uintptr_t) (((req) << 8) | (wakeup)))
+#define DFI_LP_EVENT_REQ(data)          ((uint8_t) (((uintptr_t) (data) >> 8) & 0x1))
+#define DFI_LP_EVENT_WAKEUP(data)       ((uint8_t) ((uintptr_t) (data) & 0x3F))
+
 /**
  * @brief   DFI Device Structure
  *
@@ -35,4 +45,30 @@ typedef struct dfi_dev_t
  */
 void dfi_init(dfi_dev_t *dfi, uint32_t base);
 
+/**
+ * @brief   DFI LP Enable
+ *
+ * @details Hands LP_CTRL / LP_DATA acknowledge to the firmware and enables
+ *          the low power request IRQ. Requests aren't acknowledged until
+ *          dfi_lp_ack is called.
+ *
+ * @param[in]   dfi     pointer to DFI device.
+ *
+ * @return      void
+ */
+void dfi_lp_enable(dfi_dev_t *dfi);
+
+/**
+ * @brief   DFI LP Acknowledge
+ *
+ * @details Sets acknowledge signal of the given low power interface.
+ *
+ * @param[in]   dfi     pointer to DFI device.
+ * @param[in]   intf    low power interface.
+ * @param[in]   ack     flag to indicate if request is acknowledged.
+ *
+ * @return      void
+ */
+void dfi_lp_ack(dfi_dev_t *dfi, dfi_lp_if_t intf, bool ack);
+
 #endif /* _DFI_DEV_H_ */
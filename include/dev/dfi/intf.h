@@ -28,9 +28,11 @@ void dfi_phymstr_req(dfi_dev_t *dfi, dfi_phymstr_req_t *req);
  *
  * @param[in]   dfi     pointer to DFI device.
  *
- * @return      void.
+ * @return      returns whether Memory Controller released PHYMSTR ACK.
+ * @retval      DFI_SUCCESS if released.
+ * @retval      DFI_ERROR_TIMEOUT otherwise.
  */
-void dfi_phymstr_exit(dfi_dev_t *dfi);
+dfi_return_t dfi_phymstr_exit(dfi_dev_t *dfi);
 
 /**
  * @brief   DFI Control Update Deassert Acknowledge
@@ -40,9 +42,11 @@ void dfi_phymstr_exit(dfi_dev_t *dfi);
  *
  * @param[in]   dfi     pointer to DFI device.
  *
- * @return      void.
+ * @return      returns whether Memory Controller released CTRLUPD REQ.
+ * @retval      DFI_SUCCESS if released.
+ * @retval      DFI_ERROR_TIMEOUT otherwise.
  */
-void dfi_ctrlupd_deassert_ack(dfi_dev_t *dfi);
+dfi_return_t dfi_ctrlupd_deassert_ack(dfi_dev_t *dfi);
 
 /**
  * @brief   DFI Control Update Enable
@@ -89,8 +93,10 @@ void dfi_phyupd_req(dfi_dev_t *dfi, dfi_phyupd_type_t type);
  *
  * @param[in]   dfi     pointer to DFI device.
  *
- * @return      void.
+ * @return      returns whether Memory Controller released PHYUPD ACK.
+ * @retval      DFI_SUCCESS if released.
+ * @retval      DFI_ERROR_TIMEOUT otherwise.
  */
-void dfi_phyupd_exit(dfi_dev_t *dfi);
+dfi_return_t dfi_phyupd_exit(dfi_dev_t *dfi);
 
 #endif /* _DFI_INTF_DEV_H_ */
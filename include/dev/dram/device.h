@@ -78,6 +78,35 @@ void dram_power_down(dram_dev_t *dram, dfi_dev_t *dfi);
  */
 void dram_idle(dram_dev_t *dram, dfi_dev_t *dfi);
 
+/**
+ * @brief   DRAM Self-Refresh Enter
+ *
+ * @details Puts all ranks into Self-Refresh using DFI Buffer. CKE is driven
+ *          low afterwards (Self-Refresh Power Down) so that CK can be
+ *          stopped.
+ *
+ * @param[in]   dram    pointer to DRAM device.
+ * @param[in]   dfi     pointer to DFI device.
+ *
+ * @return      void
+ */
+void dram_self_refresh_enter(dram_dev_t *dram, dfi_dev_t *dfi);
+
+/**
+ * @brief   DRAM Self-Refresh Exit
+ *
+ * @details Takes all ranks out of Self-Refresh using DFI Buffer. Returns
+ *          once tXSR of the current frequency has elapsed.
+ *
+ * @note    CK must be running when called.
+ *
+ * @param[in]   dram    pointer to DRAM device.
+ * @param[in]   dfi     pointer to DFI device.
+ *
+ * @return      void
+ */
+void dram_self_refresh_exit(dram_dev_t *dram, dfi_dev_t *dfi);
+
 /**
  * @brief   DRAM Frequency Innitialization
  *
@@ -426,6 +455,50 @@ wddr_return_t dram_prepare_rdfifo_sequence(dram_dev_t *dram,
                                            chipselect_t cs,
                                            uint16_t rddata_en_offset);
 
+/**
+ * @brief   DRAM Prepare MRR Packet Sequence
+ *
+ * @details Creates a set of packets in order to read the specified mode
+ *          register from the DRAM. Mode register data is returned on the
+ *          DQ bus like a BL16 read.
+ *
+ * @param[in]   dram                pointer to DRAM device.
+ * @param[in]   buffer              pointer to packet buffer to save packet to.
+ * @param[in]   cs                  chipselect value.
+ * @param[in]   mode_register       which mode register to read.
+ * @param[in]   rddata_en_offset    read enable delay value to be used.
+ *
+ * @return      returns whether packet added to the packet buffer.
+ * @retval      WDDR_SUCCESS if added.
+ * @retval      WDDR_ERROR otherwise.
+ */
+wddr_return_t dram_prepare_mrr_sequence(dram_dev_t *dram,
+                                        dfi_tx_packet_buffer_t *buffer,
+                                        chipselect_t cs,
+                                        uint8_t mode_register,
+                                        uint16_t rddata_en_offset);
+
+/**
+ * @brief   DRAM Prepare DQS Oscillator Packet Sequence
+ *
+ * @details Creates a set of packets that programs the DQS interval
+ *          oscillator run time (MR23), starts the oscillator and waits
+ *          until the count is available in MR18 / MR19.
+ *
+ * @param[in]   dram        pointer to DRAM device.
+ * @param[in]   buffer      pointer to packet buffer to save packet to.
+ * @param[in]   cs          chipselect value.
+ * @param[in]   run_time    oscillator run time in units of 16 DRAM clocks.
+ *
+ * @return      returns whether packet added to the packet buffer.
+ * @retval      WDDR_SUCCESS if added.
+ * @retval      WDDR_ERROR otherwise.
+ */
+wddr_return_t dram_prepare_dqs_osc_sequence(dram_dev_t *dram,
+                                            dfi_tx_packet_buffer_t *buffer,
+                                            chipselect_t cs,
+                                            uint8_t run_time);
+
 /**
  * @brief   DRAM Prepare Write Level Training Packet Sequence
  *
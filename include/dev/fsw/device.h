@@ -6,6 +6,7 @@
 #ifndef _FSW_DEV_H_
 #define _FSW_DEV_H_
 
+#include <error.h>
 #include <wddr/phy_defs.h>
 #include <fsw/driver.h>
 #include <dfi/device.h>
@@ -58,9 +59,11 @@ void fsw_init(fsw_dev_t *dev, uint32_t base);
  * @param[in]   fsw_dev     pointer to Frequency Switch device.
  * @param[in]   dfi_dev     pointer to DFI device.
  *
- * @return  void.
+ * @return  returns whether FSW device is in DFI mode.
+ * @retval  WDDR_SUCCESS if in DFI mode.
+ * @retval  WDDR_ERROR_POLL_TIMEOUT if INIT_START didn't go low.
  */
-void fsw_switch_to_dfi_mode(fsw_dev_t *fsw_dev, dfi_dev_t *dfi_dev);
+wddr_return_t fsw_switch_to_dfi_mode(fsw_dev_t *fsw_dev, dfi_dev_t *dfi_dev);
 
 /**
  * @brief   Frequency Switch Get Current Mode Switch Register (MSR)
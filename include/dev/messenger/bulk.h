@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _MESSENGER_BULK_H_
+#define _MESSENGER_BULK_H_
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include <kernel/messenger.h>
+
+/** @brief  Number of data words sent per flow control credit */
+#define WDDR_BULK_WINDOW            (16)
+
+/**
+ * @brief   WDDR Bulk Read Function
+ *
+ * @details Reads a single word of the source being transferred.
+ *
+ * @param[in]   index   index of word to read.
+ * @param[out]  word    pointer to store word.
+ * @param[in]   ctx     source specific context.
+ *
+ * @return      returns whether word was read.
+ */
+typedef bool (*wddr_bulk_read_t)(uint32_t index, uint32_t *word, void *ctx);
+
+/**
+ * @brief   WDDR Bulk Send Function
+ *
+ * @details Sends consecutive messages to the host as a single operation;
+ *          nothing else may be sent in between.
+ *
+ * @param[in]   msg     pointer to first message to send.
+ * @param[in]   num     number of messages to send.
+ *
+ * @return      void
+ */
+typedef void (*wddr_bulk_send_t)(Message_t *msg, uint8_t num);
+
+/**
+ * @brief   WDDR Bulk Transfer Structure
+ *
+ * @details State of a PHY to host bulk transfer. A transfer is a BULK_HDR
+ *          message, count BULK_DATA messages and a BULK_END message that
+ *          carries the CRC-32 of the data. Data is sent WDDR_BULK_WINDOW
+ *          words at a time in a single send operation; the host grants the
+ *          next window with BULK_ACK.
+ *
+ * send     function used to send messages.
+ * read     function used to read source words.
+ * ctx      source specific context.
+ * active   flag to indicate that a transfer is in progress.
+ * src      source ID of the transfer.
+ * count    number of words in the transfer.
+ * index    index of next word to send.
+ * acked    number of words acknowledged by host.
+ * crc      CRC of words sent so far.
+ * crc_acked    CRC of words acknowledged by host.
+ * resent   number of words sent again after a rewind.
+ * window   BULK_DATA messages of the window being sent.
+ */
+typedef struct wddr_bulk
+{
+    wddr_bulk_send_t    send;
+    wddr_bulk_read_t    read;
+    void                *ctx;
+    bool                active;
+    uint8_t             src;
+    uint32_t            count;
+    uint32_t            index;
+    uint32_t            acked;
+    uint32_t            crc;
+    uint32_t            crc_acked;
+    uint32_t            resent;
+    Message_t           window[WDDR_BULK_WINDOW];
+} wddr_bulk_t;
+
+/**
+ * @brief   WDDR Bulk Initialization
+ *
+ * @param[in]   bulk    pointer to bulk transfer.
+ * @param[in]   send    function used to send messages.
+ *
+ * @return      void
+ */
+void wddr_bulk_init(wddr_bulk_t *bulk, wddr_bulk_send_t send);
+
+/**
+ * @brief   WDDR Bulk Start
+ *
+ * @details Starts a transfer. Sends the header and the first window. A
+ *          transfer in progress is abandoned. If read is NULL, a header
+ *          with failure status is sent and no transfer is started.
+ *
+ * @param[in]   bulk    pointer to bulk transfer.
+ * @param[in]   src     source ID echoed in the header.
+ * @param[in]   count   number of words to transfer.
+ * @param[in]   read    function used to read source words.
+ * @param[in]   ctx     source specific context.
+ *
+ * @return      returns whether transfer was started.
+ */
+bool wddr_bulk_start(wddr_bulk_t *bulk,
+                     uint8_t src,
+                     uint32_t count,
+                     wddr_bulk_read_t read,
+                     void *ctx);
+
+/**
+ * @brief   WDDR Bulk Acknowledge
+ *
+ * @details Handles BULK_ACK from the host. If the host has received every
+ *          word sent, the next window is sent; otherwise the transfer
+ *          rewinds to the last acknowledged window. BULK_END is sent
+ *          after the last word.
+ *
+ * @param[in]   bulk        pointer to bulk transfer.
+ * @param[in]   received    number of words received by host.
+ *
+ * @return      returns whether a transfer was in progress.
+ */
+bool wddr_bulk_ack(wddr_bulk_t *bulk, uint32_t received);
+
+/**
+ * @brief   WDDR Bulk CRC
+ *
+ * @details Updates CRC-32 (IEEE 802.3) with a word in little endian order.
+ *          Start with 0; matches zlib.crc32 over the same bytes.
+ *
+ * @param[in]   crc     current CRC.
+ * @param[in]   word    word to add.
+ *
+ * @return      updated CRC.
+ */
+uint32_t wddr_bulk_crc(uint32_t crc, uint32_t word);
+
+#endif /* _MESSENGER_BULK_H_ */
@@ -15,11 +15,51 @@
  *
  * FREQ_PREP_REQ    frequency prep request message.
  * FREQ_PREP_RESP   frequency prep response message.
+ * EYE_INFO_REQ     eye scan summary request message.
+ * EYE_INFO_RESP    eye scan summary response message.
+ * EYE_MAP_REQ      eye map chunk request message.
+ * EYE_MAP_RESP     eye map chunk response message.
+ * PROF_REQ         firmware event profile statistic request message.
+ * PROF_RESP        firmware event profile statistic response message.
+ * TRACE_REQ        firmware trace ring word request message.
+ * TRACE_RESP       firmware trace ring word response message.
+ * BULK_REQ         bulk transfer request message.
+ * BULK_HDR         bulk transfer header message (PHY to host).
+ * BULK_DATA        bulk transfer data word message (PHY to host).
+ * BULK_ACK         bulk transfer window acknowledge message.
+ * BULK_END         bulk transfer end message; data is CRC-32 (PHY to host).
+ * STATS_REQ        firmware telemetry counter request message.
+ * STATS_RESP       firmware telemetry counter response message.
+ * FREQ_STORE_REQ   frequency cache upload command message.
+ * FREQ_STORE_DATA  frequency cache upload entry value message.
+ * FREQ_STORE_RESP  frequency cache upload response message.
+ * EYE_SCAN_REQ     eye scan request message.
+ * EYE_SCAN_RESP    eye scan response message; scan runs in the background.
  * END_OF_MESSAGES  indicates number of general messages.
  */
 typedef enum messages_wddr_t {
     MESSAGE_WDDR_FREQ_PREP_REQ = 0x00020002,
     MESSAGE_WDDR_FREQ_PREP_RESP,
+    MESSAGE_WDDR_EYE_INFO_REQ,
+    MESSAGE_WDDR_EYE_INFO_RESP,
+    MESSAGE_WDDR_EYE_MAP_REQ,
+    MESSAGE_WDDR_EYE_MAP_RESP,
+    MESSAGE_WDDR_PROF_REQ,
+    MESSAGE_WDDR_PROF_RESP,
+    MESSAGE_WDDR_TRACE_REQ,
+    MESSAGE_WDDR_TRACE_RESP,
+    MESSAGE_WDDR_BULK_REQ,
+    MESSAGE_WDDR_BULK_HDR,
+    MESSAGE_WDDR_BULK_DATA,
+    MESSAGE_WDDR_BULK_ACK,
+    MESSAGE_WDDR_BULK_END,
+    MESSAGE_WDDR_STATS_REQ,
+    MESSAGE_WDDR_STATS_RESP,
+    MESSAGE_WDDR_FREQ_STORE_REQ,
+    MESSAGE_WDDR_FREQ_STORE_DATA,
+    MESSAGE_WDDR_FREQ_STORE_RESP,
+    MESSAGE_WDDR_EYE_SCAN_REQ,
+    MESSAGE_WDDR_EYE_SCAN_RESP,
     MESSAGE_WDDR_END_OF_MESSAGES,
 } messages_wddr_t;
 
@@ -35,6 +75,135 @@ typedef enum messages_wddr_t {
 #define WDDR_FREQ_PREP_RSP__RESP_CODE__MSK      (0x00FF0000)
 #define WDDR_FREQ_PREP_RSP__RESP_CODE__SHFT     (0x00000010)
 
+#define WDDR_EYE_INFO_RSP__STATUS__MSK          (0x000000FF)
+#define WDDR_EYE_INFO_RSP__STATUS__SHFT         (0x00000000)
+#define WDDR_EYE_INFO_RSP__VREF_NUM__MSK        (0x0000FF00)
+#define WDDR_EYE_INFO_RSP__VREF_NUM__SHFT       (0x00000008)
+#define WDDR_EYE_INFO_RSP__BEST_ROW__MSK        (0x00FF0000)
+#define WDDR_EYE_INFO_RSP__BEST_ROW__SHFT       (0x00000010)
+#define WDDR_EYE_INFO_RSP__WIDTH__MSK           (0xFF000000)
+#define WDDR_EYE_INFO_RSP__WIDTH__SHFT          (0x00000018)
+
+#define WDDR_EYE_MAP_REQ__BYTE__MSK             (0x0000000F)
+#define WDDR_EYE_MAP_REQ__BYTE__SHFT            (0x00000000)
+#define WDDR_EYE_MAP_REQ__WORD__MSK             (0x000000F0)
+#define WDDR_EYE_MAP_REQ__WORD__SHFT            (0x00000004)
+#define WDDR_EYE_MAP_REQ__ROW__MSK              (0x0000FF00)
+#define WDDR_EYE_MAP_REQ__ROW__SHFT             (0x00000008)
+#define WDDR_EYE_MAP_REQ__RANK__MSK             (0x000F0000)
+#define WDDR_EYE_MAP_REQ__RANK__SHFT            (0x00000010)
+
+#define WDDR_PROF_REQ__EVENT__MSK               (0x000000FF)
+#define WDDR_PROF_REQ__EVENT__SHFT              (0x00000000)
+#define WDDR_PROF_REQ__KIND__MSK                (0x0000FF00)
+#define WDDR_PROF_REQ__KIND__SHFT               (0x00000008)
+#define WDDR_PROF_REQ__STAT__MSK                (0x00FF0000)
+#define WDDR_PROF_REQ__STAT__SHFT               (0x00000010)
+#define WDDR_PROF_REQ__CLEAR__MSK               (0x01000000)
+#define WDDR_PROF_REQ__CLEAR__SHFT              (0x00000018)
+
+#define WDDR_TRACE_REQ__WORD__MSK               (0x0000FFFF)
+#define WDDR_TRACE_REQ__WORD__SHFT              (0x00000000)
+
+/**
+ * @brief   WDDR Bulk Transfer Sources
+ *
+ * TRACE        firmware trace ring, word 0 first.
+ * EYE_MAP      eye map of one rank / DQ byte, row by row.
+ * STATS        snapshot of all telemetry counters.
+ * CSR_FILTER   suppressed CSR write counts as address / count pairs.
+ * CSR_PROFILE  CSR access profile; reads, writes, read cycles and write
+ *              cycles of each module, phase by phase.
+ * BOOT_REPORT  cycles of each boot stage followed by total boot cycles.
+ * POLL         poll statistics; count, timeouts, maximum cycles and mean
+ *              cycles of each poll site.
+ */
+#define WDDR_BULK_SRC_TRACE                     (0x00)
+#define WDDR_BULK_SRC_EYE_MAP                   (0x01)
+#define WDDR_BULK_SRC_STATS                     (0x02)
+#define WDDR_BULK_SRC_CSR_FILTER                (0x03)
+#define WDDR_BULK_SRC_CSR_PROFILE               (0x04)
+#define WDDR_BULK_SRC_BOOT_REPORT               (0x05)
+#define WDDR_BULK_SRC_POLL                      (0x06)
+
+#define WDDR_BULK_REQ__SRC__MSK                 (0x000000FF)
+#define WDDR_BULK_REQ__SRC__SHFT                (0x00000000)
+#define WDDR_BULK_REQ__EYE_BYTE__MSK            (0x00000F00)
+#define WDDR_BULK_REQ__EYE_BYTE__SHFT           (0x00000008)
+#define WDDR_BULK_REQ__EYE_RANK__MSK            (0x0000F000)
+#define WDDR_BULK_REQ__EYE_RANK__SHFT           (0x0000000C)
+
+#define WDDR_BULK_HDR__STATUS__MSK              (0x000000FF)
+#define WDDR_BULK_HDR__STATUS__SHFT             (0x00000000)
+#define WDDR_BULK_HDR__SRC__MSK                 (0x0000FF00)
+#define WDDR_BULK_HDR__SRC__SHFT                (0x00000008)
+#define WDDR_BULK_HDR__COUNT__MSK               (0xFFFF0000)
+#define WDDR_BULK_HDR__COUNT__SHFT              (0x00000010)
+
+/**
+ * @brief   WDDR Telemetry Counter Commands
+ *
+ * READ             read live counter INDEX.
+ * SNAPSHOT         copy all counters atomically; response is counter count.
+ * READ_SNAPSHOT    read counter INDEX of the last snapshot.
+ * CLEAR            clear all live counters and the CSR access profile.
+ */
+#define WDDR_STATS_CMD_READ                     (0x00)
+#define WDDR_STATS_CMD_SNAPSHOT                 (0x01)
+#define WDDR_STATS_CMD_READ_SNAPSHOT            (0x02)
+#define WDDR_STATS_CMD_CLEAR                    (0x03)
+
+#define WDDR_STATS_REQ__INDEX__MSK              (0x0000FFFF)
+#define WDDR_STATS_REQ__INDEX__SHFT             (0x00000000)
+#define WDDR_STATS_REQ__CMD__MSK                (0x00030000)
+#define WDDR_STATS_REQ__CMD__SHFT               (0x00000010)
+
+/**
+ * @brief   WDDR Frequency Cache Upload Commands
+ *
+ * BEGIN    start uploading operating point OP_ID.
+ * ENTRY    header of next delta entry (OFFSET, TYPE, REP); its value follows
+ *          in a FREQ_STORE_DATA message.
+ * COMMIT   store uploaded operating point in the frequency cache.
+ */
+#define WDDR_FREQ_STORE_CMD_BEGIN               (0x00)
+#define WDDR_FREQ_STORE_CMD_ENTRY               (0x01)
+#define WDDR_FREQ_STORE_CMD_COMMIT              (0x02)
+
+#define WDDR_FREQ_STORE_REQ__OP_ID__MSK         (0x000000FF)
+#define WDDR_FREQ_STORE_REQ__OP_ID__SHFT        (0x00000000)
+#define WDDR_FREQ_STORE_REQ__OFFSET__MSK        (0x0000FFFF)
+#define WDDR_FREQ_STORE_REQ__OFFSET__SHFT       (0x00000000)
+#define WDDR_FREQ_STORE_REQ__TYPE__MSK          (0x00070000)
+#define WDDR_FREQ_STORE_REQ__TYPE__SHFT         (0x00000010)
+#define WDDR_FREQ_STORE_REQ__REP__MSK           (0x0FF00000)
+#define WDDR_FREQ_STORE_REQ__REP__SHFT          (0x00000014)
+#define WDDR_FREQ_STORE_REQ__CMD__MSK           (0x30000000)
+#define WDDR_FREQ_STORE_REQ__CMD__SHFT          (0x0000001C)
+
+#define WDDR_FREQ_STORE_RSP__STATUS__MSK        (0x000000FF)
+#define WDDR_FREQ_STORE_RSP__STATUS__SHFT       (0x00000000)
+
+#define WDDR_EYE_SCAN_REQ__VREF_AXIS__MSK       (0x00000001)
+#define WDDR_EYE_SCAN_REQ__VREF_AXIS__SHFT      (0x00000000)
+#define WDDR_EYE_SCAN_REQ__TIMING_AXIS__MSK     (0x00000006)
+#define WDDR_EYE_SCAN_REQ__TIMING_AXIS__SHFT    (0x00000001)
+#define WDDR_EYE_SCAN_REQ__CHANNEL__MSK         (0x00000008)
+#define WDDR_EYE_SCAN_REQ__CHANNEL__SHFT        (0x00000003)
+#define WDDR_EYE_SCAN_REQ__RANK_MASK__MSK       (0x000000F0)
+#define WDDR_EYE_SCAN_REQ__RANK_MASK__SHFT      (0x00000004)
+#define WDDR_EYE_SCAN_REQ__VREF_NUM__MSK        (0x00003F00)
+#define WDDR_EYE_SCAN_REQ__VREF_NUM__SHFT       (0x00000008)
+#define WDDR_EYE_SCAN_REQ__TRAIN__MSK           (0x00004000)
+#define WDDR_EYE_SCAN_REQ__TRAIN__SHFT          (0x0000000E)
+#define WDDR_EYE_SCAN_REQ__VREF_START__MSK      (0x00FF0000)
+#define WDDR_EYE_SCAN_REQ__VREF_START__SHFT     (0x00000010)
+#define WDDR_EYE_SCAN_REQ__VREF_STEP__MSK       (0xFF000000)
+#define WDDR_EYE_SCAN_REQ__VREF_STEP__SHFT      (0x00000018)
+
+#define WDDR_EYE_SCAN_RSP__STATUS__MSK          (0x000000FF)
+#define WDDR_EYE_SCAN_RSP__STATUS__SHFT         (0x00000000)
+
 // WDDR specific Boot Start Config Data
 #define WDDR_BOOT_REQ__CAL__MSK                 (0x00000001)
 #define WDDR_BOOT_REQ__CAL__SHFT                (0x00000000)
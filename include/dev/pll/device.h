@@ -15,6 +15,12 @@
 #define UNDEFINED_FREQ_ID   (255)
 #define UNDEFINED_VCO_ID    (255)
 
+/** @brief  Mask of a single PHY VCO in a PHY VCO calibration bitmask */
+#define PLL_PHY_VCO_MASK(vco_id)    (1 << ((vco_id) - VCO_INDEX_PHY_START))
+
+/** @brief  Mask of all PHY VCOs in a PHY VCO calibration bitmask */
+#define PLL_PHY_VCO_MASK_ALL        ((1 << (VCO_INDEX_PHY_END - VCO_INDEX_PHY_START)) - 1)
+
 /**
  * @brief   PLL Device Structure
  *
@@ -32,6 +38,8 @@
  *                  PLL to switch to a new frequency.
  * p_vco_prev       pointer ot the previous VCO device. Usually NULL unless
  *                  recently switched PLL to a new frequency.
+ * p_vco_parked     pointer to the PHY VCO that was replaced by the MCU VCO.
+ *                  NULL unless PLL is parked.
  */
 typedef struct pll_dev_t
 {
@@ -40,6 +48,7 @@ typedef struct pll_dev_t
     vco_dev_t   *p_vco_current;
     vco_dev_t   *p_vco_next;
     vco_dev_t   *p_vco_prev;
+    vco_dev_t   *p_vco_parked;
 } pll_dev_t;
 
 /**
@@ -83,6 +92,51 @@ void pll_boot(pll_dev_t *pll);
 void pll_prepare_vco_switch(pll_dev_t *pll,
                             uint8_t freq_id,
                             pll_freq_cfg_t *cfg);
+
+/**
+ * @brief   Phase Lock Loop (PLL) Prepare VCO Park
+ *
+ * @details Prepares PLL for a VCO switch to the MCU VCO. Once switched, the
+ *          PHY VCO can be disabled with pll_disable_vco while its
+ *          calibration is kept in the configuration table.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ *
+ * @return      void
+ */
+void pll_prepare_vco_park(pll_dev_t *pll);
+
+/**
+ * @brief   Phase Lock Loop (PLL) Prepare VCO Unpark
+ *
+ * @details Prepares PLL for a VCO switch back to the PHY VCO that was
+ *          parked, so that hardware VCO toggling stays in sync.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ * @param[in]   cfg     pointer to PLL configuration data for the parked
+ *                      frequency.
+ *
+ * @return      returns whether PLL was prepared.
+ * @retval      WDDR_SUCCESS if prepared.
+ * @retval      WDDR_ERROR if PLL isn't parked.
+ */
+wddr_return_t pll_prepare_vco_unpark(pll_dev_t *pll, pll_freq_cfg_t *cfg);
+
+/**
+ * @brief   Phase Lock Loop (PLL) Abort VCO Park
+ *
+ * @details Prepares PLL for a VCO switch back to the PHY VCO after a park
+ *          that didn't complete. PHY VCO hasn't been disabled, so it is
+ *          switched to as is.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ *
+ * @return      returns whether PLL was prepared.
+ * @retval      WDDR_SUCCESS if prepared.
+ * @retval      WDDR_ERROR if PLL isn't parked.
+ */
+wddr_return_t pll_abort_vco_park(pll_dev_t *pll);
+
 /**
  * @brief   Phase Lock Loop (PLL) Switch VCO
  *
@@ -122,15 +176,81 @@ void pll_disable_vco(pll_dev_t *pll);
  *
  * @details Calibrates all PHY VCOs for the given frequency configuration.
  *          Calibrated values are stored in the frequency calibration structure.
+ *          Same as pll_calibrate_vco_start followed by
+ *          pll_calibrate_vco_finish.
  *
  * @param[in]   pll     pointer to PLL device.
  * @param[in]   cfg     pointer to PLL configuration structure.
  *
- * @return      void
+ * @return      returns whether VCOs were calibrated.
+ * @retval      WDDR_SUCCESS if calibrated or VCOs can't be calibrated anymore.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if an FLL didn't lock.
  */
-void pll_calibrate_vco(pll_dev_t *pll,
-                       pll_freq_cfg_t *cfg);
+wddr_return_t pll_calibrate_vco(pll_dev_t *pll,
+                                pll_freq_cfg_t *cfg);
 
+/**
+ * @brief   Phase Lock Loop (PLL) Calibrate VCOs Start
+ *
+ * @details Configures and enables the FLL of all PHY VCOs for the given
+ *          frequency configuration. FLLs lock in parallel, so other work
+ *          that doesn't touch the PLL can run before
+ *          pll_calibrate_vco_finish is called.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ * @param[in]   cfg     pointer to PLL configuration structure.
+ *
+ * @return      returns whether calibration was started.
+ * @retval      true if started.
+ * @retval      false if a PHY VCO is driving the PLL.
+ */
+bool pll_calibrate_vco_start(pll_dev_t *pll,
+                             pll_freq_cfg_t *cfg);
+
+/**
+ * @brief   Phase Lock Loop (PLL) Calibrate VCOs Finish
+ *
+ * @details Waits for the FLL of all PHY VCOs to lock, disables the FLLs and
+ *          stores calibrated values in the frequency calibration structure.
+ *          Must only be called after pll_calibrate_vco_start returned true
+ *          for the same configuration.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ * @param[in]   cfg     pointer to PLL configuration structure.
+ *
+ * @return      returns whether all FLLs locked.
+ * @retval      WDDR_SUCCESS if locked.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if an FLL didn't lock; its FLL is
+ *              still disabled.
+ */
+wddr_return_t pll_calibrate_vco_finish(pll_dev_t *pll,
+                                       pll_freq_cfg_t *cfg);
+
+/**
+ * @brief   Phase Lock Loop (PLL) Calibrate Idle VCO
+ *
+ * @details Calibrates a single PHY VCO for the given frequency configuration
+ *          while another VCO drives the PLL. Calibrated values are stored in
+ *          the frequency calibration structure. Used to calibrate frequencies
+ *          on first use rather than at boot. VCO is enabled while its FLL
+ *          runs and left enabled / disabled as it was.
+ *
+ * @note    If the VCO had been prepared as next VCO, the preparation is
+ *          dropped and pll_prepare_vco_switch must be called again.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ * @param[in]   vco_id  ID of PHY VCO to calibrate.
+ * @param[in]   cfg     pointer to PLL configuration structure.
+ *
+ * @return      returns whether VCO was calibrated.
+ * @retval      WDDR_SUCCESS if calibrated.
+ * @retval      WDDR_ERROR if VCO isn't a PHY VCO or is current, previous or
+ *              parked VCO.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if FLL didn't lock.
+ */
+wddr_return_t pll_calibrate_idle_vco(pll_dev_t *pll,
+                                     uint8_t vco_id,
+                                     pll_freq_cfg_t *cfg);
 
 /**
  * @brief   Phase Lock Loop (PLL) Set Loss Lock Interrupt State
@@ -195,6 +315,21 @@ void pll_get_current_vco(pll_dev_t *pll, uint8_t *vco_id);
  */
 void pll_get_next_vco(pll_dev_t *pll, uint8_t *vco_id);
 
+/**
+ * @brief   Phase Lock Loop (PLL) Get Idle VCO
+ *
+ * @details Gets the VCO ID of the PHY VCO that isn't driving the PLL and
+ *          isn't parked. This is the VCO that pll_prepare_vco_switch
+ *          prepares. vco_id will be set to UNDEFINED_VCO_ID if there is
+ *          none.
+ *
+ * @param[in]   pll     pointer to PLL device.
+ * @param[out]  vco_id  pointer to store idle vco id.
+ *
+ * @return  void.
+ */
+void pll_get_idle_vco(pll_dev_t *pll, uint8_t *vco_id);
+
 /**
  * @brief   Phase Lock Loop (PLL) Get Current Frequency
  *
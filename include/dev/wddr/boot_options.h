@@ -26,6 +26,8 @@
 #define WDDR_BOOT_OPTION_SA_CAL__SHFT           (0x00000002)
 #define WDDR_BOOT_OPTION_TRAIN_DRAM__MSK        (0x00000008)
 #define WDDR_BOOT_OPTION_TRAIN_DRAM__SHFT       (0x00000003)
+#define WDDR_BOOT_OPTION_PLL_CAL_LAZY__MSK      (0x00000010)
+#define WDDR_BOOT_OPTION_PLL_CAL_LAZY__SHFT     (0x00000004)
 
 #define WDDR_BOOT_CONFIG_NONE                   (0x00000000)
 
@@ -18,6 +18,52 @@
 #include <wddr/table.h>
 #include "boot_options.h"
 
+/**
+ * @brief   WDDR Boot Stage Enumeration
+ *
+ * PLL_CAL      PHY VCO calibration of all frequencies.
+ * OVERRIDE     CS / CKE driver overrides.
+ * FREQ_SWITCH  software switch to boot frequency.
+ * ENABLE       LPDE / Phase Interpolator enable.
+ * CONFIGURE    PHY configuration and DFI flush.
+ * ZQCAL        IO (ZQ) calibration.
+ * SA_CAL       VREF and Sense Amp calibration / configuration.
+ * TRAINING     DRAM training.
+ * DFI_PRIME    DFI buffer prime.
+ * VCO_WALK     software switches until PHY VCO 1 is driving the PLL.
+ * DFI_MODE     hand-off to DFI mode.
+ */
+typedef enum wddr_boot_stage
+{
+    WDDR_BOOT_STAGE_PLL_CAL,
+    WDDR_BOOT_STAGE_OVERRIDE,
+    WDDR_BOOT_STAGE_FREQ_SWITCH,
+    WDDR_BOOT_STAGE_ENABLE,
+    WDDR_BOOT_STAGE_CONFIGURE,
+    WDDR_BOOT_STAGE_ZQCAL,
+    WDDR_BOOT_STAGE_SA_CAL,
+    WDDR_BOOT_STAGE_TRAINING,
+    WDDR_BOOT_STAGE_DFI_PRIME,
+    WDDR_BOOT_STAGE_VCO_WALK,
+    WDDR_BOOT_STAGE_DFI_MODE,
+    WDDR_BOOT_STAGE_NUM,
+} wddr_boot_stage_t;
+
+/**
+ * @brief   WDDR Boot Report Structure
+ *
+ * @details Timing of the last wddr_boot call. Stages that were skipped or
+ *          not reached (boot failed) read as 0.
+ *
+ * cycles   cycles spent in each stage (see wddr_boot_stage_t).
+ * total    cycles spent in wddr_boot.
+ */
+typedef struct wddr_boot_report
+{
+    uint32_t    cycles[WDDR_BOOT_STAGE_NUM];
+    uint32_t    total;
+} wddr_boot_report_t;
+
 /**
  * @brief   WDDR Structure
  *
@@ -72,7 +118,8 @@ void wddr_init(wddr_dev_t *wddr, uint32_t base, wddr_table_t *table);
  * @brief   Wavious DDR (WDDR) Boot
  *
  * @details Boots WDDR Device. This calibrates all analog devices, and
- *          configures PHY for boot frequency.
+ *          configures PHY for boot frequency. Stage timing is recorded in
+ *          the boot report (see wddr_get_boot_report).
 
  * @note    Should only be called by firmware.
  *
@@ -85,10 +132,23 @@ void wddr_init(wddr_dev_t *wddr, uint32_t base, wddr_table_t *table);
  */
 wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg);
 
+/**
+ * @brief   Wavious DDR (WDDR) Get Boot Report
+ *
+ * @details Returns per stage timing of the last boot.
+ *
+ * @return      pointer to boot report.
+ */
+const wddr_boot_report_t *wddr_get_boot_report(void);
+
 /**
  * @brief   Wavious DDR (WDDR) Prep Switch
  *
- * @details Prepares WDDR device for a frequency switch.
+ * @details Prepares WDDR device for a frequency switch. Trained values of
+ *          the given frequency are loaded if it has been trained, otherwise
+ *          the untrained table values are used. If the idle PHY VCO hasn't
+ *          been calibrated for the given frequency (lazy PLL calibration),
+ *          it is calibrated first.
  *
  * @note    Should only be called by firmware.
  *
@@ -98,12 +158,131 @@ wddr_return_t wddr_boot(wddr_dev_t *wddr, wddr_boot_cfg_t cfg);
  *
  * @return      returns whether prep completed successfully.
  * @retval      WDDR_SUCCESS if successful.
- * @retval      WDDR_ERROR otherwise.
+ * @retval      WDDR_ERROR if frequency isn't valid or PLL is parked (deep
+ *              sleep).
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if idle PHY VCO had to be calibrated
+ *              and didn't lock.
  */
 wddr_return_t wddr_prep_switch(wddr_dev_t *wddr,
                                uint8_t freq_id,
                                wddr_msr_t msr);
 
+/**
+ * @brief   Wavious DDR (WDDR) Configure PHY
+ *
+ * @details Writes the given frequency configuration into the given MSR of
+ *          all channel, common and DFI blocks. Part of wddr_prep_switch;
+ *          exposed so that it can be timed on its own.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   freq_id ID of frequency to configure.
+ * @param[in]   msr     mode switch register to configure.
+ *
+ * @return      void.
+ */
+void wddr_configure_phy(wddr_dev_t *wddr, uint8_t freq_id, wddr_msr_t msr);
+
+/**
+ * @brief   Wavious DDR (WDDR) Prep Frequency Switch MRW Update
+ *
+ * @details Prepares the DRAM mode register writes for the given frequency
+ *          and prefills them into the DFI IG FIFO. Part of wddr_prep_switch;
+ *          exposed so that it can be timed on its own.
+ *
+ * @param[in]   wddr        pointer to WDDR device.
+ * @param[in]   dfi         pointer to DFI device.
+ * @param[in]   dram_cfg    pointer to DRAM frequency configuration.
+ *
+ * @return      void.
+ */
+void wddr_prep_freq_switch_mrw_update(wddr_dev_t *wddr,
+                                      dfi_dev_t *dfi,
+                                      dram_freq_cfg_t *dram_cfg);
+
+/**
+ * @brief   Wavious DDR (WDDR) Train Current Frequency
+ *
+ * @details Trains the frequency the PHY is currently running at and marks it
+ *          as trained in the table. Trained values are stored in the
+ *          frequency configuration of the table, so they are loaded by every
+ *          subsequent wddr_prep_switch to that frequency.
+ *
+ * @note    Should only be called while the PHY owns the DFI interface (boot
+ *          or PHYMSTR).
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ *
+ * @return      returns whether training completed successfully.
+ * @retval      WDDR_SUCCESS if successful.
+ * @retval      WDDR_ERROR if training failed, is not available or PLL is
+ *              parked (deep sleep).
+ */
+wddr_return_t wddr_train_current_freq(wddr_dev_t *wddr);
+
+/**
+ * @brief   Wavious DDR (WDDR) Calibrate Idle VCO
+ *
+ * @details Calibrates the idle PHY VCO for the first frequency that it
+ *          hasn't been calibrated for. Used with lazy PLL calibration to
+ *          calibrate remaining frequencies in the background, one frequency
+ *          per call. Nothing is done while a switch is prepared or the PLL
+ *          is parked.
+ *
+ * @note    Should only be called by firmware.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ *
+ * @return      returns whether idle VCO still has frequencies to calibrate.
+ * @retval      true if another call would calibrate a frequency.
+ * @retval      false otherwise.
+ */
+bool wddr_calibrate_idle_vco(wddr_dev_t *wddr);
+
+/**
+ * @brief   Wavious DDR (WDDR) Is Frequency Trained
+ *
+ * @details Returns whether the given frequency holds trained values.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   freq_id ID of frequency to check.
+ *
+ * @return      returns whether frequency is trained.
+ * @retval      true if trained.
+ * @retval      false otherwise.
+ */
+bool wddr_is_freq_trained(wddr_dev_t *wddr, uint8_t freq_id);
+
+/**
+ * @brief   Wavious DDR (WDDR) Is Switch Prepared
+ *
+ * @details Returns whether a switch has been prepared and not yet performed.
+ *          The inactive MSR and the DFI buffer hold the prepared switch and
+ *          must not be touched until it completes.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ *
+ * @return      returns whether a switch is prepared.
+ * @retval      true if prepared.
+ * @retval      false otherwise.
+ */
+bool wddr_is_switch_prepared(wddr_dev_t *wddr);
+
+/**
+ * @brief   Wavious DDR (WDDR) Invalidate Training
+ *
+ * @details Marks trained values of the given frequency as stale so that it
+ *          is trained again on next use. The generation number is advanced
+ *          so that state derived from the old training (DQS drift baseline)
+ *          is dropped. Used when a frequency is refilled with a different
+ *          operating point.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   freq_id ID of frequency to invalidate.
+ *
+ * @return      void.
+ */
+void wddr_invalidate_training(wddr_dev_t *wddr, uint8_t freq_id);
+
 /**
  * @brief   Wavious DDR (WDDR) Software Frequency Switch
  *
@@ -119,6 +298,7 @@ wddr_return_t wddr_prep_switch(wddr_dev_t *wddr,
  * @return      returns whether switch completed sucessfully.
  * @retval      WDDR_SUCCESS if successful.
  * @retval      WDDR_ERROR if switch cannot be called.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if PLL didn't become ready.
  */
 wddr_return_t wddr_sw_freq_switch(wddr_dev_t *wddr,
                                   uint8_t freq_id,
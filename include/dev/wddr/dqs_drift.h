@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_DQS_DRIFT_H_
+#define _WDDR_DQS_DRIFT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <error.h>
+#include <wddr/device.h>
+
+/** @brief  DQS oscillator run time (MR23) in units of 16 DRAM clocks */
+#define WDDR_DQS_DRIFT_RUN_TIME         (32)
+
+/** @brief  TX DQ DDR Phase Interpolator codes per DRAM clock period */
+#define WDDR_DQS_DRIFT_PI_CODES_PER_TCK (64)
+
+/**
+ * @brief   WDDR DQS Drift Structure
+ *
+ * @details DQS interval oscillator tracking state for a single frequency.
+ *
+ * generation   training generation the baseline was captured for.
+ * base         oscillator count captured after training (0 if not captured).
+ * count        most recent oscillator count.
+ * applied      TX DQ PI code offset applied to each DQ byte since training;
+ *              less than the measured offset if the code was clamped.
+ */
+typedef struct wddr_dqs_drift
+{
+    uint32_t    generation;
+    uint16_t    base[WDDR_PHY_CHANNEL_NUM][WDDR_PHY_RANK];
+    uint16_t    count[WDDR_PHY_CHANNEL_NUM][WDDR_PHY_RANK];
+    int16_t     applied[WDDR_PHY_CHANNEL_NUM][WDDR_PHY_RANK][WDDR_PHY_DQ_BYTE_NUM];
+} wddr_dqs_drift_t;
+
+/**
+ * @brief   WDDR DQS Drift Track
+ *
+ * @details Runs the DRAM DQS interval oscillator for the given rank, reads
+ *          the count from MR18 / MR19 and compares it against the count
+ *          captured after the current frequency was trained. The change in
+ *          tDQS2DQ is applied to the TX DQ DDR Phase Interpolator codes of
+ *          all DQ bytes in the table and the active MSR. The inactive MSR is
+ *          updated first unless it holds a prepared switch; the next PREP
+ *          loads the updated codes from the table. The first call after
+ *          (re)training captures the baseline.
+ *
+ * @note    Should only be called while the PHY owns the DFI interface
+ *          (PHYMSTR).
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   rank    rank to track.
+ *
+ * @return      returns whether tracking completed successfully.
+ * @retval      WDDR_SUCCESS if successful.
+ * @retval      WDDR_ERROR if frequency isn't trained or count is invalid.
+ */
+wddr_return_t wddr_dqs_drift_track(wddr_dev_t *wddr, wddr_rank_t rank);
+
+/**
+ * @brief   WDDR DQS Drift Get State
+ *
+ * @details Returns DQS drift tracking state of the given frequency.
+ *
+ * @param[in]   freq_id     ID of frequency.
+ *
+ * @return      pointer to tracking state; NULL if freq_id is invalid.
+ */
+const wddr_dqs_drift_t *wddr_dqs_drift_get_state(uint8_t freq_id);
+
+#endif /* _WDDR_DQS_DRIFT_H_ */
@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_EYE_H_
+#define _WDDR_EYE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <error.h>
+#include <wddr/device.h>
+
+/** @brief  Number of timing codes swept per VREF step (6-bit PI / LPDE code) */
+#define WDDR_EYE_TIMING_CODE_NUM    (64)
+
+/** @brief  Number of 32-bit words in a packed pass / fail row */
+#define WDDR_EYE_ROW_WORD_NUM       (WDDR_EYE_TIMING_CODE_NUM / 32)
+
+/** @brief  Maximum number of VREF steps that can be stored for a single scan */
+#define WDDR_EYE_VREF_STEP_MAX      (32)
+
+/** @brief  Rank mask that selects all ranks */
+#define WDDR_EYE_RANK_MASK_ALL      ((1 << WDDR_PHY_RANK) - 1)
+
+/**
+ * @brief   WDDR Eye VREF Axis Enumeration
+ *
+ * DRAM     Sweep DRAM DQ VREF (MR14). Used for write eyes.
+ * PHY      Sweep PHY VREF (Common block). Used for read eyes.
+ */
+typedef enum wddr_eye_vref_axis
+{
+    WDDR_EYE_VREF_AXIS_DRAM,
+    WDDR_EYE_VREF_AXIS_PHY,
+} wddr_eye_vref_axis_t;
+
+/**
+ * @brief   WDDR Eye Timing Axis Enumeration
+ *
+ * TX_DQ_PI     Sweep TX DQ DDR Phase Interpolator code.
+ * TX_DQ_LPDE   Sweep TX DQ LPDE delay of all DQ bits in the byte.
+ * RX_RDQS_PI   Sweep RX RDQS Phase Interpolator code.
+ */
+typedef enum wddr_eye_timing_axis
+{
+    WDDR_EYE_TIMING_AXIS_TX_DQ_PI,
+    WDDR_EYE_TIMING_AXIS_TX_DQ_LPDE,
+    WDDR_EYE_TIMING_AXIS_RX_RDQS_PI,
+} wddr_eye_timing_axis_t;
+
+/**
+ * @brief   WDDR Eye Scan Configuration Structure
+ *
+ * vref_axis    which VREF is swept.
+ * timing_axis  which timing code is swept.
+ * channel      channel to scan.
+ * rank_mask    ranks to scan (bit N = rank N). All selected ranks are swept
+ *              in the same loop.
+ * vref_start   first VREF setting / code of the sweep.
+ * vref_step    increment between VREF settings / codes. Every setting of
+ *              the sweep must be a valid MR14 value (DRAM) or PHY VREF
+ *              code (PHY).
+ * vref_num     number of VREF steps (<= WDDR_EYE_VREF_STEP_MAX).
+ * train        flag to save eye center of each rank / byte at the selected
+ *              VREF to the table instead of restoring timing codes.
+ */
+typedef struct wddr_eye_scan_cfg
+{
+    wddr_eye_vref_axis_t    vref_axis;
+    wddr_eye_timing_axis_t  timing_axis;
+    wddr_channel_t          channel;
+    uint8_t                 rank_mask;
+    uint16_t                vref_start;
+    uint16_t                vref_step;
+    uint8_t                 vref_num;
+    bool                    train;
+} wddr_eye_scan_cfg_t;
+
+/**
+ * @brief   WDDR Eye Map Structure
+ *
+ * @details Packed pass / fail matrix for a single DQ byte. Bit N of row R is
+ *          set if timing code N passed at VREF step R.
+ *
+ * row      packed pass / fail rows; one row per VREF step.
+ * width    widest contiguous passing run in each row.
+ * center   center timing code of the widest run in each row.
+ */
+typedef struct wddr_eye_map
+{
+    uint32_t row[WDDR_EYE_VREF_STEP_MAX][WDDR_EYE_ROW_WORD_NUM];
+    uint8_t  width[WDDR_EYE_VREF_STEP_MAX];
+    uint8_t  center[WDDR_EYE_VREF_STEP_MAX];
+} wddr_eye_map_t;
+
+/**
+ * @brief   WDDR Eye Structure
+ *
+ * @details Result of the most recent eye scan.
+ *
+ * valid        flag to indicate that the scan completed.
+ * cfg          configuration used for the scan.
+ * best_row     VREF step with the widest eye (common to all ranks / bytes).
+ * best_vref    VREF setting / code of best_row.
+ * best_width   narrowest per-rank / per-byte eye width at best_row.
+ * map          per rank, per DQ byte pass / fail matrices.
+ */
+typedef struct wddr_eye
+{
+    bool                valid;
+    wddr_eye_scan_cfg_t cfg;
+    uint8_t             best_row;
+    uint16_t            best_vref;
+    uint8_t             best_width;
+    wddr_eye_map_t      map[WDDR_PHY_RANK][WDDR_PHY_DQ_BYTE_NUM];
+} wddr_eye_t;
+
+/**
+ * @brief   WDDR Eye Test Function
+ *
+ * @details Pass / fail test executed for every (VREF, timing) point. A
+ *          single call tests every rank in cfg->rank_mask, so that all
+ *          ranks can share one DFI buffer fill and one FIFO readback.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   cfg     pointer to scan configuration.
+ * @param[in]   ctx     user supplied context.
+ * @param[out]  pass    per rank bitmask of DQ bytes that passed
+ *                      (bit N = DQ byte N).
+ *
+ * @return      returns whether test could be run; scan is aborted if not.
+ * @retval      WDDR_SUCCESS if test ran.
+ * @retval      WDDR_ERROR otherwise.
+ */
+typedef wddr_return_t (*wddr_eye_test_t)(wddr_dev_t *wddr,
+                                         const wddr_eye_scan_cfg_t *cfg,
+                                         void *ctx,
+                                         uint8_t pass[WDDR_PHY_RANK]);
+
+/**
+ * @brief   WDDR Eye Scan
+ *
+ * @details Sweeps VREF against the timing code for all DQ bytes of the given
+ *          channel and ranks, recording the pass / fail matrix of each rank
+ *          and byte. Ranks are interleaved within the sweep: each timing
+ *          step is programmed for all ranks and tested once. VREF is shared
+ *          by all ranks and bytes, so the VREF step whose narrowest eye is
+ *          widest is selected. The selected VREF is programmed and stored
+ *          in the configuration table of the current frequency. Timing codes
+ *          are restored to their table values, or set to the eye centers if
+ *          cfg->train is set.
+ *
+ * @note    Should only be called while the PHY owns the DFI interface (boot,
+ *          training or PHYMSTR).
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   cfg     pointer to scan configuration.
+ * @param[in]   test    pass / fail test function.
+ * @param[in]   ctx     context passed to the test function.
+ *
+ * @return      returns whether an eye was found.
+ * @retval      WDDR_SUCCESS if a passing VREF was found.
+ * @retval      WDDR_ERROR if configuration is invalid (including a VREF out
+ *              of range or a channel the test doesn't support), the test
+ *              failed or no point passed.
+ */
+wddr_return_t wddr_eye_scan(wddr_dev_t *wddr,
+                            const wddr_eye_scan_cfg_t *cfg,
+                            wddr_eye_test_t test,
+                            void *ctx);
+
+/**
+ * @brief   WDDR Eye Scan Start
+ *
+ * @details Starts an eye scan that is run one VREF step (row) at a time, so
+ *          that the rows can be spread over several PHYMSTR windows. Checks
+ *          the configuration and clears the previous result. wddr_eye_scan
+ *          is wddr_eye_scan_start, wddr_eye_scan_row for every row and
+ *          wddr_eye_scan_finish.
+ *
+ * @note    Rows must be scanned at the frequency the scan was started at;
+ *          start again if the frequency changed.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   cfg     pointer to scan configuration; copied.
+ * @param[in]   test    pass / fail test function.
+ * @param[in]   ctx     context passed to the test function.
+ *
+ * @return      returns whether scan was started.
+ * @retval      WDDR_SUCCESS if started.
+ * @retval      WDDR_ERROR if configuration is invalid or PLL is parked
+ *              (deep sleep).
+ */
+wddr_return_t wddr_eye_scan_start(wddr_dev_t *wddr,
+                                  const wddr_eye_scan_cfg_t *cfg,
+                                  wddr_eye_test_t test,
+                                  void *ctx);
+
+/**
+ * @brief   WDDR Eye Scan Row
+ *
+ * @details Sweeps the timing code at one VREF step of the started scan and
+ *          records its pass / fail row. VREF and timing codes are restored
+ *          before returning, so the bus can be handed back between rows.
+ *
+ * @note    Should only be called while the PHY owns the DFI interface.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   row     VREF step to scan; rows must be scanned in order.
+ *
+ * @return      returns whether row was scanned.
+ * @retval      WDDR_SUCCESS if scanned.
+ * @retval      WDDR_ERROR if no scan was started, row is out of order or
+ *              the test failed.
+ */
+wddr_return_t wddr_eye_scan_row(wddr_dev_t *wddr, uint8_t row);
+
+/**
+ * @brief   WDDR Eye Scan Finish
+ *
+ * @details Ends a scan whose rows were all scanned. Marks the result valid,
+ *          then programs the selected VREF and, if cfg->train is set, the
+ *          eye centers, and stores them in the table as wddr_eye_scan does.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ *
+ * @return      returns whether an eye was found.
+ * @retval      WDDR_SUCCESS if a passing VREF was found.
+ * @retval      WDDR_ERROR if rows are missing or no point passed.
+ */
+wddr_return_t wddr_eye_scan_finish(wddr_dev_t *wddr);
+
+/**
+ * @brief   WDDR Eye FIFO Test
+ *
+ * @details Built-in pass / fail test for wddr_eye_scan. Writes a pattern to
+ *          the DRAM write FIFO (WRFIFO) of every selected rank and reads it
+ *          back (RDFIFO). The sequences of all ranks are placed back to back
+ *          in a single DFI buffer fill and read back from the EG FIFO in
+ *          rank order.
+ *
+ * @note    Only DQ bytes of channel 0 can be compared by the RX packet
+ *          helpers; other channels are rejected.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   cfg     pointer to scan configuration.
+ * @param[in]   ctx     pointer to command_data_t pattern, or NULL to use a
+ *                      default pattern.
+ * @param[out]  pass    per rank bitmask of DQ bytes that passed.
+ *
+ * @return      returns whether test could be run.
+ * @retval      WDDR_SUCCESS if pattern was written and read back.
+ * @retval      WDDR_ERROR if channel isn't supported or DFI buffer failed.
+ */
+wddr_return_t wddr_eye_fifo_test(wddr_dev_t *wddr,
+                                 const wddr_eye_scan_cfg_t *cfg,
+                                 void *ctx,
+                                 uint8_t pass[WDDR_PHY_RANK]);
+
+/**
+ * @brief   WDDR Eye Get Result
+ *
+ * @details Returns the result of the most recent eye scan.
+ *
+ * @return      pointer to eye scan result.
+ */
+const wddr_eye_t *wddr_eye_get_result(void);
+
+/**
+ * @brief   WDDR Eye Read Word
+ *
+ * @details Reads a single packed word of an eye map. Used to transfer eye
+ *          maps in chunks. Safe to call from another task; reads are
+ *          rejected while a scan is in progress.
+ *
+ * @param[in]   rank    rank of the map.
+ * @param[in]   byte    DQ byte of the map.
+ * @param[in]   row     VREF step of the map.
+ * @param[in]   word    word index within the row.
+ * @param[out]  data    pointer to store packed word.
+ *
+ * @return      returns whether word could be read.
+ * @retval      WDDR_SUCCESS if word read.
+ * @retval      WDDR_ERROR if no valid scan, a scan is in progress or indices
+ *              are out of range.
+ */
+wddr_return_t wddr_eye_read_word(uint8_t rank,
+                                 uint8_t byte,
+                                 uint8_t row,
+                                 uint8_t word,
+                                 uint32_t *data);
+
+#endif /* _WDDR_EYE_H_ */
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_FREQ_CACHE_H_
+#define _WDDR_FREQ_CACHE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <error.h>
+#include <wddr/device.h>
+
+/**
+ * @brief   Frequency Cache Operating Point Number
+ *
+ * @details Number of operating points the store can hold. Operating points
+ *          0 to WDDR_PHY_FREQ_NUM - 1 are the frequencies of the packed
+ *          table; the rest are uploaded.
+ */
+#define WDDR_FREQ_CACHE_OP_NUM      (16)
+
+/**
+ * @brief   Frequency Cache Pool Number
+ *
+ * @details Number of delta entries (8 bytes each) the store can hold for all
+ *          uploaded operating points together.
+ */
+#define WDDR_FREQ_CACHE_POOL_NUM    (1024)
+
+/** @brief  Operating point ID of a frequency that doesn't hold one */
+#define WDDR_FREQ_CACHE_OP_NONE     (0xFF)
+
+/**
+ * @brief   Frequency Cache Initialization
+ *
+ * @details Loads the frequencies of the packed table as operating points
+ *          0 to WDDR_PHY_FREQ_NUM - 1. Must be called after the table has
+ *          been unpacked; frequency N of the table holds operating point N.
+ *
+ * @return      void.
+ */
+void wddr_freq_cache_init(void);
+
+/**
+ * @brief   Frequency Cache Get
+ *
+ * @details Returns the table frequency that holds an operating point. On a
+ *          miss, the least recently used frequency other than the current
+ *          one (or the one the PLL is parked from) is refilled from the
+ *          store: its configuration is unpacked, its training is invalidated
+ *          and its PHY VCOs are marked as not calibrated (calibrated on use
+ *          by wddr_prep_switch).
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   op_id   operating point to get.
+ * @param[out]  freq_id pointer to store table frequency.
+ * @param[out]  hit     pointer to store whether operating point was expanded.
+ *
+ * @return      returns whether operating point could be served.
+ * @retval      WDDR_SUCCESS if served.
+ * @retval      WDDR_ERROR if operating point isn't valid.
+ */
+wddr_return_t wddr_freq_cache_get(wddr_dev_t *wddr,
+                                  uint8_t op_id,
+                                  uint8_t *freq_id,
+                                  bool *hit);
+
+/**
+ * @brief   Frequency Cache Store
+ *
+ * @details Copies an operating point into the store, replacing any
+ *          previous version. A table frequency that holds the previous
+ *          version is dropped from the cache unless it is the current (or
+ *          parked) frequency.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ * @param[in]   op_id   operating point to store; must not be a frequency of
+ *                      the packed table.
+ * @param[in]   delta   pointer to delta entries.
+ * @param[in]   num     number of delta entries.
+ *
+ * @return      returns whether operating point was stored.
+ * @retval      WDDR_SUCCESS if stored.
+ * @retval      WDDR_ERROR if op_id is out of range, an entry isn't valid,
+ *              the store is full or the current frequency holds op_id.
+ */
+wddr_return_t wddr_freq_cache_store(wddr_dev_t *wddr,
+                                    uint8_t op_id,
+                                    const wddr_table_entry_t *delta,
+                                    uint16_t num);
+
+#endif /* _WDDR_FREQ_CACHE_H_ */
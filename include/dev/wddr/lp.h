@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_LP_H_
+#define _WDDR_LP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <error.h>
+#include <wddr/device.h>
+
+/**
+ * @brief   WDDR LP Wakeup Thresholds
+ *
+ * @details Minimum DFI wakeup encoding required to enter each power saving
+ *          level. Wakeup encoding n allows 2^(n + 4) DFI clocks to wake up
+ *          (DFI_LP_WAKEUP_UNLIMITED is unlimited), so deeper levels are only
+ *          entered when the controller tolerates their exit latency.
+ *
+ * CLK_GATE     PHY clocks are gated (both interfaces idle).
+ * ANALOG       VREF and DQS receivers are turned off (LP_DATA).
+ * DRAM_PD      DRAM is put into Power Down (LP_CTRL).
+ * DEEP_SLEEP   DRAM is put into Self-Refresh and PHY VCO is turned off
+ *              (both interfaces idle).
+ */
+#define WDDR_LP_WAKEUP_CLK_GATE     (6)
+#define WDDR_LP_WAKEUP_ANALOG       (10)
+#define WDDR_LP_WAKEUP_DRAM_PD      (12)
+#define WDDR_LP_WAKEUP_DEEP_SLEEP   (14)
+
+/**
+ * @brief   WDDR LP Allow Flags
+ *
+ * @details Levels that change DRAM state must be explicitly allowed.
+ *
+ * DRAM_PD      DRAM Power Down is allowed.
+ * DEEP_SLEEP   Self-Refresh deep sleep is allowed.
+ */
+#define WDDR_LP_ALLOW_DRAM_PD       (1 << 0)
+#define WDDR_LP_ALLOW_DEEP_SLEEP    (1 << 1)
+
+/**
+ * @brief   WDDR LP Level Flags
+ *
+ * @details Power saving levels the PHY is in (see wddr_lp_get_levels).
+ */
+#define WDDR_LP_LEVEL_CLK_GATE      (1 << 0)
+#define WDDR_LP_LEVEL_ANALOG        (1 << 1)
+#define WDDR_LP_LEVEL_DRAM_PD       (1 << 2)
+#define WDDR_LP_LEVEL_DEEP_SLEEP    (1 << 3)
+
+/**
+ * @brief   WDDR LP State Structure
+ *
+ * active       flag per interface to indicate that LP request is asserted.
+ * wakeup       wakeup encoding of the active request per interface.
+ * clk_gated    flag to indicate that PHY clocks are gated.
+ * analog_off   flag to indicate that VREF and receivers are off.
+ * dram_pd      flag to indicate that DRAM is in Power Down.
+ * deep_sleep   flag to indicate that DRAM is in Self-Refresh and PLL is
+ *              parked on the MCU VCO.
+ * clk_gate_count   number of times clocks were gated.
+ * analog_count     number of times analog blocks were turned off.
+ * dram_pd_count    number of times DRAM entered Power Down.
+ * deep_sleep_count number of times deep sleep was entered.
+ */
+typedef struct wddr_lp_state
+{
+    bool        active[DFI_LP_IF_NUM];
+    uint8_t     wakeup[DFI_LP_IF_NUM];
+    bool        clk_gated;
+    bool        analog_off;
+    bool        dram_pd;
+    bool        deep_sleep;
+    uint32_t    clk_gate_count;
+    uint32_t    analog_count;
+    uint32_t    dram_pd_count;
+    uint32_t    deep_sleep_count;
+} wddr_lp_state_t;
+
+/**
+ * @brief   WDDR LP Request
+ *
+ * @details Updates request state of the given DFI low power interface and
+ *          moves the PHY to the deepest power saving level allowed by all
+ *          active requests. Levels are exited in reverse order of entry, so
+ *          the PHY is fully operational when this returns for a deasserted
+ *          request.
+ *
+ *          Deep sleep keeps MSR contents and calibration; exit relocks the
+ *          parked PHY VCO and takes DRAM out of Self-Refresh (SRX + tXSR).
+ *
+ * @note    Must only be called while DFI interface is idle (no PHYMSTR,
+ *          PHYUPD or frequency switch in progress), as DRAM Power Down uses
+ *          the DFI buffer.
+ *
+ * @param[in]   wddr            pointer to WDDR device.
+ * @param[in]   intf            low power interface.
+ * @param[in]   req             flag to indicate if request is asserted.
+ * @param[in]   wakeup          wakeup encoding of the request.
+ * @param[in]   allow           levels that are allowed (WDDR_LP_ALLOW_*).
+ *
+ * @return      returns whether request was handled.
+ * @retval      WDDR_SUCCESS if successful.
+ * @retval      WDDR_ERROR if interface is invalid or PLL can't be parked /
+ *              unparked.
+ * @retval      WDDR_ERROR_POLL_TIMEOUT if PLL didn't become ready.
+ *
+ *              If deep sleep entry fails, the request is dropped and the
+ *              PHY is left in the levels it was in without it. If deep
+ *              sleep exit fails, the PHY is left in deep sleep.
+ */
+wddr_return_t wddr_lp_request(wddr_dev_t *wddr,
+                              dfi_lp_if_t intf,
+                              bool req,
+                              uint8_t wakeup,
+                              uint8_t allow);
+
+/**
+ * @brief   WDDR LP Get State
+ *
+ * @details Returns low power state of the PHY.
+ *
+ * @return      pointer to low power state.
+ */
+const wddr_lp_state_t *wddr_lp_get_state(void);
+
+/**
+ * @brief   WDDR LP Get Levels
+ *
+ * @details Returns power saving levels the PHY is in.
+ *
+ * @return      mask of WDDR_LP_LEVEL_* flags.
+ */
+uint8_t wddr_lp_get_levels(void);
+
+#endif /* _WDDR_LP_H_ */
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_TABLE_PACK_H_
+#define _WDDR_TABLE_PACK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <wddr/table.h>
+
+/**
+ * @brief   WDDR Table Unpack
+ *
+ * @details Expands the packed configuration table (table_pack_vals.h,
+ *          generated by tools/table_pack.py) into a WDDR table. The packed
+ *          table stores a single baseline frequency plus per-frequency
+ *          deltas, without zero fields and with fields that are equal for
+ *          all channels, DQ bytes and / or ranks stored once. Pointers
+ *          into the table are relocated to the given table.
+ *
+ * @note    Table must be zero initialized (i.e. live in .bss). Unpacking
+ *          is done once at boot; the result is identical to the table
+ *          declared with DECLARE_WDDR_TABLE.
+ *
+ * @param[in]   table   pointer to WDDR table to unpack into.
+ *
+ * @return      void.
+ */
+void wddr_table_unpack(wddr_table_t *table);
+
+/**
+ * @brief   WDDR Table Unpack Frequency
+ *
+ * @details Replaces the frequency configuration of a single frequency with
+ *          the packed baseline plus the given delta entries. Delta entries
+ *          use the replication sets of the packed table. Training and VCO
+ *          calibration state of the frequency are left untouched.
+ *
+ * @param[in]   table   pointer to WDDR table.
+ * @param[in]   freq_id frequency to unpack into.
+ * @param[in]   delta   pointer to delta entries.
+ * @param[in]   num     number of delta entries.
+ *
+ * @return      void.
+ */
+void wddr_table_unpack_freq(wddr_table_t *table,
+                            uint8_t freq_id,
+                            const wddr_table_entry_t *delta,
+                            uint16_t num);
+
+/**
+ * @brief   WDDR Table Get Packed Delta
+ *
+ * @details Returns the delta entries of a frequency of the packed table.
+ *
+ * @param[in]   freq_id frequency of packed table.
+ * @param[out]  delta   pointer to store pointer to delta entries.
+ * @param[out]  num     pointer to store number of delta entries.
+ *
+ * @return      returns whether frequency is valid in packed table.
+ * @retval      true if frequency is valid.
+ * @retval      false otherwise.
+ */
+bool wddr_table_get_packed_delta(uint8_t freq_id,
+                                 const wddr_table_entry_t **delta,
+                                 uint16_t *num);
+
+/**
+ * @brief   WDDR Table Entry Is Valid
+ *
+ * @details Checks that an entry (i.e. one received from the host) can be
+ *          applied to a frequency configuration: known type and
+ *          replication set, aligned, all replicas within the frequency
+ *          configuration and pointer targets within the table.
+ *
+ * @param[in]   entry   pointer to entry to check.
+ *
+ * @return      returns whether entry is valid.
+ * @retval      true if entry is valid.
+ * @retval      false otherwise.
+ */
+bool wddr_table_entry_is_valid(const wddr_table_entry_t *entry);
+
+#endif /* _WDDR_TABLE_PACK_H_ */
@@ -6,6 +6,7 @@
 #ifndef _CMN_PMON_H_
 #define _CMN_PMON_H_
 
+#include <stdbool.h>
 #include "cmn_reg.h"
 
 /**
@@ -55,8 +56,10 @@ void cmn_pmon_configure_reg_if(cmn_reg_t *cmn_reg,
  * @param[in]   cmn_reg     pointer to CTRL register space.
  * @param[out]  count       pointer to store current status count.
  *
- * @return  void
+ * @return  returns whether PMON count completed.
+ * @retval  true if completed.
+ * @retval  false if count didn't complete in time.
  */
-void cmn_pmon_get_status_count_reg_if(cmn_reg_t *cmn_reg, uint32_t *count);
+bool cmn_pmon_get_status_count_reg_if(cmn_reg_t *cmn_reg, uint32_t *count);
 
 #endif /* _CMN_PMON_H_ */
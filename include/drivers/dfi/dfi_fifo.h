@@ -116,9 +116,11 @@ void dfi_fifo_set_wdata_hold_reg_if(dfich_reg_t *dfich_reg, bool enable);
  *
  * @param[in]   dfich_reg   pointer to DFICH register space.
  *
- * @return      void
+ * @return      returns whether IG FIFO drained.
+ * @retval      DFI_SUCCESS if IG FIFO is empty.
+ * @retval      DFI_ERROR_TIMEOUT if IG FIFO didn't drain in time.
  */
-void dfi_fifo_send_packets_reg_if(dfich_reg_t *dfich_reg);
+dfi_return_t dfi_fifo_send_packets_reg_if(dfich_reg_t *dfich_reg);
 
 /**
  * @brief   DFI FIFO Write IG FIFO Register Interface
@@ -7,6 +7,7 @@
 #define _DFI_INTF_H_
 
 #include "dfi_reg.h"
+#include "dfi_ret.h"
 
 /**
  * @brief   DFI PHYMSTR Type Enumerations
@@ -88,6 +89,22 @@ typedef enum dfi_phyupd_type
     DFI_PHYUPD_TYPE_3
 } dfi_phyupd_type_t;
 
+/**
+ * @brief   DFI Low Power Interface Enumerations
+ *
+ * CTRL     LP_CTRL interface (command / control).
+ * DATA     LP_DATA interface (data path).
+ */
+typedef enum dfi_lp_if
+{
+    DFI_LP_IF_CTRL,
+    DFI_LP_IF_DATA,
+    DFI_LP_IF_NUM,
+} dfi_lp_if_t;
+
+/** @brief  DFI LP wakeup encoding meaning wakeup time is unlimited */
+#define DFI_LP_WAKEUP_UNLIMITED     (19)
+
 /**
  * @brief   DFI Set Init Complete Override Register Interface
  *
@@ -146,6 +163,28 @@ uint8_t dfi_get_init_start_status_reg_if(dfi_reg_t *dfi_reg);
  */
 uint8_t dfi_get_init_complete_status_reg_if(dfi_reg_t *dfi_reg);
 
+/**
+ * @brief   DFI Init Start Low Poll Condition
+ *
+ * @details wddr_poll condition shared by all INIT_START waits.
+ *
+ * @param[in]   ctx     pointer to DFI register space.
+ *
+ * @return      returns whether init_start is deasserted (low).
+ */
+bool dfi_init_start_low_cond(void *ctx);
+
+/**
+ * @brief   DFI Init Complete Set Poll Condition
+ *
+ * @details wddr_poll condition shared by all INIT_COMPLETE waits.
+ *
+ * @param[in]   ctx     pointer to DFI register space.
+ *
+ * @return      returns whether init_complete is asserted (high).
+ */
+bool dfi_init_complete_set_cond(void *ctx);
+
 /**
  * @brief   DFI PHYMSTR Request Assert Register Interface
  *
@@ -161,24 +200,30 @@ void dfi_phymstr_req_assert_reg_if(dfi_reg_t *dfi_reg,
 /**
  * @brief   DFI PHYMSTR Request Deassert Register Interface
  *
- * @details Deasserts PHYMSTR REQ to the Memory Controller.
+ * @details Deasserts PHYMSTR REQ to the Memory Controller and waits for
+ *          PHYMSTR ACK to go low.
  *
  * @param[in]   dfi_reg     pointer to DFI register space.
  *
- * @return      void.
+ * @return      returns whether PHYMSTR ACK went low.
+ * @retval      DFI_SUCCESS if ACK is low.
+ * @retval      DFI_ERROR_TIMEOUT if ACK didn't go low in time.
  */
-void dfi_phymstr_req_deassert_reg_if(dfi_reg_t *dfi_reg);
+dfi_return_t dfi_phymstr_req_deassert_reg_if(dfi_reg_t *dfi_reg);
 
 /**
  * @brief   DFI CTRLUPD Deassert Acknowledge Register Interface
  *
- * @details Deasserts CTRLUPD ACK to the Memory Controller.
+ * @details Deasserts CTRLUPD ACK to the Memory Controller and waits for
+ *          CTRLUPD REQ to go low.
  *
  * @param[in]   dfi_reg     pointer to DFI register space.
  *
- * @return      void.
+ * @return      returns whether CTRLUPD REQ went low.
+ * @retval      DFI_SUCCESS if REQ is low.
+ * @retval      DFI_ERROR_TIMEOUT if REQ didn't go low in time.
  */
-void dfi_ctrlupd_deassert_ack_reg_if(dfi_reg_t *dfi_reg);
+dfi_return_t dfi_ctrlupd_deassert_ack_reg_if(dfi_reg_t *dfi_reg);
 
 /**
  * @brief   DFI CTRLUPD ACK Override Register Interface
@@ -212,12 +257,50 @@ void dfi_phyupd_req_assert_reg_if(dfi_reg_t *dfi_reg,
 /**
  * @brief   DFI PHYUPD Request Deassert Register Interface
  *
- * @details Deasserts PHYUPD REQ to the Memory Controller.
+ * @details Deasserts PHYUPD REQ to the Memory Controller and waits for
+ *          PHYUPD ACK to go low.
  *
  * @param[in]   dfi_reg     pointer to DFI register space.
  *
- * @return      void.
+ * @return      returns whether PHYUPD ACK went low.
+ * @retval      DFI_SUCCESS if ACK is low.
+ * @retval      DFI_ERROR_TIMEOUT if ACK didn't go low in time.
+ */
+dfi_return_t dfi_phyupd_req_deassert_reg_if(dfi_reg_t *dfi_reg);
+
+/**
+ * @brief   DFI LP ACK Override Register Interface
+ *
+ * @details Overrides acknowledge signal of the given DFI low power interface.
+ *
+ * @param[in]   dfi_reg     pointer to DFI register space.
+ * @param[in]   intf        low power interface.
+ * @param[in]   override    flag to indicate if SW should override.
+ * @param[in]   val         value to override.
+ *
+ * @return      void
+ */
+void dfi_lp_ack_override_reg_if(dfi_reg_t *dfi_reg,
+                                dfi_lp_if_t intf,
+                                bool override,
+                                uint8_t val);
+
+/**
+ * @brief   DFI LP Get Status Register Interface
+ *
+ * @details Gets REQ and WAKEUP signal state of the given DFI low power
+ *          interface.
+ *
+ * @param[in]   dfi_reg     pointer to DFI register space.
+ * @param[in]   intf        low power interface.
+ * @param[out]  req         pointer to store REQ state.
+ * @param[out]  wakeup      pointer to store WAKEUP encoding.
+ *
+ * @return      void
  */
-void dfi_phyupd_req_deassert_reg_if(dfi_reg_t *dfi_reg);
+void dfi_lp_get_status_reg_if(dfi_reg_t *dfi_reg,
+                              dfi_lp_if_t intf,
+                              uint8_t *req,
+                              uint8_t *wakeup);
 
 #endif /* _DFI_INTF_H_ */
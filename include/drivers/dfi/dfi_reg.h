@@ -10,6 +10,9 @@
 /* Standard includes. */
 #include <stdint.h>
 
+/* LPDDR includes. */
+#include <wddr/csr_shadow.h>
+
 /**
  * @brief   DFI Register Layout
  *
@@ -14,12 +14,14 @@
  * ERROR                general error.
  * ERROR_FIFO_FULL      error that fifo is full.
  * ERROR_FIFO_EMPTY     error that fifo is empty.
+ * ERROR_TIMEOUT        error that hardware wait timed out.
  */
 typedef enum {
     DFI_SUCCESS,
     DFI_ERROR,
     DFI_ERROR_FIFO_FULL,
     DFI_ERROR_FIFO_EMPTY,
+    DFI_ERROR_TIMEOUT,
 } dfi_return_t;
 
 #endif /* _DFI_RET_H_ */
@@ -28,8 +28,10 @@ void fsw_csp_set_clk_disable_over_val_reg_if(fsw_reg_t *fsw_reg,
  *
  * @param[in]   fsw_reg pointer to frequency switch register space.
  *
- * @return  void
+ * @return  returns whether sync completed.
+ * @retval  true if completed.
+ * @retval  false if request didn't complete in time.
  */
-void fsw_csp_sync_reg_if(fsw_reg_t *fsw_reg);
+bool fsw_csp_sync_reg_if(fsw_reg_t *fsw_reg);
 
 #endif /* _FSW_CSP_H_ */
@@ -152,4 +152,17 @@ bool vco_is_fll_locked(vco_dev_t *vco);
  */
 void vco_set_enable_reg_if(vco_dev_t *vco, bool enable);
 
+/**
+ * @brief   VCO Get Enable Register Interface
+ *
+ * @details Returns whether VCO device is enabled.
+ *
+ * @param[in]   vco         pointer to VCO device.
+ *
+ * @return      Returns whether VCO device is enabled.
+ * @retval      true, if enabled.
+ * @retval      false if not.
+ */
+bool vco_get_enable_reg_if(vco_dev_t *vco);
+
 #endif /* _VCO_DRIVER_H_ */
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_CSR_PROFILE_H_
+#define _WDDR_CSR_PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief   CSR Profile Module Enumeration
+ *
+ * @details Register block an access is attributed to. Decoded from the
+ *          register address.
+ *
+ * CA       CA slices of all channels.
+ * DQ       DQ bytes of all channels.
+ * DFI      DFI and DFI channel blocks.
+ * CMN      Common analog block.
+ * PLL      MVP PLL including VCOs.
+ * FSW      Frequency switch block.
+ * OTHER    CTRL block and any address not decoded above.
+ */
+typedef enum csr_profile_module
+{
+    CSR_PROFILE_MODULE_CA,
+    CSR_PROFILE_MODULE_DQ,
+    CSR_PROFILE_MODULE_DFI,
+    CSR_PROFILE_MODULE_CMN,
+    CSR_PROFILE_MODULE_PLL,
+    CSR_PROFILE_MODULE_FSW,
+    CSR_PROFILE_MODULE_OTHER,
+    CSR_PROFILE_MODULE_NUM,
+} csr_profile_module_t;
+
+/**
+ * @brief   CSR Profile Phase Enumeration
+ *
+ * @details Phase an access is attributed to; declared by the caller with
+ *          csr_profile_set_phase.
+ *
+ * IDLE         accesses outside of a declared phase (runtime services).
+ * BOOT         PHY boot sequence.
+ * PREP         frequency switch preparation.
+ * ZQCAL        IO (ZQ) calibration.
+ * SA_CAL       Sense Amp calibration.
+ * TRAINING     DRAM training.
+ */
+typedef enum csr_profile_phase
+{
+    CSR_PROFILE_PHASE_IDLE,
+    CSR_PROFILE_PHASE_BOOT,
+    CSR_PROFILE_PHASE_PREP,
+    CSR_PROFILE_PHASE_ZQCAL,
+    CSR_PROFILE_PHASE_SA_CAL,
+    CSR_PROFILE_PHASE_TRAINING,
+    CSR_PROFILE_PHASE_NUM,
+} csr_profile_phase_t;
+
+/** @brief  Number of entries in the CSR profile table */
+#define CSR_PROFILE_ENTRY_NUM   (CSR_PROFILE_PHASE_NUM * CSR_PROFILE_MODULE_NUM)
+
+/**
+ * @brief   CSR Profile Entry Structure
+ *
+ * @details Accesses of a single module during a single phase. Cycles are
+ *          measured around the access macro, so shadow hits are included
+ *          at their (lower) cost.
+ *
+ * reads            number of register reads.
+ * writes           number of register writes.
+ * read_cycles      total cycles spent in register reads.
+ * write_cycles     total cycles spent in register writes.
+ */
+typedef struct csr_profile_entry
+{
+    uint32_t    reads;
+    uint32_t    writes;
+    uint32_t    read_cycles;
+    uint32_t    write_cycles;
+} csr_profile_entry_t;
+
+#if CONFIG_CSR_PROFILE
+/**
+ * @brief   CSR Profile Read
+ *
+ * @details Reads a configuration register (through the shadow if enabled)
+ *          and records the access.
+ *
+ * @param[in]   reg     pointer to register.
+ *
+ * @return      register value.
+ */
+uint32_t csr_profile_read(volatile uint32_t *reg);
+
+/**
+ * @brief   CSR Profile Read Status
+ *
+ * @details Reads a status register directly from the bus and records the
+ *          access.
+ *
+ * @param[in]   reg     pointer to register.
+ *
+ * @return      register value.
+ */
+uint32_t csr_profile_read_sta(volatile uint32_t *reg);
+
+/**
+ * @brief   CSR Profile Write
+ *
+ * @details Writes a configuration register (through the shadow if enabled)
+ *          and records the access.
+ *
+ * @param[in]   reg     pointer to register.
+ * @param[in]   val     value to write.
+ * @param[in]   force   flag to indicate if write must not be filtered.
+ *
+ * @return      void.
+ */
+void csr_profile_write(volatile uint32_t *reg, uint32_t val, bool force);
+
+/**
+ * @brief   CSR Profile Set Phase
+ *
+ * @details Declares phase subsequent accesses are attributed to. Phases
+ *          nest by restoring the returned phase when done:
+ *
+ *              prev = csr_profile_set_phase(CSR_PROFILE_PHASE_ZQCAL);
+ *              ...
+ *              csr_profile_set_phase(prev);
+ *
+ * @param[in]   phase   phase to enter.
+ *
+ * @return      phase that was active before.
+ */
+csr_profile_phase_t csr_profile_set_phase(csr_profile_phase_t phase);
+
+/**
+ * @brief   CSR Profile Read Entry
+ *
+ * @param[in]   index   entry index (phase * CSR_PROFILE_MODULE_NUM + module).
+ * @param[out]  entry   pointer to store entry.
+ *
+ * @return      returns whether entry could be read.
+ * @retval      true if index is in range.
+ * @retval      false otherwise.
+ */
+bool csr_profile_read_entry(uint16_t index, csr_profile_entry_t *entry);
+
+/**
+ * @brief   CSR Profile Clear
+ *
+ * @details Clears all entries. Declared phase is unchanged.
+ *
+ * @return      void.
+ */
+void csr_profile_clear(void);
+#else
+static inline csr_profile_phase_t csr_profile_set_phase(csr_profile_phase_t phase)
+{
+    return CSR_PROFILE_PHASE_IDLE;
+}
+
+static inline bool csr_profile_read_entry(uint16_t index, csr_profile_entry_t *entry)
+{
+    return false;
+}
+
+static inline void csr_profile_clear(void) {}
+#endif /* CONFIG_CSR_PROFILE */
+
+#endif /* _WDDR_CSR_PROFILE_H_ */
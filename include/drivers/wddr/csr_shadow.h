@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_CSR_SHADOW_H_
+#define _WDDR_CSR_SHADOW_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <wddr/csr_profile.h>
+
+/**
+ * @brief   CSR Shadow Number of Entries
+ *
+ * @details Size of the direct mapped shadow. Must be a power of 2.
+ */
+#define CSR_SHADOW_ENTRIES      (256)
+
+/**
+ * @brief   CSR Write Filter Statistics Number
+ *
+ * @details Number of registers whose suppressed writes are counted
+ *          individually. Must be a power of 2.
+ */
+#define CSR_FILTER_STATS_NUM    (64)
+
+#if CONFIG_CSR_WRITE_FILTER && !CONFIG_CSR_SHADOW
+#error "CONFIG_CSR_WRITE_FILTER requires CONFIG_CSR_SHADOW"
+#endif
+
+/**
+ * @brief   CSR Access Macros
+ *
+ * @details All PHY configuration (CFG) register accesses of the register
+ *          overlays go through these macros. Status (STA) registers are
+ *          read with CSR_READ_STA and are never shadowed. Registers that
+ *          are accessed by address (PLL / VCO) use CSR_REG_READ and
+ *          CSR_REG_WRITE.
+ *
+ *          With CONFIG_CSR_SHADOW, reads are served from a RAM mirror of the
+ *          configuration registers, so read-modify-write sequences skip the
+ *          bus read. Writes always go to the bus (write-through) and update
+ *          the mirror if the register is present.
+ *
+ *          With CONFIG_CSR_WRITE_FILTER, writes of the value the shadow
+ *          already holds are dropped. CSR_WRITE_FORCE must be used for
+ *          registers where the write itself has a side effect (FIFO push,
+ *          sticky clear, toggle or pulse bits); it always goes to the bus.
+ *
+ *          With CONFIG_CSR_PROFILE, every access is counted and timed per
+ *          module and phase (see wddr/csr_profile.h).
+ *
+ * @note    Shadow is only coherent if every write of a CFG register goes
+ *          through CSR_WRITE and if CFG registers aren't updated by
+ *          hardware. Shadow entries are updated in a critical section, so
+ *          any number of tasks may share it. Must only be used from task
+ *          context; interrupt handlers only access status and MCU
+ *          registers and do so directly.
+ */
+#if CONFIG_CSR_PROFILE
+#define CSR_READ(reg)               csr_profile_read(&(reg))
+#define CSR_READ_STA(reg)           csr_profile_read_sta(&(reg))
+#define CSR_WRITE(reg, val)         csr_profile_write(&(reg), (val), false)
+#define CSR_WRITE_FORCE(reg, val)   csr_profile_write(&(reg), (val), true)
+#define CSR_REG_READ(addr)          csr_profile_read_sta((volatile uint32_t *) (uintptr_t) (addr))
+#define CSR_REG_WRITE(addr, val)    csr_profile_write((volatile uint32_t *) (uintptr_t) (addr), (val), true)
+#elif CONFIG_CSR_SHADOW
+#define CSR_READ(reg)               csr_shadow_read(&(reg))
+#define CSR_READ_STA(reg)           (reg)
+#define CSR_WRITE(reg, val)         csr_shadow_write(&(reg), (val))
+#define CSR_WRITE_FORCE(reg, val)   csr_shadow_write_force(&(reg), (val))
+#define CSR_REG_READ(addr)          reg_read(addr)
+#define CSR_REG_WRITE(addr, val)    reg_write(addr, val)
+#else
+#define CSR_READ(reg)               (reg)
+#define CSR_READ_STA(reg)           (reg)
+#define CSR_WRITE(reg, val)         ((reg) = (val))
+#define CSR_WRITE_FORCE(reg, val)   ((reg) = (val))
+#define CSR_REG_READ(addr)          reg_read(addr)
+#define CSR_REG_WRITE(addr, val)    reg_write(addr, val)
+#endif /* CONFIG_CSR_PROFILE */
+
+/**
+ * @brief   CSR Shadow Statistics Structure
+ *
+ * hits         number of reads served from the shadow.
+ * misses       number of reads that went to the bus.
+ * writes       number of writes that went to the bus.
+ * suppressed   number of writes dropped by the write filter.
+ * untracked    suppressed writes of registers that didn't fit in the
+ *              per-register statistics.
+ */
+typedef struct csr_shadow_stats
+{
+    uint32_t    hits;
+    uint32_t    misses;
+    uint32_t    writes;
+    uint32_t    suppressed;
+    uint32_t    untracked;
+} csr_shadow_stats_t;
+
+#if CONFIG_CSR_SHADOW
+/**
+ * @brief   CSR Shadow Read
+ *
+ * @details Returns the shadowed value of a configuration register. On a
+ *          miss the register is read from the bus and allocated.
+ *
+ * @param[in]   reg     pointer to register.
+ *
+ * @return      register value.
+ */
+uint32_t csr_shadow_read(volatile uint32_t *reg);
+
+/**
+ * @brief   CSR Shadow Write
+ *
+ * @details Writes a configuration register and updates its shadow entry if
+ *          present. Writes don't allocate so that write-only registers
+ *          (i.e. FIFO data) don't evict registers that are read back.
+ *
+ * @param[in]   reg     pointer to register.
+ * @param[in]   val     value to write.
+ *
+ * @return      void.
+ */
+void csr_shadow_write(volatile uint32_t *reg, uint32_t val);
+
+/**
+ * @brief   CSR Shadow Write Force
+ *
+ * @details Writes a configuration register even if the shadow holds the
+ *          same value and updates its shadow entry if present.
+ *
+ * @param[in]   reg     pointer to register.
+ * @param[in]   val     value to write.
+ *
+ * @return      void.
+ */
+void csr_shadow_write_force(volatile uint32_t *reg, uint32_t val);
+
+/**
+ * @brief   CSR Shadow Invalidate
+ *
+ * @details Drops all shadow entries. Must be called whenever the PHY
+ *          configuration registers are reset.
+ *
+ * @return      void.
+ */
+void csr_shadow_invalidate(void);
+
+/**
+ * @brief   CSR Shadow Get Statistics
+ *
+ * @details Reads shadow hit / miss statistics.
+ *
+ * @param[out]  stats   pointer to store statistics.
+ *
+ * @return      void.
+ */
+void csr_shadow_get_stats(csr_shadow_stats_t *stats);
+
+/**
+ * @brief   CSR Write Filter Read Statistics
+ *
+ * @details Reads suppressed write count of a single register. Registers
+ *          are hashed into entries, so empty entries can be interleaved;
+ *          callers should walk all CSR_FILTER_STATS_NUM entries.
+ *
+ * @param[in]   index   index of statistics entry.
+ * @param[out]  addr    pointer to store register address.
+ * @param[out]  count   pointer to store number of suppressed writes.
+ *
+ * @return      returns whether entry is valid.
+ * @retval      true if entry holds a register.
+ * @retval      false if index is out of range, entry is empty or write
+ *              filter is disabled.
+ */
+bool csr_filter_read_stats(uint16_t index, uint32_t *addr, uint32_t *count);
+#else
+static inline void csr_shadow_invalidate(void) {}
+static inline void csr_shadow_get_stats(csr_shadow_stats_t *stats)
+{
+    stats->hits = stats->misses = stats->writes = 0;
+    stats->suppressed = stats->untracked = 0;
+}
+
+static inline bool csr_filter_read_stats(uint16_t index, uint32_t *addr, uint32_t *count)
+{
+    return false;
+}
+#endif /* CONFIG_CSR_SHADOW */
+
+#endif /* _WDDR_CSR_SHADOW_H_ */
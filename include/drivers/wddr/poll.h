@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _WDDR_POLL_H_
+#define _WDDR_POLL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief   Poll Site Enumeration
+ *
+ * @details Hardware wait a poll is attributed to. Each site has its own
+ *          timeout, policy and statistics.
+ *
+ * PLL_INT_EN           PLL sees interrupt enable update (pll_init).
+ * PLL_CORE_READY       PLL ready after software frequency switch.
+ * LP_CORE_READY        PLL ready after low power VCO park / unpark.
+ * VCO_FLL_LOCK         VCO FLL locked during VCO calibration.
+ * PMON_DONE            PMON count done.
+ * IG_FIFO_EMPTY        DFI ingress FIFO drained.
+ * CSP_SYNC             FSW CSP sync request complete.
+ * DFI_MODE_INIT_START  INIT_START low before handing PHY to DFI.
+ * FSW_INIT_START       INIT_START low during frequency switch.
+ * FSW_INIT_COMPLETE    INIT_COMPLETE deasserted during frequency switch.
+ * PHYMSTR_ACK_LOW      PHYMSTR ACK low after PHYMSTR exit.
+ * CTRLUPD_REQ_LOW      CTRLUPD REQ low after CTRLUPD ACK.
+ * PHYUPD_ACK_LOW       PHYUPD ACK low after PHYUPD exit.
+ */
+typedef enum wddr_poll_site
+{
+    WDDR_POLL_SITE_PLL_INT_EN,
+    WDDR_POLL_SITE_PLL_CORE_READY,
+    WDDR_POLL_SITE_LP_CORE_READY,
+    WDDR_POLL_SITE_VCO_FLL_LOCK,
+    WDDR_POLL_SITE_PMON_DONE,
+    WDDR_POLL_SITE_IG_FIFO_EMPTY,
+    WDDR_POLL_SITE_CSP_SYNC,
+    WDDR_POLL_SITE_DFI_MODE_INIT_START,
+    WDDR_POLL_SITE_FSW_INIT_START,
+    WDDR_POLL_SITE_FSW_INIT_COMPLETE,
+    WDDR_POLL_SITE_PHYMSTR_ACK_LOW,
+    WDDR_POLL_SITE_CTRLUPD_REQ_LOW,
+    WDDR_POLL_SITE_PHYUPD_ACK_LOW,
+    WDDR_POLL_SITE_NUM,
+} wddr_poll_site_t;
+
+/**
+ * @brief   Poll Policy Enumeration
+ *
+ * SPIN     condition is checked back to back.
+ * BACKOFF  delay between checks doubles up to a maximum; keeps the CSR
+ *          bus free for waits that are known to be long.
+ * YIELD    task yields between checks; spins if the scheduler isn't
+ *          running yet.
+ */
+typedef enum wddr_poll_policy
+{
+    WDDR_POLL_POLICY_SPIN,
+    WDDR_POLL_POLICY_BACKOFF,
+    WDDR_POLL_POLICY_YIELD,
+} wddr_poll_policy_t;
+
+/**
+ * @brief   Poll Statistics Structure
+ *
+ * count        number of polls.
+ * timeouts     number of polls that timed out.
+ * cycles_max   maximum cycles spent in a poll.
+ * cycles_total total cycles spent in all polls.
+ */
+typedef struct wddr_poll_stats
+{
+    uint32_t    count;
+    uint32_t    timeouts;
+    uint32_t    cycles_max;
+    uint32_t    cycles_total;
+} wddr_poll_stats_t;
+
+/**
+ * @brief   Poll Condition
+ *
+ * @param[in]   ctx     context given to wddr_poll.
+ *
+ * @return      returns whether condition is met.
+ */
+typedef bool (*wddr_poll_cond_t)(void *ctx);
+
+/**
+ * @brief   Poll
+ *
+ * @details Waits until condition is met or the timeout of the site
+ *          expires, following the policy of the site. Condition is checked
+ *          at least once.
+ *
+ * @param[in]   site    site poll is attributed to.
+ * @param[in]   cond    condition to wait for.
+ * @param[in]   ctx     context passed to condition.
+ *
+ * @return      returns whether condition was met.
+ * @retval      true if condition was met.
+ * @retval      false if timed out.
+ */
+bool wddr_poll(wddr_poll_site_t site, wddr_poll_cond_t cond, void *ctx);
+
+/**
+ * @brief   Poll Register
+ *
+ * @details Waits until (register & mask) == value. Register is read as a
+ *          status register. See wddr_poll.
+ *
+ * @param[in]   site    site poll is attributed to.
+ * @param[in]   reg     pointer to register.
+ * @param[in]   mask    mask of field(s) to compare.
+ * @param[in]   value   value field(s) must have (already shifted).
+ * @param[out]  reg_val pointer to store last register value; can be NULL.
+ *
+ * @return      returns whether register reached value.
+ * @retval      true if value was reached.
+ * @retval      false if timed out.
+ */
+bool wddr_poll_reg(wddr_poll_site_t site,
+                   volatile uint32_t *reg,
+                   uint32_t mask,
+                   uint32_t value,
+                   uint32_t *reg_val);
+
+/**
+ * @brief   Poll Read Statistics
+ *
+ * @details Statistics of a site are read as one consistent snapshot; safe
+ *          to call from task or ISR context.
+ *
+ * @param[in]   site    site to read.
+ * @param[out]  stats   pointer to store statistics.
+ *
+ * @return      returns whether statistics could be read.
+ * @retval      true if site is in range.
+ * @retval      false otherwise.
+ */
+bool wddr_poll_read_stats(uint16_t site, wddr_poll_stats_t *stats);
+
+/**
+ * @brief   Poll Clear Statistics
+ *
+ * @details Safe to call from task or ISR context.
+ *
+ * @return      void.
+ */
+void wddr_poll_clear_stats(void);
+
+#endif /* _WDDR_POLL_H_ */
@@ -32,6 +32,7 @@
  * ERROR_DFI_PACKET_FIFO_FULL   The DFI Packet FIFO is full.
  * ERROR_ZQCAL_CODE_AT_MIN      The ZQCAL code is at the min value.
  * ERROR_ZQCAL_CODE_AT_MAX      The ZQCAL code is at the max value.
+ * ERROR_POLL_TIMEOUT           A hardware wait timed out (see wddr/poll.h).
  */
 typedef enum wddr_return_t
 {
@@ -46,6 +47,7 @@ typedef enum wddr_return_t
     WDDR_ERROR_ZQCAL_PCAL_AT_MAX,
     WDDR_ERROR_ZQCAL_NCAL_AT_MIN,
     WDDR_ERROR_ZQCAL_NCAL_AT_MAX,
+    WDDR_ERROR_POLL_TIMEOUT,
 } wddr_return_t;
 
 #endif /* _ERROR_H_ */
@@ -14,7 +14,7 @@
  *
  * SUCCESS  firmware request was successful.
  * FAILURE  firmware request failed.
- * RETRY    firmware request couldn't be processed. Caller should retry.
+ * RETRY    firmware request couldn't be queued. Caller should retry.
  */
 typedef enum firmware_response
 {
@@ -24,20 +24,38 @@ typedef enum firmware_response
     FW_RESP_NUM,
 } fw_response_t;
 
+/**
+ * @brief   Firmware Message Complete Callback
+ *
+ * @details Called from the firmware task once a message has been processed.
+ *          Must not block.
+ *
+ * @param[in]   event   firmware event of the message.
+ * @param[in]   data    message specific data.
+ * @param[in]   resp    firmware response.
+ *
+ * @return      void
+ */
+typedef void (*fw_msg_complete_t)(uint8_t event, void *data, fw_response_t resp);
+
 /**
  * @brief  Firmware Message Structure
  *
- * @details Structure passed to PHY firmware for processing.
+ * @details Structure passed to PHY firmware for processing. The response is
+ *          passed to the complete callback if set; otherwise, the sender is
+ *          notified.
  *
  * event    Firmware event associated with the message.
  * data     pointer to message specific data to process.
  * xSender  pointer to task that sent the message.
+ * complete callback called with response (NULL if sender is notified).
  */
 typedef struct firmware_message
 {
     uint8_t event;
     void *data;
     TaskHandle_t xSender;
+    fw_msg_complete_t complete;
 } fw_msg_t;
 
 #endif /* _FIRMWARE_H_ */
@@ -7,6 +7,26 @@
 #define _FIRMWARE_PHY_API_H_
 
 #include <stdbool.h>
+#include <stdint.h>
+#include <wddr/csr_shadow.h>
+#include <wddr/poll.h>
+#include <wddr/device.h>
+#include <wddr/eye.h>
+
+/** @brief  Number of entries readable with firmware_phy_csr_filter_read */
+#define FIRMWARE_PHY_CSR_FILTER_NUM     (CSR_FILTER_STATS_NUM)
+
+/** @brief  Number of entries readable with firmware_phy_csr_profile_read */
+#define FIRMWARE_PHY_CSR_PROFILE_NUM    (CSR_PROFILE_ENTRY_NUM)
+
+/** @brief  Number of sites readable with firmware_phy_poll_read */
+#define FIRMWARE_PHY_POLL_NUM           (WDDR_POLL_SITE_NUM)
+
+/** @brief  Number of words readable with firmware_phy_boot_report_read */
+#define FIRMWARE_PHY_BOOT_REPORT_NUM    (WDDR_BOOT_STAGE_NUM + 1)
+
+/** @brief  Number of entries that can be staged for one operating point */
+#define FIRMWARE_PHY_FREQ_STORE_NUM     (128)
 
 /**
  * @brief   Firmware PHY Initialization
@@ -47,4 +67,283 @@ UBaseType_t firmware_phy_start(bool calibrate, bool train_dram);
  */
 UBaseType_t firmware_phy_prep_switch(uint8_t freq_id);
 
+/**
+ * @brief   Firmware PHY Prepare Complete Callback
+ *
+ * @details Called from the firmware task once an asynchronous prepare has
+ *          been processed. Must not block.
+ *
+ * @param[in]   freq_id     The frequency that was prepared.
+ * @param[in]   status      pdPASS if prepared successfully; pdFAIL otherwise.
+ * @param[in]   retry       true if request wasn't handled and can be issued
+ *                          again (status is pdFAIL).
+ *
+ * @return  void.
+ */
+typedef void (*firmware_phy_prep_cb_t)(uint8_t freq_id, UBaseType_t status, bool retry);
+
+/**
+ * @brief   Firmware PHY Prepare Frequency Switch Asynchronously
+ *
+ * @details Requests the firmware to begin prepping PHY for a frequency
+ *          switch without waiting for it. The callback is called once the
+ *          request has been processed; a new request can be issued from
+ *          the callback.
+ *
+ * @param[in]   freq_id     The frequency to prepare.
+ * @param[in]   callback    function called with the result.
+ *
+ * @return  returns whether request was sent.
+ * @retval  pdPASS if sent.
+ * @retval  pdFAIL if another request is in flight.
+ */
+UBaseType_t firmware_phy_prep_switch_async(uint8_t freq_id,
+                                           firmware_phy_prep_cb_t callback);
+
+/**
+ * @brief   Firmware PHY Eye Scan
+ *
+ * @details Requests the firmware to run an eye scan with the built-in FIFO
+ *          test. The scan runs in the next PHYMSTR window; its result is
+ *          valid once firmware_phy_eye_get_info passes.
+ *
+ * @param[in]   cfg     pointer to scan configuration; copied by firmware.
+ *
+ * @return  returns whether scan was queued.
+ * @retval  pdPASS if queued.
+ * @retval  pdFAIL if firmware isn't ready, a scan is already queued or
+ *          periodic calibration isn't enabled.
+ */
+UBaseType_t firmware_phy_eye_scan(const wddr_eye_scan_cfg_t *cfg);
+
+/**
+ * @brief   Firmware PHY Eye Get Info
+ *
+ * @details Gets the summary of the most recent eye scan.
+ *
+ * @param[out]  vref_num    pointer to store number of VREF steps scanned.
+ * @param[out]  best_row    pointer to store VREF step with widest eye.
+ * @param[out]  width       pointer to store eye width at best_row.
+ *
+ * @return  returns whether a valid eye scan exists.
+ * @retval  pdPASS if eye scan is valid.
+ * @retval  pdFAIL otherwise.
+ */
+UBaseType_t firmware_phy_eye_get_info(uint8_t *vref_num,
+                                      uint8_t *best_row,
+                                      uint8_t *width);
+
+/**
+ * @brief   Firmware PHY Eye Read
+ *
+ * @details Reads one packed word of the most recent eye map.
+ *
+ * @param[in]   rank    rank of the map.
+ * @param[in]   byte    DQ byte of the map.
+ * @param[in]   row     VREF step of the map.
+ * @param[in]   word    word index within the row.
+ * @param[out]  data    pointer to store packed word.
+ *
+ * @return  returns whether word was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL otherwise.
+ */
+UBaseType_t firmware_phy_eye_read(uint8_t rank,
+                                  uint8_t byte,
+                                  uint8_t row,
+                                  uint8_t word,
+                                  uint32_t *data);
+
+/**
+ * @brief   Firmware PHY Profile Read
+ *
+ * @details Reads one statistic of the firmware event profile.
+ *
+ * @param[in]   event   firmware event.
+ * @param[in]   kind    kind of sample (see fw_phy_prof_kind_t).
+ * @param[in]   stat    statistic to read (see fw_phy_prof_stat_t).
+ * @param[in]   clear   flag to clear all statistics after reading.
+ * @param[out]  value   pointer to store value.
+ *
+ * @return  returns whether statistic was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL otherwise.
+ */
+UBaseType_t firmware_phy_prof_read(uint8_t event,
+                                   uint8_t kind,
+                                   uint8_t stat,
+                                   bool clear,
+                                   uint32_t *value);
+
+/**
+ * @brief   Firmware PHY Trace Read
+ *
+ * @details Reads one word of the firmware trace ring. Word 0 is the start
+ *          of the ring header (see fw_phy_trace_ring_t).
+ *
+ * @param[in]   word    word index into trace ring.
+ * @param[out]  data    pointer to store word.
+ *
+ * @return  returns whether word was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL otherwise.
+ */
+UBaseType_t firmware_phy_trace_read(uint16_t word, uint32_t *data);
+
+/**
+ * @brief   Firmware PHY Statistics Read
+ *
+ * @details Reads one telemetry counter (see fw_phy_stat_t).
+ *
+ * @param[in]   stat        index of counter.
+ * @param[in]   snapshot    flag to read from last snapshot instead of live
+ *                          counters.
+ * @param[out]  value       pointer to store value.
+ *
+ * @return  returns whether counter was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL otherwise.
+ */
+UBaseType_t firmware_phy_stats_read(uint16_t stat, bool snapshot, uint32_t *value);
+
+/**
+ * @brief   Firmware PHY Statistics Snapshot
+ *
+ * @details Atomically copies all telemetry counters so that they can be
+ *          read consistently with firmware_phy_stats_read.
+ *
+ * @return  number of counters in snapshot.
+ */
+uint16_t firmware_phy_stats_snapshot(void);
+
+/**
+ * @brief   Firmware PHY Statistics Clear
+ *
+ * @details Clears all live telemetry counters.
+ *
+ * @return  void.
+ */
+void firmware_phy_stats_clear(void);
+
+/**
+ * @brief   Firmware PHY CSR Write Filter Read
+ *
+ * @details Reads suppressed write count of a single register tracked by the
+ *          CSR write filter. Empty entries, and all entries when the filter
+ *          is disabled, read as address 0 and count 0.
+ *
+ * @param[in]   index   index of entry; less than FIRMWARE_PHY_CSR_FILTER_NUM.
+ * @param[out]  addr    pointer to store register address.
+ * @param[out]  count   pointer to store number of suppressed writes.
+ *
+ * @return  returns whether entry was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL if index is out of range.
+ */
+UBaseType_t firmware_phy_csr_filter_read(uint16_t index, uint32_t *addr, uint32_t *count);
+
+/**
+ * @brief   Firmware PHY CSR Profile Read
+ *
+ * @details Reads register access counts and cycles of one module during one
+ *          phase (see csr_profile_module_t and csr_profile_phase_t). All
+ *          entries read as 0 when the profiler is disabled.
+ *
+ * @param[in]   index   index of entry (phase * CSR_PROFILE_MODULE_NUM +
+ *                      module); less than FIRMWARE_PHY_CSR_PROFILE_NUM.
+ * @param[out]  entry   pointer to store entry.
+ *
+ * @return  returns whether entry was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL if index is out of range.
+ */
+UBaseType_t firmware_phy_csr_profile_read(uint16_t index, csr_profile_entry_t *entry);
+
+/**
+ * @brief   Firmware PHY CSR Profile Clear
+ *
+ * @details Clears all CSR profile entries.
+ *
+ * @return  void.
+ */
+void firmware_phy_csr_profile_clear(void);
+
+/**
+ * @brief   Firmware PHY Boot Report Read
+ *
+ * @details Reads cycles spent in one stage of the last boot (see
+ *          wddr_boot_stage_t). Index WDDR_BOOT_STAGE_NUM reads the total.
+ *
+ * @param[in]   index   index of word; less than FIRMWARE_PHY_BOOT_REPORT_NUM.
+ * @param[out]  cycles  pointer to store cycles.
+ *
+ * @return  returns whether word was read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL if index is out of range.
+ */
+UBaseType_t firmware_phy_boot_report_read(uint8_t index, uint32_t *cycles);
+
+/**
+ * @brief   Firmware PHY Poll Read
+ *
+ * @details Reads statistics of the hardware waits of one poll site (see
+ *          wddr_poll_site_t).
+ *
+ * @param[in]   site    poll site; less than FIRMWARE_PHY_POLL_NUM.
+ * @param[out]  stats   pointer to store statistics.
+ *
+ * @return  returns whether statistics were read.
+ * @retval  pdPASS if read successfully.
+ * @retval  pdFAIL if site is out of range.
+ */
+UBaseType_t firmware_phy_poll_read(uint16_t site, wddr_poll_stats_t *stats);
+
+/**
+ * @brief   Firmware PHY Poll Clear
+ *
+ * @details Clears statistics of all poll sites.
+ *
+ * @return  void.
+ */
+void firmware_phy_poll_clear(void);
+
+/**
+ * @brief   Firmware PHY Frequency Store Begin
+ *
+ * @details Starts staging an operating point to upload to the frequency
+ *          cache. Any entries staged before are dropped.
+ *
+ * @param[in]   op_id   operating point to upload.
+ *
+ * @return  void.
+ */
+void firmware_phy_freq_store_begin(uint8_t op_id);
+
+/**
+ * @brief   Firmware PHY Frequency Store Entry
+ *
+ * @details Stages a delta entry of the operating point being uploaded.
+ *          Entries are checked when committed.
+ *
+ * @param[in]   entry   pointer to delta entry.
+ *
+ * @return  returns whether entry was staged.
+ * @retval  pdPASS if staged.
+ * @retval  pdFAIL if no upload was started or staging area is full.
+ */
+UBaseType_t firmware_phy_freq_store_entry(const wddr_table_entry_t *entry);
+
+/**
+ * @brief   Firmware PHY Frequency Store Commit
+ *
+ * @details Requests the firmware to store the staged operating point in the
+ *          frequency cache and ends the upload.
+ *
+ * @return  returns whether operating point was stored.
+ * @retval  pdPASS if stored.
+ * @retval  pdFAIL if no upload was started, frequency cache isn't enabled or
+ *          firmware rejected the operating point.
+ */
+UBaseType_t firmware_phy_freq_store_commit(void);
+
 #endif /* _FIRMWARE_PHY_API_H_ */
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _FIRMWARE_PHY_JOB_H_
+#define _FIRMWARE_PHY_JOB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <FreeRTOS.h>
+#include <wddr/device.h>
+
+/** @brief  Number of job slices executed per PHYMSTR window */
+#define FW_PHY_JOB_SLICES_PER_WINDOW    (1)
+
+/** @brief  Maximum number of jobs that can be queued */
+#define FW_PHY_JOB_QUEUE_LEN            (4)
+
+/**
+ * @brief   Firmware PHY Job Status Enumeration
+ *
+ * DONE     Job has completed; it is removed from the queue.
+ * PENDING  Job has more work; it resumes from its checkpoint in the next
+ *          PHYMSTR window.
+ * ERROR    Job failed; it is removed from the queue.
+ */
+typedef enum fw_phy_job_status
+{
+    FW_PHY_JOB_DONE,
+    FW_PHY_JOB_PENDING,
+    FW_PHY_JOB_ERROR,
+} fw_phy_job_status_t;
+
+/**
+ * @brief   Firmware PHY Job Checkpoint Structure
+ *
+ * @details Progress of a job kept between PHYMSTR windows. Cleared when the
+ *          job is submitted and whenever the frequency changes between
+ *          slices, since results of a partial sweep don't carry over.
+ *
+ * freq_id  frequency the job is running at.
+ * rank     rank of the current slice.
+ * step     job specific progress (i.e. VREF row of an eye scan).
+ */
+typedef struct fw_phy_job_checkpoint
+{
+    uint8_t     freq_id;
+    uint8_t     rank;
+    uint32_t    step;
+} fw_phy_job_checkpoint_t;
+
+/**
+ * @brief   Firmware PHY Job Slice Function
+ *
+ * @details Performs one slice of a job. A slice must fit into a single
+ *          PHYMSTR window (i.e. one VREF row of a sweep or one rank) and
+ *          must update the checkpoint before returning PENDING.
+ *
+ * @param[in]       wddr    pointer to WDDR device.
+ * @param[inout]    cp      pointer to job checkpoint.
+ * @param[in]       ctx     job context.
+ *
+ * @return      returns job status after slice.
+ */
+typedef fw_phy_job_status_t (*fw_phy_job_slice_t)(wddr_dev_t *wddr,
+                                                  fw_phy_job_checkpoint_t *cp,
+                                                  void *ctx);
+
+/**
+ * @brief   Firmware PHY Job Structure
+ *
+ * slice        slice function of the job.
+ * ctx          context passed to slice function.
+ * queued       flag to indicate that job is queued.
+ * started      flag to indicate that checkpoint is valid.
+ * checkpoint   progress of the job.
+ * slices       number of slices executed.
+ * restarts     number of times job restarted due to a frequency change.
+ */
+typedef struct fw_phy_job
+{
+    fw_phy_job_slice_t      slice;
+    void                    *ctx;
+    volatile bool           queued;
+    bool                    started;
+    fw_phy_job_checkpoint_t checkpoint;
+    uint32_t                slices;
+    uint32_t                restarts;
+} fw_phy_job_t;
+
+/**
+ * @brief   Firmware PHY Job Queue Initialization
+ *
+ * @details Initializes queue of jobs run in PHYMSTR windows.
+ *
+ * @return  void.
+ */
+void fw_phy_job_queue_init(void);
+
+/**
+ * @brief   Firmware PHY Job Initialization
+ *
+ * @details Initializes a job.
+ *
+ * @param[in]   job     pointer to job.
+ * @param[in]   slice   slice function of the job.
+ * @param[in]   ctx     context passed to slice function.
+ *
+ * @return  void.
+ */
+void fw_phy_job_init(fw_phy_job_t *job, fw_phy_job_slice_t slice, void *ctx);
+
+/**
+ * @brief   Firmware PHY Job Submit
+ *
+ * @details Queues a job to be run in subsequent PHYMSTR windows. Job starts
+ *          from a cleared checkpoint.
+ *
+ * @param[in]   job     pointer to job.
+ *
+ * @return      returns whether job was queued.
+ * @retval      pdPASS if queued or already queued.
+ * @retval      pdFAIL if queue is full.
+ */
+BaseType_t fw_phy_job_submit(fw_phy_job_t *job);
+
+/**
+ * @brief   Firmware PHY Job Pending
+ *
+ * @details Returns whether any job is waiting for a PHYMSTR window.
+ *
+ * @return      returns whether jobs are pending.
+ * @retval      true if jobs are pending.
+ * @retval      false otherwise.
+ */
+bool fw_phy_job_pending(void);
+
+/**
+ * @brief   Firmware PHY Job Run Window
+ *
+ * @details Runs up to FW_PHY_JOB_SLICES_PER_WINDOW slices of the job at the
+ *          head of the queue. Must only be called while in PHYMSTR.
+ *
+ * @param[in]   wddr    pointer to WDDR device.
+ *
+ * @return      void.
+ */
+void fw_phy_job_run_window(wddr_dev_t *wddr);
+
+#endif /* _FIRMWARE_PHY_JOB_H_ */
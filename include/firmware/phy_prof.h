@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _FIRMWARE_PHY_PROF_H_
+#define _FIRMWARE_PHY_PROF_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <firmware/phy_task.h>
+
+/**
+ * @brief   Number of latency histogram bins
+ *
+ * @details Bin n counts samples of [2^n, 2^(n+1)) cycles; bin 0 also counts
+ *          0 cycles and the last bin counts everything above it.
+ */
+#define FW_PHY_PROF_HIST_BINS   (24)
+
+/**
+ * @brief   Firmware PHY Profile Kind Enumeration
+ *
+ * WAIT     time from event being queued until the firmware task takes it.
+ * HANDLER  time spent in the event handler, including state machine
+ *          transition, entry and exit actions.
+ */
+typedef enum fw_phy_prof_kind
+{
+    FW_PHY_PROF_KIND_WAIT,
+    FW_PHY_PROF_KIND_HANDLER,
+    FW_PHY_PROF_KIND_NUM,
+} fw_phy_prof_kind_t;
+
+/**
+ * @brief   Firmware PHY Profile Statistic Enumeration
+ *
+ * @details Statistics that can be read with fw_phy_prof_read. All values
+ *          are in cycles except COUNT and histogram bins.
+ *
+ * COUNT    number of samples.
+ * MIN      minimum sample.
+ * MAX      maximum sample.
+ * MEAN     mean of all samples.
+ * HIST     first histogram bin; bin n is read as HIST + n.
+ */
+typedef enum fw_phy_prof_stat
+{
+    FW_PHY_PROF_STAT_COUNT,
+    FW_PHY_PROF_STAT_MIN,
+    FW_PHY_PROF_STAT_MAX,
+    FW_PHY_PROF_STAT_MEAN,
+    FW_PHY_PROF_STAT_HIST,
+    FW_PHY_PROF_STAT_NUM = FW_PHY_PROF_STAT_HIST + FW_PHY_PROF_HIST_BINS,
+} fw_phy_prof_stat_t;
+
+/**
+ * @brief   Firmware PHY Profile Record
+ *
+ * @details Records a sample for the given event. Must only be called from
+ *          the firmware task.
+ *
+ * @param[in]   event   firmware event.
+ * @param[in]   kind    kind of sample.
+ * @param[in]   cycles  sample in cycles.
+ *
+ * @return      void.
+ */
+void fw_phy_prof_record(fw_phy_event_t event, fw_phy_prof_kind_t kind, uint32_t cycles);
+
+/**
+ * @brief   Firmware PHY Profile Read
+ *
+ * @details Reads a single statistic of the given event.
+ *
+ * @param[in]   event   firmware event.
+ * @param[in]   kind    kind of sample.
+ * @param[in]   stat    statistic to read.
+ * @param[out]  value   pointer to store value.
+ *
+ * @return      returns whether statistic was read.
+ * @retval      true if read successfully.
+ * @retval      false if any argument is out of bounds.
+ */
+bool fw_phy_prof_read(uint8_t event, uint8_t kind, uint8_t stat, uint32_t *value);
+
+/**
+ * @brief   Firmware PHY Profile Clear
+ *
+ * @details Clears all statistics of all events.
+ *
+ * @return      void.
+ */
+void fw_phy_prof_clear(void);
+
+#endif /* _FIRMWARE_PHY_PROF_H_ */
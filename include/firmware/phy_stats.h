@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _FIRMWARE_PHY_STATS_H_
+#define _FIRMWARE_PHY_STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <wddr/table.h>
+#include <firmware/phy_task.h>
+
+/**
+ * @brief   Firmware PHY Statistic Enumeration
+ *
+ * @details Index of each counter in the telemetry block. Counters wrap;
+ *          MIN / MAX values are 0 until the first sample.
+ *
+ * SWITCH           frequency switches completed; read as SWITCH + freq_id.
+ * PREP_MIN         minimum PREP latency in cycles.
+ * PREP_MAX         maximum PREP latency in cycles.
+ * PHYUPD           PHYUPD requests issued.
+ * CTRLUPD          CTRLUPD requests handled.
+ * ZQCAL_CHANGE     ZQCAL calibrations that changed a code.
+ * PLL_LOSS_LOCK    PLL loss of lock interrupts.
+ * RETRY            events answered with FW_RESP_RETRY.
+ * COALESCED        events merged into a queued instance.
+ * REPLAYED         deferred events replayed.
+ * DROPPED          events that didn't fit into the deferred list.
+ * LANE_DEPTH_MAX   lane queue high-water mark; read as LANE_DEPTH_MAX + lane.
+ * LANE_COUNT       events handled per lane; read as LANE_COUNT + lane.
+ * LANE_WAIT_MAX    maximum cycles from queueing an event until the firmware
+ *                  task picks it up; read as LANE_WAIT_MAX + lane.
+ * LANE_WAIT_CYCLES total wait cycles of all handled events; read as
+ *                  LANE_WAIT_CYCLES + lane.
+ * DEFERRED_MAX     deferred list high-water mark.
+ * VCO_CAL_PREP     PHY VCO calibrations done during PREP (lazy calibration).
+ * VCO_CAL_IDLE     PHY VCO calibrations done in the background.
+ * FREQ_CACHE_HIT   PREPs served from an expanded operating point.
+ * FREQ_CACHE_MISS  PREPs that expanded an operating point from the store.
+ * FREQ_CACHE_HIT_CYCLES    total cycles of frequency cache hits.
+ * FREQ_CACHE_MISS_CYCLES   total cycles of frequency cache misses.
+ * FREQ_CACHE_HIT_MAX       maximum cycles of a frequency cache hit.
+ * FREQ_CACHE_MISS_MAX      maximum cycles of a frequency cache miss.
+ * HEAP_FREE        free FreeRTOS heap in bytes; sampled when read.
+ */
+typedef enum fw_phy_stat
+{
+    FW_PHY_STAT_SWITCH,
+    FW_PHY_STAT_PREP_MIN = FW_PHY_STAT_SWITCH + WDDR_PHY_FREQ_NUM,
+    FW_PHY_STAT_PREP_MAX,
+    FW_PHY_STAT_PHYUPD,
+    FW_PHY_STAT_CTRLUPD,
+    FW_PHY_STAT_ZQCAL_CHANGE,
+    FW_PHY_STAT_PLL_LOSS_LOCK,
+    FW_PHY_STAT_RETRY,
+    FW_PHY_STAT_COALESCED,
+    FW_PHY_STAT_REPLAYED,
+    FW_PHY_STAT_DROPPED,
+    FW_PHY_STAT_LANE_DEPTH_MAX,
+    FW_PHY_STAT_LANE_COUNT = FW_PHY_STAT_LANE_DEPTH_MAX + FW_PHY_LANE_NUM,
+    FW_PHY_STAT_LANE_WAIT_MAX = FW_PHY_STAT_LANE_COUNT + FW_PHY_LANE_NUM,
+    FW_PHY_STAT_LANE_WAIT_CYCLES = FW_PHY_STAT_LANE_WAIT_MAX + FW_PHY_LANE_NUM,
+    FW_PHY_STAT_DEFERRED_MAX = FW_PHY_STAT_LANE_WAIT_CYCLES + FW_PHY_LANE_NUM,
+    FW_PHY_STAT_VCO_CAL_PREP,
+    FW_PHY_STAT_VCO_CAL_IDLE,
+    FW_PHY_STAT_FREQ_CACHE_HIT,
+    FW_PHY_STAT_FREQ_CACHE_MISS,
+    FW_PHY_STAT_FREQ_CACHE_HIT_CYCLES,
+    FW_PHY_STAT_FREQ_CACHE_MISS_CYCLES,
+    FW_PHY_STAT_FREQ_CACHE_HIT_MAX,
+    FW_PHY_STAT_FREQ_CACHE_MISS_MAX,
+    FW_PHY_STAT_HEAP_FREE,
+    FW_PHY_STAT_NUM,
+} fw_phy_stat_t;
+
+/**
+ * @brief   Firmware PHY Statistic Increment
+ *
+ * @details Atomically increments a counter. Safe to call from any task or
+ *          ISR.
+ *
+ * @param[in]   stat    counter to increment.
+ *
+ * @return      void.
+ */
+void fw_phy_stats_inc(fw_phy_stat_t stat);
+
+/**
+ * @brief   Firmware PHY Statistic Add
+ *
+ * @details Atomically adds value to a counter. Safe to call from any task or
+ *          ISR.
+ *
+ * @param[in]   stat    counter to add to.
+ * @param[in]   value   value to add.
+ *
+ * @return      void.
+ */
+void fw_phy_stats_add(fw_phy_stat_t stat, uint32_t value);
+
+/**
+ * @brief   Firmware PHY Statistic Maximum
+ *
+ * @details Raises a MAX counter to value. Must not be called from an ISR.
+ *
+ * @param[in]   stat    counter to update.
+ * @param[in]   value   sampled value.
+ *
+ * @return      void.
+ */
+void fw_phy_stats_max(fw_phy_stat_t stat, uint32_t value);
+
+/**
+ * @brief   Firmware PHY Statistic Minimum
+ *
+ * @details Lowers a MIN counter to value. Must not be called from an ISR.
+ *
+ * @param[in]   stat    counter to update.
+ * @param[in]   value   sampled value; must be non-zero.
+ *
+ * @return      void.
+ */
+void fw_phy_stats_min(fw_phy_stat_t stat, uint32_t value);
+
+/**
+ * @brief   Firmware PHY Statistic Read
+ *
+ * @details Reads the live value of a single counter.
+ *
+ * @param[in]   stat    counter to read.
+ * @param[out]  value   pointer to store value.
+ *
+ * @return      returns whether counter was read.
+ * @retval      true if read successfully.
+ * @retval      false if stat is out of bounds.
+ */
+bool fw_phy_stats_read(uint16_t stat, uint32_t *value);
+
+/**
+ * @brief   Firmware PHY Statistic Snapshot
+ *
+ * @details Copies all counters into the snapshot block in a single critical
+ *          section, so values read with fw_phy_stats_read_snapshot are
+ *          consistent with each other.
+ *
+ * @return      number of counters in the snapshot.
+ */
+uint16_t fw_phy_stats_snapshot(void);
+
+/**
+ * @brief   Firmware PHY Statistic Read Snapshot
+ *
+ * @details Reads a single counter of the last snapshot.
+ *
+ * @param[in]   stat    counter to read.
+ * @param[out]  value   pointer to store value.
+ *
+ * @return      returns whether counter was read.
+ * @retval      true if read successfully.
+ * @retval      false if stat is out of bounds.
+ */
+bool fw_phy_stats_read_snapshot(uint16_t stat, uint32_t *value);
+
+/**
+ * @brief   Firmware PHY Statistic Clear
+ *
+ * @details Clears all live counters. Snapshot is kept.
+ *
+ * @return      void.
+ */
+void fw_phy_stats_clear(void);
+
+#endif /* _FIRMWARE_PHY_STATS_H_ */
@@ -8,6 +8,7 @@
 
 #include <stdbool.h>
 #include <firmware/firmware.h>
+#include <wddr/table.h>
 
 /**
  * @brief   PHY Firmware Events
@@ -30,6 +31,9 @@
  *  CTRLUPD_DEASSERT    Event used to indicate CTRLUPD REQ was dasserted.
  *  LP_DATA_REQ         Event used to indicate LP_DATA REQ was asserted.
  *  LP_CTRL_REQ         Event used to indicate LP_CTRL_REQ was asserted.
+ *  VCO_CAL             Event used to calibrate idle PHY VCO in the background.
+ *  FREQ_STORE          Event used to store an operating point in the frequency cache.
+ *  EYE_SCAN            Event used to queue an eye scan for the next PHYMSTR window.
  */
 typedef enum firmware_phy_event
 {
@@ -51,9 +55,30 @@ typedef enum firmware_phy_event
     FW_PHY_EVENT_CTRLUPD_DEASSERT,
     FW_PHY_EVENT_LP_DATA_REQ,
     FW_PHY_EVENT_LP_CTRL_REQ,
+    FW_PHY_EVENT_VCO_CAL,
+    FW_PHY_EVENT_FREQ_STORE,
+    FW_PHY_EVENT_EYE_SCAN,
     FW_PHY_EVENT_NUM,
 } fw_phy_event_t;
 
+/**
+ * @brief   PHY Firmware Event Lanes
+ *
+ * @details Events are queued in lanes by priority. Firmware task always
+ *          handles the oldest event of the highest priority lane first.
+ *
+ *  FSW         Boot, frequency switch and PLL events (highest priority).
+ *  DFI         DFI handshake and low power events.
+ *  PERIODIC    Periodic update and maintenance requests (lowest priority).
+ */
+typedef enum firmware_phy_lane
+{
+    FW_PHY_LANE_FSW,
+    FW_PHY_LANE_DFI,
+    FW_PHY_LANE_PERIODIC,
+    FW_PHY_LANE_NUM,
+} fw_phy_lane_t;
+
 /**
  * @brief   Firmware PHY Start Configuration Structure
  *
@@ -66,6 +91,20 @@ typedef struct fw_phy_start_config
     bool train_dram;
 } fw_phy_start_cfg_t;
 
+/**
+ * @brief   Firmware PHY Frequency Store Structure
+ *
+ * op_id        Operating point to store.
+ * delta        Pointer to delta entries against the packed baseline.
+ * num          Number of delta entries.
+ */
+typedef struct fw_phy_freq_store
+{
+    uint8_t                     op_id;
+    const wddr_table_entry_t    *delta;
+    uint16_t                    num;
+} fw_phy_freq_store_t;
+
 /**
  * @brief   Firmware PHY Task Initialization
  *
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _FIRMWARE_PHY_TRACE_H_
+#define _FIRMWARE_PHY_TRACE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief  Number of entries in trace ring; must be a power of 2 */
+#define FW_PHY_TRACE_LEN        (128)
+
+/** @brief  Magic number that marks trace ring as initialized */
+#define FW_PHY_TRACE_MAGIC      (0x54524345)
+
+/** @brief  State value used when state machine state isn't known */
+#define FW_PHY_TRACE_STATE_NONE (0xFF)
+
+/**
+ * @brief   Firmware PHY Trace ID Enumeration
+ *
+ * @note    tools/trace_decode.py must be kept in sync.
+ *
+ * BOOT         firmware task initialized; arg is number of boots.
+ * POST         event posted by a task; arg is message data.
+ * POST_ISR     event posted by an ISR; arg is message data.
+ * MERGE        event merged into queued instance; arg is message data.
+ * DEQUEUE      event taken by firmware task; arg is lane.
+ * DEFER        event parked while blocked; arg is deferred count.
+ * REPLAY       parked event replayed; arg is deferred count.
+ * HANDLE_START event handler entered; arg is message data.
+ * HANDLE_END   event handler returned; arg is response.
+ * PLL_IRQ      PLL interrupt; arg is PLL interrupt status.
+ * LP           PHY low power levels changed; arg is WDDR_LP_LEVEL_* mask.
+ */
+typedef enum fw_phy_trace_id
+{
+    FW_PHY_TRACE_BOOT,
+    FW_PHY_TRACE_POST,
+    FW_PHY_TRACE_POST_ISR,
+    FW_PHY_TRACE_MERGE,
+    FW_PHY_TRACE_DEQUEUE,
+    FW_PHY_TRACE_DEFER,
+    FW_PHY_TRACE_REPLAY,
+    FW_PHY_TRACE_HANDLE_START,
+    FW_PHY_TRACE_HANDLE_END,
+    FW_PHY_TRACE_PLL_IRQ,
+    FW_PHY_TRACE_LP,
+    FW_PHY_TRACE_NUM,
+} fw_phy_trace_id_t;
+
+/**
+ * @brief   Firmware PHY Trace Entry Structure
+ *
+ * @details Fixed size trace record. An entry is valid once seq is non-zero;
+ *          seq is written last.
+ *
+ * cycles   mcycle timestamp.
+ * id       trace ID (see fw_phy_trace_id_t).
+ * event    firmware event.
+ * state    firmware state machine state; FSW state in upper nibble and DFI
+ *          state in lower nibble.
+ * rsvd     reserved.
+ * arg      trace ID specific argument.
+ * seq      sequence number of the entry, starting from 1.
+ */
+typedef struct fw_phy_trace_entry
+{
+    uint32_t    cycles;
+    uint8_t     id;
+    uint8_t     event;
+    uint8_t     state;
+    uint8_t     rsvd;
+    uint32_t    arg;
+    uint32_t    seq;
+} fw_phy_trace_entry_t;
+
+/**
+ * @brief   Firmware PHY Trace Ring Structure
+ *
+ * @details Ring is placed in a .noinit section so that it survives a reset
+ *          and can be read after a crash.
+ *
+ * magic    FW_PHY_TRACE_MAGIC if ring is initialized.
+ * len      number of entries.
+ * head     total number of entries claimed; next entry is head % len.
+ * boots    number of times firmware initialized ring.
+ * entry    trace entries.
+ */
+typedef struct fw_phy_trace_ring
+{
+    uint32_t                magic;
+    uint32_t                len;
+    volatile uint32_t       head;
+    uint32_t                boots;
+    fw_phy_trace_entry_t    entry[FW_PHY_TRACE_LEN];
+} fw_phy_trace_ring_t;
+
+/**
+ * @brief   Firmware PHY Trace Initialization
+ *
+ * @details Initializes trace ring. Contents of a valid ring are kept and
+ *          a BOOT entry is appended.
+ *
+ * @return  void.
+ */
+void fw_phy_trace_init(void);
+
+/**
+ * @brief   Firmware PHY Trace
+ *
+ * @details Appends an entry to the trace ring. Safe to call from ISRs and
+ *          tasks; entries are claimed with an atomic increment, so no lock
+ *          is taken.
+ *
+ * @param[in]   id      trace ID.
+ * @param[in]   event   firmware event.
+ * @param[in]   state   firmware state (FW_PHY_TRACE_STATE_NONE if unknown).
+ * @param[in]   arg     trace ID specific argument.
+ *
+ * @return      void.
+ */
+void fw_phy_trace(fw_phy_trace_id_t id, uint8_t event, uint8_t state, uint32_t arg);
+
+/**
+ * @brief   Firmware PHY Trace Read
+ *
+ * @details Reads one word of the trace ring, including ring header, for
+ *          dumping to the host.
+ *
+ * @param[in]   word    word index into trace ring.
+ * @param[out]  data    pointer to store word.
+ *
+ * @return      returns whether word was read.
+ * @retval      true if read successfully.
+ * @retval      false if word is out of bounds.
+ */
+bool fw_phy_trace_read(uint16_t word, uint32_t *data);
+
+#endif /* _FIRMWARE_PHY_TRACE_H_ */
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _SIM_CSR_H_
+#define _SIM_CSR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <board/board.h>
+
+/** @brief  Address of a CSR relative to the PHY base */
+#define SIM_CSR_ADDR(offset)    (SIM_CSR_BASE + (offset))
+
+/**
+ * @brief   Simulation CSR Initialization
+ *
+ * @details Maps SIM_CSR_SIZE bytes of zeroed RAM at SIM_CSR_BASE. Register
+ *          structures (ca_reg_t, dq_reg_t, dfich_reg_t, ...) and reg_read /
+ *          reg_write then operate on RAM. Must be called before the PHY
+ *          firmware is initialized.
+ *
+ * @return      returns whether CSR block could be mapped.
+ * @retval      true if mapped at SIM_CSR_BASE.
+ * @retval      false otherwise.
+ */
+bool sim_csr_init(void);
+
+/**
+ * @brief   Simulation CSR Read
+ *
+ * @param[in]   offset  offset of register from SIM_CSR_BASE.
+ *
+ * @return      register value.
+ */
+uint32_t sim_csr_read(uint32_t offset);
+
+/**
+ * @brief   Simulation CSR Write
+ *
+ * @param[in]   offset  offset of register from SIM_CSR_BASE.
+ * @param[in]   value   value to write.
+ *
+ * @return      void.
+ */
+void sim_csr_write(uint32_t offset, uint32_t value);
+
+/**
+ * @brief   Simulation CSR Update
+ *
+ * @details Sets or clears bits of a register; used by behavioural models to
+ *          drive status bits.
+ *
+ * @param[in]   offset  offset of register from SIM_CSR_BASE.
+ * @param[in]   mask    bits to update.
+ * @param[in]   set     flag to set (true) or clear (false) bits.
+ *
+ * @return      void.
+ */
+void sim_csr_update(uint32_t offset, uint32_t mask, bool set);
+
+#endif /* _SIM_CSR_H_ */
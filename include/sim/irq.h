@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _SIM_IRQ_H_
+#define _SIM_IRQ_H_
+
+#include <stdint.h>
+
+/** @brief  Number of interrupt lines of the simulated MCU */
+#define SIM_IRQ_NUM         (32)
+
+/**
+ * @brief   Simulation IRQ Raise
+ *
+ * @details Marks an interrupt as pending. Safe to call from host threads
+ *          (i.e. behavioural models). Pending interrupts are delivered by
+ *          sim_irq_dispatch once they are enabled.
+ *
+ * @param[in]   irq     interrupt line (see mcu_fast_irq_t).
+ *
+ * @return      void.
+ */
+void sim_irq_raise(uint32_t irq);
+
+/**
+ * @brief   Simulation IRQ Dispatch
+ *
+ * @details Calls handlers of all pending, enabled interrupts. Must be called
+ *          from interrupt context of the FreeRTOS port (the tick hook), so
+ *          handlers can use the FromISR APIs.
+ *
+ * @return      void.
+ */
+void sim_irq_dispatch(void);
+
+#endif /* _SIM_IRQ_H_ */
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _SIM_MODEL_H_
+#define _SIM_MODEL_H_
+
+#include <stdint.h>
+
+/** @brief  Maximum number of behavioural models */
+#define SIM_MODEL_MAX           (8)
+
+/** @brief  Default period at which models are stepped */
+#define SIM_MODEL_PERIOD_US     (10)
+
+/**
+ * @brief   Simulation Model Structure
+ *
+ * @details Behavioural model of a block. Models run in a host thread next
+ *          to the firmware, like the hardware does, and drive status bits
+ *          from the configuration the firmware has written.
+ *
+ * name     name of the model.
+ * step     function that updates status bits of the block.
+ */
+typedef struct sim_model
+{
+    const char  *name;
+    void        (*step)(void);
+} sim_model_t;
+
+/**
+ * @brief   Simulation Model Register
+ *
+ * @details Adds a model. Models registered later can override status bits
+ *          driven by earlier ones.
+ *
+ * @param[in]   model   pointer to model; must stay valid.
+ *
+ * @return      void.
+ */
+void sim_model_register(const sim_model_t *model);
+
+/**
+ * @brief   Simulation Model Register Defaults
+ *
+ * @details Registers the default models:
+ *
+ *          pll     FLL lock and PLL CORE_READY follow VCO / FLL enables.
+ *          zqcal   ZQCAL comparator trips at a fixed N / P code.
+ *          sa      SA outputs trip at a fixed calibration code.
+ *          dfi     IG FIFO drains immediately; EG FIFO is empty.
+ *          pmon    PMON counts complete immediately.
+ *
+ * @return      void.
+ */
+void sim_model_register_defaults(void);
+
+/**
+ * @brief   Simulation Model Start
+ *
+ * @details Starts host thread that steps all models every period_us.
+ *
+ * @param[in]   period_us   step period in microseconds.
+ *
+ * @return      void.
+ */
+void sim_model_start(uint32_t period_us);
+
+#endif /* _SIM_MODEL_H_ */
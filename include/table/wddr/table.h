@@ -6,6 +6,7 @@
 #ifndef _WDDR_TABLE_H_
 #define _WDDR_TABLE_H_
 
+#include <stddef.h>
 #include <dfi/table.h>
 #include <dram/table.h>
 #include <cmn/table.h>
@@ -63,6 +64,22 @@ typedef struct wddr_cfg_t
     wddr_common_cfg_t    common;
 } wddr_cfg_t;
 
+/**
+ * @brief   WDDR Training State Structure
+ *
+ * @details Tracks whether the frequency configuration of a given frequency
+ *          holds trained values.
+ *
+ * valid        flag to indicate that the frequency has been trained.
+ * generation   number of times the frequency has been trained or
+ *              invalidated.
+ */
+typedef struct wddr_train_state_t
+{
+    uint8_t     valid;
+    uint32_t    generation;
+} wddr_train_state_t;
+
 /**
  * @brief   WDDR Table Structure
  *
@@ -71,11 +88,107 @@ typedef struct wddr_cfg_t
  *
  * cfg      configuration table.
  * valid    table of which frequencies are valid.
+ * trained  table of training state for all frequencies.
+ * vco_cal  table of which PHY VCOs have been calibrated for all frequencies;
+ *          bitmask of PLL_PHY_VCO_MASK.
  */
 typedef struct wddr_table_t
 {
-    wddr_cfg_t cfg;
-    uint8_t    valid[WDDR_PHY_FREQ_NUM];
+    wddr_cfg_t          cfg;
+    uint8_t             valid[WDDR_PHY_FREQ_NUM];
+    wddr_train_state_t  trained[WDDR_PHY_FREQ_NUM];
+    uint8_t             vco_cal[WDDR_PHY_FREQ_NUM];
 } wddr_table_t;
 
+/**
+ * @brief   WDDR Table Packed Entry Type Pointer
+ *
+ * @details Entry type of pointers into the table; value is the offset of the
+ *          target within wddr_table_t. All other entry types are the size of
+ *          the field in bytes.
+ */
+#define WDDR_TABLE_ENTRY_TYPE_PTR   (0)
+
+/**
+ * @brief   WDDR Table Replication Dimension Enumeration
+ *
+ * CHANNEL  entry is replicated across channels.
+ * BYTE     entry is replicated across DQ bytes.
+ * RANK     entry is replicated across ranks.
+ */
+typedef enum wddr_table_rep_dim_t
+{
+    WDDR_TABLE_REP_DIM_CHANNEL,
+    WDDR_TABLE_REP_DIM_BYTE,
+    WDDR_TABLE_REP_DIM_RANK,
+    WDDR_TABLE_REP_DIM_NUM
+} wddr_table_rep_dim_t;
+
+/**
+ * @brief   WDDR Table Replication Set Structure
+ *
+ * @details Describes how an entry of the packed table is replicated when
+ *          unpacked. Replication set 0 doesn't replicate.
+ *
+ * stride   distance in bytes between instances of each dimension.
+ * num      number of instances of each dimension.
+ */
+typedef struct wddr_table_rep_t
+{
+    uint16_t    stride[WDDR_TABLE_REP_DIM_NUM];
+    uint8_t     num[WDDR_TABLE_REP_DIM_NUM];
+} wddr_table_rep_t;
+
+/**
+ * @brief   WDDR Table Packed Entry Structure
+ *
+ * @details Single non-zero field of the packed table. Bit fields are merged
+ *          into a single entry for the register they belong to.
+ *
+ * offset   offset of field within the frequency / common configuration.
+ * type     size of field in bytes or WDDR_TABLE_ENTRY_TYPE_PTR.
+ * rep      index of replication set.
+ * value    value of field.
+ */
+typedef struct wddr_table_entry_t
+{
+    uint16_t    offset;
+    uint8_t     type;
+    uint8_t     rep;
+    uint32_t    value;
+} wddr_table_entry_t;
+
+/**
+ * @brief   WDDR Table Packed Delta Structure
+ *
+ * @details Range of delta entries that are applied on top of the baseline
+ *          frequency to get the configuration of a given frequency.
+ *
+ * start    index of first delta entry.
+ * num      number of delta entries.
+ */
+typedef struct wddr_table_delta_t
+{
+    uint16_t    start;
+    uint16_t    num;
+} wddr_table_delta_t;
+
+/** @brief  Packed table entry of a field of configuration type_t */
+#define WDDR_TABLE_ENTRY(type_t, field, rep_id, val)                            \
+    {                                                                           \
+        .offset = offsetof(type_t, field),                                      \
+        .type = sizeof(((type_t *) 0)->field),                                  \
+        .rep = (rep_id),                                                        \
+        .value = (uint32_t) (val),                                              \
+    }
+
+/** @brief  Packed table entry of a pointer into wddr_table_t */
+#define WDDR_TABLE_ENTRY_PTR(type_t, field, rep_id, target)                     \
+    {                                                                           \
+        .offset = offsetof(type_t, field),                                      \
+        .type = WDDR_TABLE_ENTRY_TYPE_PTR,                                      \
+        .rep = (rep_id),                                                        \
+        .value = offsetof(wddr_table_t, target),                                \
+    }
+
 #endif /* _WDDR_TABLE_H_ */
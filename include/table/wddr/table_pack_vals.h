@@ -0,0 +1,466 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/****************************************************************************
+*****************************************************************************
+** Tool used: table_pack.py
+** Generated by: root
+** Date: 10/18/26 23:38:58
+** Input file used: table_vals.h
+** Entries: common 9, baseline 159, deltas 242 (of 1128 fields per frequency)
+** Replication sets: 8
+*****************************************************************************
+****************************************************************************/
+
+#ifndef _WDDR_TABLE_PACK_VALS_H_
+#define _WDDR_TABLE_PACK_VALS_H_
+
+#define WDDR_TABLE_PACK_BASE_FREQ   (2)
+
+#define WDDR_TABLE_PACK_VALID {                                                                                        \
+    FREQ_VALID,                                                                                                        \
+    FREQ_VALID,                                                                                                        \
+    FREQ_VALID,                                                                                                        \
+    FREQ_VALID,                                                                                                        \
+}
+
+#define WDDR_TABLE_PACK_REP {                                                                                          \
+    {.stride = {0, 0, 0}, .num = {1, 1, 1}},                                                                           \
+    {.stride = {sizeof(((wddr_common_cfg_t *) 0)->channel[0]), sizeof(((wddr_common_cfg_t *) 0)->channel[0].dq[0]), sizeof(((wddr_common_cfg_t *) 0)->channel[0].dq[0].rx.rank[0])}, .num = {2, 2, 2}}, \
+    {.stride = {sizeof(((wddr_freq_cfg_t *) 0)->channel[0]), 0, sizeof(((wddr_freq_cfg_t *) 0)->channel[0].ca.rx.rank[0])}, .num = {2, 1, 2}}, \
+    {.stride = {sizeof(((wddr_freq_cfg_t *) 0)->channel[0]), 0, 0}, .num = {2, 1, 1}},                                 \
+    {.stride = {sizeof(((wddr_freq_cfg_t *) 0)->channel[0]), 0, sizeof(((wddr_freq_cfg_t *) 0)->channel[0].ca.tx.rank[0])}, .num = {2, 1, 2}}, \
+    {.stride = {sizeof(((wddr_freq_cfg_t *) 0)->channel[0]), sizeof(((wddr_freq_cfg_t *) 0)->channel[0].dq[0]), sizeof(((wddr_freq_cfg_t *) 0)->channel[0].dq[0].rx.rank[0])}, .num = {2, 2, 2}}, \
+    {.stride = {sizeof(((wddr_freq_cfg_t *) 0)->channel[0]), sizeof(((wddr_freq_cfg_t *) 0)->channel[0].dq[0]), 0}, .num = {2, 2, 1}}, \
+    {.stride = {sizeof(((wddr_freq_cfg_t *) 0)->channel[0]), sizeof(((wddr_freq_cfg_t *) 0)->channel[0].dq[0]), sizeof(((wddr_freq_cfg_t *) 0)->channel[0].dq[0].tx.rank[0])}, .num = {2, 2, 2}}, \
+}
+
+#define WDDR_TABLE_PACK_COMMON {                                                                                       \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.code[REC_P_SIDE][REC_T_SIDE], 1, 0x7), \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.code[REC_P_SIDE][REC_C_SIDE], 1, 0x7), \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.code[REC_N_SIDE][REC_T_SIDE], 1, 0x7), \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.code[REC_N_SIDE][REC_C_SIDE], 1, 0x7), \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, common.pmon.init_wait, 0, 16),                                                 \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, common.pmon.refclk_count, 0, 256),                                             \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, common.pmon.target, 0, 18),                                                    \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, common.zqcal.code[ZQCAL_VOH_0P5][ZQCAL_N_CAL], 0, 1),                          \
+    WDDR_TABLE_ENTRY(wddr_common_cfg_t, common.zqcal.code[ZQCAL_VOH_0P6][ZQCAL_N_CAL], 0, 1),                          \
+}
+
+#define WDDR_TABLE_PACK_BASE {                                                                                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_range, 0, 2),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_range, 0, 2),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_refclk_count, 0, 127),                                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_refclk_count, 0, 127),                                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_vco_count_target, 0, 2688),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_vco_count_target, 0, 2688),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].int_comp, 0, 42),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].int_comp, 0, 42),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].prop_gain, 0, 3),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].prop_gain, 0, 3),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].lock_count_threshold, 0, 2),                                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].lock_count_threshold, 0, 2),                                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].band, 0, 0xA),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].band, 0, 0xA),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fine, 0, 0x17),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fine, 0, 0x17),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank[0].ck.sdr_lpde, 2, 0xF | (0x1 << 6)),                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank_cmn.cmn.gearbox.data_mode, 3, DGB_2TO1_HF),                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank_cmn.cmn.gearbox.fifo_mode, 3, FGB_2TO2),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.ddr, 4, (0x6 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.qdr, 4, 0xD | (0x6 << 6)),                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.odr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.rt, 4, (0x6 << 6)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.ddr, 4, (0x6 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.qdr, 4, 0xD | (0x6 << 6)),                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.odr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.rt, 4, (0x6 << 6)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.sdr, 4, (0x6 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.dfi, 4, (0x6 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.rt.pipe_en, 4, 0x1FF),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.rt.pipe_en, 4, 0x1FF),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[0], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[1], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[2], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[3], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[4], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[5], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[6], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[7], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[8], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[9], 4, 0x1 | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[10], 4, 0x1 | (0x1 << 6)),                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.lpde[0], 4, 0xF | (0x1 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pipeline.sdr.x_sel, 4, 0x76542020),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pipeline.sdr.x_sel, 4, 0x76543120),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pipeline.ddr.x_sel, 4, 0x3210),                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pipeline.ddr.x_sel, 4, 0x3210),                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.ca.driver.tx_impd, 3, DRIVER_IMPEDANCE_240),           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.ca.driver.rx_impd, 3, DRIVER_IMPEDANCE_HIZ),           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.ck.driver.tx_impd, 3, DRIVER_IMPEDANCE_240),           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.ck.driver.rx_impd, 3, DRIVER_IMPEDANCE_HIZ),           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.ck.gearbox.write_mode, 3, WGB_1TO1),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.ck.gearbox.data_mode, 3, DGB_4TO1_HF),                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.cmn.egress.ana_mode, 3, DDR_ANA_EGRESS_QDR_2TO1),      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank_cmn.cmn.egress.dig_mode, 3, DDR_DIG_EGRESS_DDR_2TO1),      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.driver.mode, 4, DRIVER_MODE_DIFF),                   \
+    WDDR_TABLE_ENTRY_PTR(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.driver.code, 4, cfg.common.common.zqcal.code[ZQCAL_VOH_0P5]), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.mode, 5, REC_MODE_DIFF),                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.feedback_resistor, 5, 0x6),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.rx_delay[REC_T_SIDE], 5, 0x4F),         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.rx_delay[REC_C_SIDE], 5, 0x4F),         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rcs, 5, (0x6 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.ren, 5, 0xC | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rdqs, 5, (0x6 << 6)),                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.sdr_lpde, 5, 0xF | (0x1 << 6)),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank_cmn.cmn.gearbox.data_mode, 6, DGB_4TO1_HF),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank_cmn.cmn.gearbox.fifo_mode, 6, FGB_4TO4),                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank_cmn.cmn.gearbox.pre_filter_sel, 6, 1),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pipeline.sdr.pipe_en, 7, 0xC),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK].sdr.pipe_en, 7, 0xC),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_DQS].sdr.pipe_en, 7, 0xC),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.pipe_en, 7, 0xC),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.pipe_en, 7, 0xC),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.pipe_en, 7, 0xC),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_OE].sdr.pipe_en, 7, 0xC),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK_OE].sdr.pipe_en, 7, 0xC), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCS].sdr.pipe_en, 7, 0xC),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].sdr.pipe_en, 7, 0xC),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pipeline.sdr.x_sel, 7, 0x76541302),               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK].sdr.x_sel, 7, 0x76540202), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_DQS].sdr.x_sel, 7, 0x76541302), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.x_sel, 7, 0x76541302), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.x_sel, 7, 0x76541302), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.x_sel, 7, 0x76541302), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_OE].sdr.x_sel, 7, 0x76541302), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK_OE].sdr.x_sel, 7, 0x76541302), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCS].sdr.x_sel, 7, 0x76540202), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].sdr.x_sel, 7, 0x76540202), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pipeline.ddr.x_sel, 7, 0x3210),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK].ddr.x_sel, 7, 0x3210),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_DQS].ddr.x_sel, 7, 0x3210),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].ddr.x_sel, 7, 0x3210),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].ddr.x_sel, 7, 0x3210),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].ddr.x_sel, 7, 0x3210),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_OE].ddr.x_sel, 7, 0x3210),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK_OE].ddr.x_sel, 7, 0x3210), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCS].ddr.x_sel, 7, 0x3210),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].ddr.x_sel, 7, 0x3210),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[0], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[1], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[2], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[3], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[4], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[5], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[6], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[7], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[8], 7, 0x1 | (0x5 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[0], 7, 0xA | (0x5 << 6)),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[1], 7, 0xA | (0x5 << 6)),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.rt.pipe_en, 7, 0x1FF),                            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.rt.pipe_en, 7, 0x1FF),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.ddr, 7, (0x6 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.qdr, 7, 0xD | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.odr, 7, (0x1 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.rt, 7, (0x6 << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.ddr, 7, (0x6 << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.qdr, 7, 0xD | (0x6 << 6)),                     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.odr, 7, (0x1 << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.rt, 7, (0x6 << 6)),                            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.sdr, 7, (0x6 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.dfi, 7, (0x6 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dq.driver.tx_impd, 6, DRIVER_IMPEDANCE_240),        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dq.driver.rx_impd, 6, DRIVER_IMPEDANCE_HIZ),        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dq.driver.override, 6, DRIVER_IMPEDANCE_HIZ),       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.tx_impd, 6, DRIVER_IMPEDANCE_80),        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.rx_impd, 6, DRIVER_IMPEDANCE_80),        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.override, 6, DRIVER_IMPEDANCE_80),       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.gearbox.write_mode, 6, WGB_1TO1),               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.gearbox.data_mode, 6, DGB_4TO1_HF),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.cmn.egress.ana_mode, 6, DDR_ANA_EGRESS_QDR_2TO1),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.cmn.egress.dig_mode, 6, DDR_DIG_EGRESS_DDR_2TO1),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.driver.mode, 7, DRIVER_MODE_DIFF),               \
+    WDDR_TABLE_ENTRY_PTR(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.driver.code, 7, cfg.common.common.zqcal.code[ZQCAL_VOH_0P5]), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, common.vref.code, 0, 0xFA),                                                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.ckctrl, 0, DFI_PIPE_DISABLE | (0x2 << 4) | (DFIWGB_4TO4 << 8)),              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wckctrl, 0, DFI_PIPE_DISABLE | (0x2 << 4) | (DFIWGB_4TO4 << 8)),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wctrl, 0, DFI_PIPE_DISABLE | (0x2 << 4) | (DFIWGB_4TO4 << 8)),               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wenctrl, 0, DFI_PIPE_DISABLE | (0x6 << 4) | (DFIWGB_4TO4 << 8)),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wrcctrl, 0, DFI_PIPE_DISABLE | (DFIWGB_4TO4 << 8)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wrc, 0, DFI_PIPE_DISABLE | (DFIWGB_4TO4 << 8)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wrd, 0, DFI_PIPE_ENABLE | (0x3 << 4) | (DFIWGB_4TO4 << 8)),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.rctrl, 0, DFI_PIPE_DISABLE | (0x2 << 4) | (DFIWGB_4TO4 << 8)),               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.rdd, 0, (DFIRGB_4TO4 << 8)),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.clken_pext, 0, 0xF | (0xF << 4) | (0x6 << 8) | (0x6 << 12) | (0xF << 16)),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.wrd, 0, (0x4 << 8) | (0x26 << 16)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.rd, 0, 0x16 | (0x3 << 8) | (0x4 << 16) | (0x2 << 24)),            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.ovr_traffic, 0, (0x1 << 2) | (0x1 << 6)),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr12, 0, 0xD),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr14, 0, 0xD),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr1, 0, 0x6C),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr2, 0, 0x36),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr11, 0, 0x01),                                                             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.txsr, 0, 315),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_lat, 0, 2),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_en, 0, 6),                                                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_rd_en, 0, 28),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.ratio, 0, WDDR_FREQ_RATIO_1TO2),                                            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_vref_ca_long, 0, 404),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_sh_train, 0, 4),                                                          \
+}
+
+#define WDDR_TABLE_PACK_DELTA {                                                                                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_refclk_count, 0, 63),                                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_refclk_count, 0, 63),                                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_vco_count_target, 0, 704),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_vco_count_target, 0, 704),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].int_comp, 0, 22),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].int_comp, 0, 22),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].prop_gain, 0, 1),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].prop_gain, 0, 1),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].post_div, 0, 1),                                                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].post_div, 0, 1),                                                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].band, 0, 0x3),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].band, 0, 0x3),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fine, 0, 0x11),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fine, 0, 0x11),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank[0].ck.sdr_lpde, 2, 0xF),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank_cmn.cmn.gearbox.wck_mode, 3, 0x1),                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.ddr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.qdr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.odr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.rt, 4, 0),                                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.ddr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.qdr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.odr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.rt, 4, 0),                                        \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.sdr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.dfi, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[0], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[1], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[2], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[3], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[4], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[5], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[6], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[7], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[8], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[9], 4, 0x1),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[10], 4, 0x1),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.lpde[0], 4, 0xF),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.feedback_resistor, 5, 0x2),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.rx_delay[REC_T_SIDE], 5, 0xBB),         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.rx_delay[REC_C_SIDE], 5, 0XBB),         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rcs, 5, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.ren, 5, 0x8),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rdqs, 5, 0),                                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.sdr_lpde, 5, 0xF),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank_cmn.cmn.gearbox.pre_filter_sel, 6, 0),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.pipe_en, 7, 0x0),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.pipe_en, 7, 0x0),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.pipe_en, 7, 0x0),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.x_sel, 7, 0x76543120), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.x_sel, 7, 0x76543120), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.x_sel, 7, 0x76543120), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].sdr.x_sel, 7, 0x76542020), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[0], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[1], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[2], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[3], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[4], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[5], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[6], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[7], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[8], 7, 0x1),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[0], 7, 0xA),                                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[1], 7, 0xA),                                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.ddr, 7, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.qdr, 7, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.odr, 7, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.rt, 7, 0),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.ddr, 7, 0),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.qdr, 7, 0),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.odr, 7, 0),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.rt, 7, 0),                                     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.sdr, 7, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.dfi, 7, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.tx_impd, 6, DRIVER_IMPEDANCE_240),       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.rx_impd, 6, DRIVER_IMPEDANCE_HIZ),       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.override, 6, DRIVER_IMPEDANCE_240 | (0x1 << 4)), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wenctrl, 0, DFI_PIPE_DISABLE | (0x2 << 4) | (DFIWGB_4TO4 << 8)),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wrd, 0, DFI_PIPE_DISABLE | (DFIWGB_4TO4 << 8)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.wrd, 0, (0x4 << 8) | (0x5 << 16)),                                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.wck, 0, 0x5),                                                     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.rd, 0, (0x1 << 8) | (0x2 << 16)),                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr1, 0, 0x4),                                                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr2, 0, 0x9),                                                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr11, 0, 0x0),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.txsr, 0, 83),                                                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_lat, 0, 1),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_en, 0, 5),                                                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_rd_en, 0, 7),                                                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_vref_ca_long, 0, 106),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_sh_train, 0, 1),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_refclk_count, 0, 63),                                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_refclk_count, 0, 63),                                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_vco_count_target, 0, 672),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_vco_count_target, 0, 672),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].int_comp, 0, 21),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].int_comp, 0, 21),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].prop_gain, 0, 1),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].prop_gain, 0, 1),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].band, 0, 0x3),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].band, 0, 0x3),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fine, 0, 0x0D),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fine, 0, 0x0D),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank_cmn.cmn.gearbox.wck_mode, 3, 0x1),                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.ddr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.qdr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.odr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.rt, 4, (0x1 << 6)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.ddr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.qdr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.odr, 4, 0),                                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.rt, 4, (0x1 << 6)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.sdr, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.dfi, 4, (0x1 << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.path_state, 5, 0x1),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.feedback_resistor, 5, 0x2),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.rx_delay[REC_T_SIDE], 5, 0xBB),         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.receiver.rx_delay[REC_C_SIDE], 5, 0xBB),         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rcs, 5, (0x1 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.ren, 5, 0x3 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rdqs, 5, (0x1 << 6)),                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank_cmn.cmn.gearbox.pre_filter_sel, 6, 0),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[0], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[1], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[2], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[3], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[4], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[5], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[6], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[7], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[8], 7, 0x1 | (0x1 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[0], 7, 0xA | (0x1 << 6)),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[1], 7, 0xA | (0x1 << 6)),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.ddr, 7, (0x1 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.qdr, 7, (0x1 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.odr, 7, 0),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.rt, 7, (0x1 << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.ddr, 7, (0x1 << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.qdr, 7, (0x1 << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.odr, 7, 0),                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.rt, 7, (0x1 << 6)),                            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.sdr, 7, (0x1 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.dfi, 7, (0x1 << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.tx_impd, 6, DRIVER_IMPEDANCE_240),       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.rx_impd, 6, DRIVER_IMPEDANCE_HIZ),       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank_cmn.dqs.driver.override, 6, DRIVER_IMPEDANCE_240 | (0x1 << 4)), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wenctrl, 0, DFI_PIPE_DISABLE | (0x2 << 4) | (DFIWGB_4TO4 << 8)),             \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.wrd, 0, DFI_PIPE_DISABLE | (DFIWGB_4TO4 << 8)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.wrd, 0, (0x4 << 8) | (0x5 << 16)),                                \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.wck, 0, 0x5),                                                     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.rd, 0, (0x1 << 16)),                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr1, 0, 0x24),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr2, 0, 0x1B),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr11, 0, 0x0),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.txsr, 0, 158),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_lat, 0, 5),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_en, 0, 5),                                                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_rd_en, 0, 17),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_vref_ca_long, 0, 202),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_sh_train, 0, 2),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fll_vco_count_target, 0, 3520),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fll_vco_count_target, 0, 3520),                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].int_comp, 0, 55),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].int_comp, 0, 55),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].prop_gain, 0, 5),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].prop_gain, 0, 5),                                                 \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].band, 0, 0xF),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].band, 0, 0xF),                                                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[0].fine, 0, 0x1F),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, pll.vco_cfg[1].fine, 0, 0x1F),                                                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank[0].ck.sdr_lpde, 2, 0xF | (0x6 << 6)),                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.rx.rank_cmn.cmn.gearbox.wck_mode, 3, 0x1),                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.ddr, 4, (0xE << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.qdr, 4, (0xE << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.rt, 4, (0xE << 6)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.ddr, 4, (0xE << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.qdr, 4, (0xE << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.pi.rt, 4, (0xE << 6)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.sdr, 4, (0xE << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.pi.dfi, 4, (0xE << 6)),                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[0], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[1], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[2], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[3], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[4], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[5], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[6], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[7], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[8], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[9], 4, 0x1 | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ca.lpde[10], 4, 0x1 | (0x6 << 6)),                      \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].ca.tx.rank[0].ck.lpde[0], 4, 0xF | (0x6 << 6)),                       \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rcs, 5, (0xE << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.ren, 5, 0xE | (0xE << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.pi.rdqs, 5, (0xE << 6)),                         \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].rx.rank[0].dqs.sdr_lpde, 5, 0xF | (0x6 << 6)),                  \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pipeline.sdr.fc_delay, 7, 0x0),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK].sdr.fc_delay, 7, 0x0),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_DQS].sdr.fc_delay, 7, 0x0),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.fc_delay, 7, 0x1111), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.fc_delay, 7, 0x1111), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.fc_delay, 7, 0x1111), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_OE].sdr.fc_delay, 7, 0x0),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCK_OE].sdr.fc_delay, 7, 0x0), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_WCS].sdr.fc_delay, 7, 0x0),   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].sdr.fc_delay, 7, 0x1111), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.pipe_en, 7, 0x0),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.pipe_en, 7, 0x0),     \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.pipe_en, 7, 0x0),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].sdr.pipe_en, 7, 0x0),    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_IE].sdr.x_sel, 7, 0x76543120), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RE].sdr.x_sel, 7, 0x76543120), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_REN].sdr.x_sel, 7, 0x76543120), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pipeline[DQS_SLICE_RCS].sdr.x_sel, 7, 0x76542020), \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[0], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[1], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[2], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[3], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[4], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[5], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[6], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[7], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.lpde[8], 7, 0x1 | (0x6 << 6)),                    \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[0], 7, 0xA | (0x6 << 6)),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.lpde[1], 7, 0xA | (0x6 << 6)),                   \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.ddr, 7, (0xE << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.qdr, 7, (0xE << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.rt, 7, (0xE << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.ddr, 7, (0xE << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.qdr, 7, (0xE << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.odr, 7, (0xE << 6)),                           \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dq.pi.rt, 7, (0xE << 6)),                            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.sdr, 7, (0xE << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, channel[0].dq[0].tx.rank[0].dqs.pi.dfi, 7, (0xE << 6)),                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.wrd, 0, (0x4 << 8) | (0x28 << 16)),                               \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dfi.paden_pext.rd, 0, 0x10 | (0x3 << 8) | (0x4 << 16) | (0x2 << 24)),            \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr1, 0, 0x7C),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.mr2, 0, 0x3F),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.txsr, 0, 412),                                                              \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_wr_lat, 0, 4),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.phy_rd_en, 0, 32),                                                          \
+    WDDR_TABLE_ENTRY(wddr_freq_cfg_t, dram.t_vref_ca_long, 0, 533),                                                    \
+}
+
+#define WDDR_TABLE_PACK_DELTA_INDEX {                                                                                  \
+    {.start = 0, .num = 91},                                                                                           \
+    {.start = 91, .num = 69},                                                                                          \
+    {.start = 160, .num = 0},                                                                                          \
+    {.start = 160, .num = 82},                                                                                         \
+}
+
+#endif /* _WDDR_TABLE_PACK_VALS_H_ */
@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _SIM_BOARD_H_
+#define _SIM_BOARD_H_
+
+/**
+ * @brief   Host Simulation Board
+ *
+ * @details All CSRs are backed by a RAM block mapped at SIM_CSR_BASE. The
+ *          PHY occupies the first WDDR_MEMORY_MAP_PHY_SLV_RSVD bytes; MCU
+ *          registers follow.
+ */
+#define SIM_CSR_BASE                        (0x40000000)
+#define SIM_CSR_SIZE                        (0x00200000)
+
+// MCU memory map
+#define MEMORY_MAP_WAV_MCU_INTF             (SIM_CSR_BASE + 0x00180000)
+#define MEMORY_MAP_WAV_MCU                  (SIM_CSR_BASE + 0x00190000)
+#define MEMORY_MAP_WAV_MCU_ITCM             (SIM_CSR_BASE + 0x001A0000)
+#define MEMORY_MAP_WAV_MCU_DTCM             (SIM_CSR_BASE + 0x001B0000)
+
+// MCU registers
+#define WAV_MCU_GP0_CFG__ADR                (0x00000000)
+#define WAV_MCU_GP1_CFG__ADR                (0x00000004)
+#define WAV_MCU_GP2_CFG__ADR                (0x00000008)
+#define WAV_MCU_GP3_CFG__ADR                (0x0000000C)
+#define WAV_MCU_IRQ_FAST_CLR_CFG__ADR       (0x00000010)
+#define WAV_MCU_IRQ_FAST_STICKY_CFG__ADR    (0x00000014)
+#define WAV_MCU_IRQ_FAST_STA__ADR           (0x00000018)
+#define WAV_MCU_IRQ_FAST_MSK_CFG__ADR       (0x0000001C)
+
+#endif /* _SIM_BOARD_H_ */
@@ -0,0 +1,28 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _SIM_CYCLES_H_
+#define _SIM_CYCLES_H_
+
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief   Get Cycles
+ *
+ * @details Host stand-in for mcycle; one cycle per nanosecond of
+ *          CLOCK_MONOTONIC. Wraps like the 32-bit counter on target.
+ *
+ * @return      current cycle count.
+ */
+static inline uint32_t get_cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t) ((uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+#endif /* _SIM_CYCLES_H_ */
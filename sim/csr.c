@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+
+/* Simulation includes. */
+#include <sim/csr.h>
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+bool sim_csr_init(void)
+{
+    void *addr;
+
+    // Firmware uses fixed 32-bit addresses; mapping must land exactly there
+    addr = mmap((void *) (uintptr_t) SIM_CSR_BASE,
+                SIM_CSR_SIZE,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS,
+                -1,
+                0);
+
+    if (addr == MAP_FAILED)
+    {
+        return false;
+    }
+
+    if (addr != (void *) (uintptr_t) SIM_CSR_BASE)
+    {
+        munmap(addr, SIM_CSR_SIZE);
+        return false;
+    }
+
+    return true;
+}
+
+/*-----------------------------------------------------------*/
+uint32_t sim_csr_read(uint32_t offset)
+{
+    return *(volatile uint32_t *) (uintptr_t) SIM_CSR_ADDR(offset);
+}
+
+/*-----------------------------------------------------------*/
+void sim_csr_write(uint32_t offset, uint32_t value)
+{
+    *(volatile uint32_t *) (uintptr_t) SIM_CSR_ADDR(offset) = value;
+}
+
+/*-----------------------------------------------------------*/
+void sim_csr_update(uint32_t offset, uint32_t mask, bool set)
+{
+    volatile uint32_t *reg = (volatile uint32_t *) (uintptr_t) SIM_CSR_ADDR(offset);
+
+    // Only the bits owned by the model change; firmware owns the rest
+    if (set)
+    {
+        __atomic_fetch_or(reg, mask, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        __atomic_fetch_and(reg, ~mask, __ATOMIC_RELAXED);
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stddef.h>
+
+/* Kernel includes. */
+#include <kernel/irq.h>
+
+/* Simulation includes. */
+#include <sim/irq.h>
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static struct
+{
+    irq_handler_t   handler;
+    void            *args;
+} irq_table[SIM_IRQ_NUM];
+
+// Interrupt lines enabled with enable_irq
+static volatile uint32_t irq_enabled;
+
+// Interrupt lines masked with interrupt_disable
+static volatile uint32_t irq_masked;
+
+// Interrupt lines raised by models
+static volatile uint32_t irq_pending;
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+int request_irq(uint32_t irq, irq_handler_t handler, void *args)
+{
+    if (irq >= SIM_IRQ_NUM)
+    {
+        return -1;
+    }
+
+    irq_table[irq].handler = handler;
+    irq_table[irq].args = args;
+    enable_irq(irq);
+    return 0;
+}
+
+/*-----------------------------------------------------------*/
+void enable_irq(uint32_t irq)
+{
+    __atomic_fetch_or(&irq_enabled, 1UL << irq, __ATOMIC_RELAXED);
+}
+
+/*-----------------------------------------------------------*/
+void disable_irq(uint32_t irq)
+{
+    __atomic_fetch_and(&irq_enabled, ~(1UL << irq), __ATOMIC_RELAXED);
+}
+
+/*-----------------------------------------------------------*/
+void interrupt_enable(uint32_t mask)
+{
+    __atomic_fetch_and(&irq_masked, ~mask, __ATOMIC_RELAXED);
+}
+
+/*-----------------------------------------------------------*/
+void interrupt_disable(uint32_t mask)
+{
+    __atomic_fetch_or(&irq_masked, mask, __ATOMIC_RELAXED);
+}
+
+/*-----------------------------------------------------------*/
+void sim_irq_raise(uint32_t irq)
+{
+    if (irq < SIM_IRQ_NUM)
+    {
+        __atomic_fetch_or(&irq_pending, 1UL << irq, __ATOMIC_RELAXED);
+    }
+}
+
+/*-----------------------------------------------------------*/
+void sim_irq_dispatch(void)
+{
+    uint32_t ready;
+    uint8_t irq;
+
+    // Disabled interrupts stay pending, like a level interrupt
+    ready = irq_pending & irq_enabled & ~irq_masked;
+    while (ready)
+    {
+        irq = __builtin_ctz(ready);
+        ready &= ~(1UL << irq);
+        __atomic_fetch_and(&irq_pending, ~(1UL << irq), __ATOMIC_RELAXED);
+
+        if (irq_table[irq].handler != NULL)
+        {
+            irq_table[irq].handler(irq, irq_table[irq].args);
+        }
+    }
+}
@@ -0,0 +1,270 @@
+/**
+ * WDDR Sim - Host simulation of the Wavious LPDDR PHY firmware
+ *
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Kernel includes. */
+#include <cycles.h>
+
+/* LPDDR includes. */
+#include <wddr/table.h>
+#include <wddr/memory_map.h>
+#include <firmware/phy_api.h>
+#include <firmware/phy_stats.h>
+
+/* Simulation includes. */
+#include <sim/csr.h>
+#include <sim/irq.h>
+#include <sim/model.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+#define SIM_TASK_PRIORITY   (tskIDLE_PRIORITY + 3)
+#define SIM_STACK_SIZE      (configMINIMAL_STACK_SIZE * 4)
+
+// Number of PREP requests per frequency
+#define PREP_ITERATIONS     (100)
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+// Stop after boot (smoke test)
+static bool boot_only;
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+/** @brief  Task that runs the simulation scenario */
+static void vSimTask(void *pvParameters);
+
+/** @brief  Internal function to print telemetry counters */
+static void print_stats(void);
+
+/** @brief  Internal function to print CSR access profile */
+static void print_csr_profile(void);
+
+/** @brief  Internal function to print boot stage timing */
+static void print_boot_report(void);
+
+/** @brief  Internal function to print poll statistics */
+static void print_poll(void);
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    boot_only = argc > 1 && strcmp(argv[1], "--boot") == 0;
+
+    if (!sim_csr_init())
+    {
+        fprintf(stderr, "Unable to map CSR block at 0x%08x\n", SIM_CSR_BASE);
+        return 1;
+    }
+
+    // Hardware runs before firmware does
+    sim_model_register_defaults();
+    sim_model_start(SIM_MODEL_PERIOD_US);
+
+    firmware_phy_init();
+    xTaskCreate(vSimTask, "Sim Task", SIM_STACK_SIZE, NULL, SIM_TASK_PRIORITY, NULL);
+    vTaskStartScheduler();
+
+    return 1;
+}
+
+/*-----------------------------------------------------------*/
+static void vSimTask(void *pvParameters)
+{
+    uint32_t start, cycles, min, max;
+    uint64_t total;
+    UBaseType_t status;
+
+    start = get_cycles();
+    status = firmware_phy_start(true, false);
+    cycles = get_cycles() - start;
+    printf("boot       %s %10u ns\n", status == pdPASS ? "pass" : "fail", cycles);
+    print_boot_report();
+    if (status != pdPASS)
+    {
+        exit(1);
+    }
+
+    if (boot_only)
+    {
+        // PLL must have locked and switched onto the boot frequency
+        exit(sim_csr_read(WDDR_MEMORY_MAP_PLL + DDR_MVP_PLL_CORE_STATUS__ADR) &
+             DDR_MVP_PLL_CORE_STATUS_CORE_READY__MSK ? 0 : 1);
+    }
+
+    printf("%-8s %10s %10s %10s\n", "freq_id", "min ns", "mean ns", "max ns");
+    for (uint8_t freq_id = 0; freq_id < WDDR_PHY_FREQ_NUM; freq_id++)
+    {
+        min = UINT32_MAX;
+        max = 0;
+        total = 0;
+
+        for (uint32_t nn = 0; nn < PREP_ITERATIONS; nn++)
+        {
+            start = get_cycles();
+            status = firmware_phy_prep_switch(freq_id);
+            cycles = get_cycles() - start;
+            if (status != pdPASS)
+            {
+                printf("prep %u failed\n", freq_id);
+                exit(1);
+            }
+
+            min = cycles < min ? cycles : min;
+            max = cycles > max ? cycles : max;
+            total += cycles;
+        }
+
+        printf("%-8u %10u %10u %10u\n",
+               freq_id, min, (uint32_t) (total / PREP_ITERATIONS), max);
+    }
+
+    print_stats();
+    print_csr_profile();
+    print_poll();
+    exit(0);
+}
+
+/*-----------------------------------------------------------*/
+static void print_stats(void)
+{
+    uint32_t value;
+    uint16_t count = firmware_phy_stats_snapshot();
+
+    printf("stats");
+    for (uint16_t stat = 0; stat < count; stat++)
+    {
+        firmware_phy_stats_read(stat, true, &value);
+        printf(" %u", value);
+    }
+    printf("\n");
+}
+
+/*-----------------------------------------------------------*/
+static void print_boot_report(void)
+{
+    uint32_t cycles;
+    static const char * const stages[FIRMWARE_PHY_BOOT_REPORT_NUM] = {
+        "pll_cal", "override", "freq_sw", "enable", "configure", "zqcal",
+        "sa_cal", "training", "dfi_prime", "vco_walk", "dfi_mode", "total",
+    };
+
+    for (uint8_t index = 0; index < FIRMWARE_PHY_BOOT_REPORT_NUM; index++)
+    {
+        firmware_phy_boot_report_read(index, &cycles);
+        printf("  %-10s %10u ns\n", stages[index], cycles);
+    }
+}
+
+/*-----------------------------------------------------------*/
+static void print_csr_profile(void)
+{
+    csr_profile_entry_t entry;
+    static const char * const phases[CSR_PROFILE_PHASE_NUM] = {
+        "idle", "boot", "prep", "zqcal", "sa_cal", "training",
+    };
+    static const char * const modules[CSR_PROFILE_MODULE_NUM] = {
+        "ca", "dq", "dfi", "cmn", "pll", "fsw", "other",
+    };
+
+    printf("%-8s %-6s %10s %10s %12s %12s\n",
+           "phase", "module", "reads", "writes", "read ns", "write ns");
+    for (uint16_t index = 0; index < FIRMWARE_PHY_CSR_PROFILE_NUM; index++)
+    {
+        firmware_phy_csr_profile_read(index, &entry);
+        if (entry.reads == 0 && entry.writes == 0)
+        {
+            continue;
+        }
+
+        printf("%-8s %-6s %10u %10u %12u %12u\n",
+               phases[index / CSR_PROFILE_MODULE_NUM],
+               modules[index % CSR_PROFILE_MODULE_NUM],
+               entry.reads, entry.writes, entry.read_cycles, entry.write_cycles);
+    }
+}
+
+/*-----------------------------------------------------------*/
+static void print_poll(void)
+{
+    wddr_poll_stats_t stats;
+    static const char * const sites[FIRMWARE_PHY_POLL_NUM] = {
+        "pll_int_en", "pll_ready", "lp_ready", "vco_fll", "pmon_done",
+        "ig_fifo", "csp_sync", "dfi_init", "fsw_start", "fsw_complete",
+        "phymstr_ack", "ctrlupd_req", "phyupd_ack",
+    };
+
+    printf("%-12s %10s %10s %10s %10s\n",
+           "site", "count", "timeouts", "mean ns", "max ns");
+    for (uint16_t site = 0; site < FIRMWARE_PHY_POLL_NUM; site++)
+    {
+        firmware_phy_poll_read(site, &stats);
+        if (stats.count == 0)
+        {
+            continue;
+        }
+
+        printf("%-12s %10u %10u %10u %10u\n",
+               sites[site], stats.count, stats.timeouts,
+               stats.cycles_total / stats.count, stats.cycles_max);
+    }
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationTickHook(void)
+{
+    // Tick runs in interrupt context of the port; deliver model interrupts
+    sim_irq_dispatch();
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationIdleHook(void)
+{
+    // Don't spin the host CPU while firmware is idle
+    usleep(100);
+}
+
+/*-----------------------------------------------------------*/
+void vApplicationMallocFailedHook(void)
+{
+    fprintf(stderr, "malloc failed\n");
+    abort();
+}
+
+/*-----------------------------------------------------------*/
+void vAssertCalled(const char * const pcFileName, unsigned long ulLine)
+{
+    fprintf(stderr, "assert %s:%lu\n", pcFileName, ulLine);
+    abort();
+}
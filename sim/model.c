@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include <kernel/io.h>
+
+/* LPDDR includes. */
+#include <wddr/memory_map.h>
+#include <wddr/phy_config.h>
+#include <cmn/cmn_reg.h>
+#include <dq/dq_reg.h>
+#include <dfi/dfich_reg.h>
+#include <dfi/dfi_fifo.h>
+
+/* Simulation includes. */
+#include <sim/csr.h>
+#include <sim/model.h>
+
+/*******************************************************************************
+**                                   MACROS
+*******************************************************************************/
+// Codes at which the ZQCAL comparator trips
+#define ZQCAL_NCAL_TRIP         (0x0C)
+#define ZQCAL_PCAL_TRIP         (0x18)
+
+// SA calibration code at which SA output trips
+#define SA_CAL_MID              (16)
+#define SA_CAL_TRIP             (19)
+
+// PMON count reported on completion
+#define PMON_COUNT              (0x1000)
+
+#define CMN_REG                 ((cmn_reg_t *) (uintptr_t) SIM_CSR_ADDR(WDDR_MEMORY_MAP_CMN))
+#define DFICH_REG               ((dfich_reg_t *) (uintptr_t) SIM_CSR_ADDR(WDDR_MEMORY_MAP_DFI_CH0))
+#define DQ_REG(ch, byte)        ((dq_reg_t *) (uintptr_t) SIM_CSR_ADDR(WDDR_MEMORY_MAP_PHY_CH_START + \
+                                    (ch) * WDDR_MEMORY_MAP_PHY_CH_OFFSET +                          \
+                                    (byte) * WDDR_MEMORY_MAP_PHY_DQ_OFFSET))
+
+/*******************************************************************************
+**                           VARIABLE DECLARATIONS
+*******************************************************************************/
+static const sim_model_t *models[SIM_MODEL_MAX];
+static uint8_t model_num;
+static uint32_t model_period_us;
+
+static const uint32_t vco_base[] = {
+    DDR_MVP_PLL_VCO0_BAND__ADR,
+    DDR_MVP_PLL_VCO1_BAND__ADR,
+    DDR_MVP_PLL_VCO2_BAND__ADR,
+};
+
+/*******************************************************************************
+**                            FUNCTION DECLARATIONS
+*******************************************************************************/
+static void pll_model_step(void);
+static void zqcal_model_step(void);
+static void sa_model_step(void);
+static void dfi_model_step(void);
+static void pmon_model_step(void);
+
+/** @brief  Internal Function that steps all models; body of host thread */
+static void *sim_model_thread(void *arg);
+
+static const sim_model_t default_models[] = {
+    {"pll",     pll_model_step},
+    {"zqcal",   zqcal_model_step},
+    {"sa",      sa_model_step},
+    {"dfi",     dfi_model_step},
+    {"pmon",    pmon_model_step},
+};
+
+/*******************************************************************************
+**                              IMPLEMENTATIONS
+*******************************************************************************/
+void sim_model_register(const sim_model_t *model)
+{
+    if (model_num < SIM_MODEL_MAX)
+    {
+        models[model_num++] = model;
+    }
+}
+
+/*-----------------------------------------------------------*/
+void sim_model_register_defaults(void)
+{
+    for (uint8_t nn = 0; nn < sizeof(default_models) / sizeof(default_models[0]); nn++)
+    {
+        sim_model_register(&default_models[nn]);
+    }
+}
+
+/*-----------------------------------------------------------*/
+void sim_model_start(uint32_t period_us)
+{
+    pthread_t thread;
+
+    model_period_us = period_us;
+    pthread_create(&thread, NULL, sim_model_thread, NULL);
+    pthread_detach(thread);
+}
+
+/*-----------------------------------------------------------*/
+static void *sim_model_thread(void *arg)
+{
+    for (;;)
+    {
+        for (uint8_t nn = 0; nn < model_num; nn++)
+        {
+            models[nn]->step();
+        }
+        usleep(model_period_us);
+    }
+
+    return NULL;
+}
+
+/*-----------------------------------------------------------*/
+static void pll_model_step(void)
+{
+    uint32_t offset, reg_val;
+
+    // FLL locks as soon as it is enabled
+    for (uint8_t vco = 0; vco < sizeof(vco_base) / sizeof(vco_base[0]); vco++)
+    {
+        offset = WDDR_MEMORY_MAP_PLL + vco_base[vco] +
+                 (DDR_MVP_PLL_VCO0_FLL_CONTROL1__ADR - DDR_MVP_PLL_VCO0_BAND__ADR);
+        reg_val = sim_csr_read(offset);
+        sim_csr_update(offset,
+                       DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_LOCKED__MSK,
+                       GET_REG_FIELD(reg_val, DDR_MVP_PLL_VCO0_FLL_CONTROL1_VCO0_FLL_ENABLE));
+    }
+
+    // Core switches instantly
+    sim_csr_update(WDDR_MEMORY_MAP_PLL + DDR_MVP_PLL_CORE_STATUS__ADR,
+                   DDR_MVP_PLL_CORE_STATUS_CORE_READY__MSK |
+                   DDR_MVP_PLL_CORE_STATUS_CORE_INITIAL_SWITCH_DONE__MSK |
+                   DDR_MVP_PLL_CORE_STATUS_FREQ_DETECT_LOCK__MSK,
+                   true);
+}
+
+/*-----------------------------------------------------------*/
+static void zqcal_model_step(void)
+{
+    bool comp;
+    uint32_t reg_val = CMN_REG->DDR_CMN_ZQCAL_CFG;
+
+    if (GET_REG_FIELD(reg_val, DDR_CMN_ZQCAL_CFG_PD_SEL))
+    {
+        comp = GET_REG_FIELD(reg_val, DDR_CMN_ZQCAL_CFG_PCAL) >= ZQCAL_PCAL_TRIP;
+    }
+    else
+    {
+        comp = GET_REG_FIELD(reg_val, DDR_CMN_ZQCAL_CFG_NCAL) >= ZQCAL_NCAL_TRIP;
+    }
+
+    CMN_REG->DDR_CMN_ZQCAL_STA = UPDATE_REG_FIELD(CMN_REG->DDR_CMN_ZQCAL_STA,
+                                                  DDR_CMN_ZQCAL_STA_COMP,
+                                                  comp);
+}
+
+/*-----------------------------------------------------------*/
+static bool sa_model_out(uint32_t code, uint32_t dir)
+{
+    // Undo sign / magnitude encoding of dq_dq_sa_set_cal_code_reg_if
+    code = dir ? SA_CAL_MID + code : SA_CAL_MID - (code + 1);
+    return code >= SA_CAL_TRIP;
+}
+
+/*-----------------------------------------------------------*/
+static void sa_model_step(void)
+{
+    dq_reg_t *dq_reg;
+    uint32_t cfg, sta;
+
+    /**
+     * @note    Outputs follow MSR0 / rank 0 calibration codes, which is
+     *          where SA calibration runs at boot.
+     */
+    for (uint8_t ch = 0; ch < WDDR_PHY_CHANNEL_NUM; ch++)
+    {
+        for (uint8_t byte = 0; byte < WDDR_PHY_DQ_BYTE_NUM; byte++)
+        {
+            dq_reg = DQ_REG(ch, byte);
+            for (uint8_t bit = 0; bit < WDDR_PHY_DQ_SLICE_NUM; bit++)
+            {
+                cfg = dq_reg->DDR_DQ_DQ_RX_SA_CFG[0][0][bit];
+                sta = dq_reg->DDR_DQ_DQ_RX_SA_STA[bit];
+                sta = UPDATE_REG_FIELD(sta, DDR_DQ_DQ_RX_SA_STA_0_SA_OUT_0,
+                        sa_model_out(GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_CODE_0),
+                                     GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_DIR_0)));
+                sta = UPDATE_REG_FIELD(sta, DDR_DQ_DQ_RX_SA_STA_0_SA_OUT_90,
+                        sa_model_out(GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_CODE_90),
+                                     GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_DIR_90)));
+                sta = UPDATE_REG_FIELD(sta, DDR_DQ_DQ_RX_SA_STA_0_SA_OUT_180,
+                        sa_model_out(GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_CODE_180),
+                                     GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_DIR_180)));
+                sta = UPDATE_REG_FIELD(sta, DDR_DQ_DQ_RX_SA_STA_0_SA_OUT_270,
+                        sa_model_out(GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_CODE_270),
+                                     GET_REG_FIELD(cfg, DDR_DQ_DQ_RX_SA_M0_R0_CFG_0_CAL_DIR_270)));
+                dq_reg->DDR_DQ_DQ_RX_SA_STA[bit] = sta;
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+static void dfi_model_step(void)
+{
+    uint32_t reg_val = DFICH_REG->DDR_DFICH_TOP_STA;
+
+    // Packets leave the IG FIFO as soon as they are written; nothing returns
+    reg_val = UPDATE_REG_FIELD(reg_val, DDR_DFICH_TOP_STA_IG_STATE, DFI_FIFO_STATE_EMPTY);
+    reg_val = UPDATE_REG_FIELD(reg_val, DDR_DFICH_TOP_STA_EG_STATE, DFI_FIFO_STATE_EMPTY);
+    DFICH_REG->DDR_DFICH_TOP_STA = reg_val;
+}
+
+/*-----------------------------------------------------------*/
+static void pmon_model_step(void)
+{
+    uint32_t reg_val = UPDATE_REG_FIELD(0x0, DDR_CMN_PMON_NAND_STA_DONE, 0x1);
+
+    reg_val = UPDATE_REG_FIELD(reg_val, DDR_CMN_PMON_NAND_STA_COUNT, PMON_COUNT);
+    CMN_REG->DDR_CMN_PMON_NAND_STA = reg_val;
+    CMN_REG->DDR_CMN_PMON_NOR_STA = reg_val;
+}
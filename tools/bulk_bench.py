@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Wavious LLC.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Compare word-at-a-time messenger reads against the bulk transfer channel.
+
+The host mailbox is a stand-in: every message costs a fixed number of cycles
+to cross the mailbox, every PHY send operation (send lock and messenger
+interrupt masking in app/wddr_main) costs a fixed overhead, and every
+request / response round trip additionally costs the host turnaround and the
+PHY main loop dispatch. The PHY side mirrors dev/messenger/bulk.c (window
+sent in one operation, go-back to last acknowledged window, CRC-32 in
+BULK_END), so the same loss pattern exercises the same rewinds. The
+"unbatched" row sends every data word in its own operation, to separate the
+gain of batching from the gain of fewer round trips.
+
+Costs are assumed cycles of the PHY MCU, not measurements; adjust them to
+match a measured system. The mailbox itself still moves one word per message,
+so msg-cycles is paid per word in every mode.
+"""
+
+import argparse
+import random
+import struct
+import zlib
+
+WINDOW = 16
+
+
+class Mailbox:
+    """Host <-> PHY mailbox stand-in that counts messages and cycles."""
+
+    def __init__(self, msg_cycles, op_cycles, turnaround, loss, seed):
+        self.msg_cycles = msg_cycles
+        self.op_cycles = op_cycles
+        self.turnaround = turnaround
+        self.loss = loss
+        self.rand = random.Random(seed)
+        self.cycles = 0
+        self.messages = 0
+
+    def send(self):
+        """Sends a message; returns whether it arrived."""
+        self.cycles += self.msg_cycles
+        self.messages += 1
+        return self.rand.random() >= self.loss
+
+    def op(self):
+        """Starts a PHY send operation."""
+        self.cycles += self.op_cycles
+
+    def round_trip(self):
+        self.cycles += self.turnaround
+
+
+def word_at_a_time(words, box):
+    """TRACE_REQ / TRACE_RESP per word; lost messages are retried."""
+    out = []
+    for word in words:
+        while True:
+            box.round_trip()
+            box.op()
+            if box.send() and box.send():
+                out.append(word)
+                break
+    return out
+
+
+def bulk(words, box, batch=True):
+    """BULK_REQ, HDR, DATA windows with BULK_ACK, END with CRC."""
+    count = len(words)
+    resent = 0
+    while True:
+        box.round_trip()
+        box.send()                      # BULK_REQ
+        box.op()
+        box.send()                      # BULK_HDR
+        index = acked = 0
+        crc = crc_acked = 0
+        out = []
+        while True:
+            if acked == count:
+                box.op()
+                box.send()              # BULK_END
+                break
+            start = index
+            received = len(out)
+            if batch:
+                box.op()                # whole window
+            while index < count and index - start < WINDOW:
+                if not batch:
+                    box.op()
+                if box.send() and received == len(out):
+                    out.append(words[index])
+                received += 1
+                crc = zlib.crc32(struct.pack("<I", words[index]), crc)
+                index += 1
+            box.round_trip()
+            box.send()                  # BULK_ACK
+            if len(out) == index:
+                acked = index
+                crc_acked = crc
+            else:
+                resent += index - acked
+                del out[acked:]
+                index = acked
+                crc = crc_acked
+        host_crc = zlib.crc32(b"".join(struct.pack("<I", w) for w in out))
+        if host_crc == crc:
+            return out, resent
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--words", type=int, default=516,
+                        help="number of words to transfer (default trace ring)")
+    parser.add_argument("--msg-cycles", type=int, default=200,
+                        help="cycles to move one message through the mailbox")
+    parser.add_argument("--op-cycles", type=int, default=150,
+                        help="cycles of PHY send lock and interrupt masking per send")
+    parser.add_argument("--turnaround", type=int, default=2000,
+                        help="cycles of host turnaround per round trip")
+    parser.add_argument("--loss", type=float, default=0.0,
+                        help="probability that a data message is lost")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    rand = random.Random(args.seed)
+    words = [rand.getrandbits(32) for _ in range(args.words)]
+
+    modes = (
+        ("word", word_at_a_time),
+        ("unbatched", lambda w, b: bulk(w, b, batch=False)),
+        ("bulk", bulk),
+    )
+
+    rows = []
+    for name, func in modes:
+        box = Mailbox(args.msg_cycles, args.op_cycles, args.turnaround, args.loss, args.seed)
+        result = func(words, box)
+        out, resent = result if isinstance(result, tuple) else (result, 0)
+        assert out == words, name
+        rows.append((name, box.messages, box.cycles, resent))
+
+    print("%-9s %10s %12s %10s %8s" % ("mode", "messages", "cycles", "cyc/word", "resent"))
+    for name, messages, cycles, resent in rows:
+        print("%-9s %10d %12d %10.1f %8d" %
+              (name, messages, cycles, cycles / max(args.words, 1), resent))
+    print("speedup vs word %.2fx, batching alone %.2fx" %
+          (rows[0][2] / max(rows[2][2], 1), rows[1][2] / max(rows[2][2], 1)))
+
+
+if __name__ == "__main__":
+    main()
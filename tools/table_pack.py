@@ -0,0 +1,429 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Wavious LLC.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Pack the generated WDDR configuration table into baseline + delta form.
+
+Reads the table generated by cfg_table_creator.py (table_defs.h and
+table_vals.h) and writes table_pack_vals.h, which is unpacked into a zero
+initialized wddr_table_t by wddr_table_unpack (dev/wddr/table_pack.c):
+
+  * one baseline frequency (the one that needs the fewest deltas), without
+    fields that are zero;
+  * per-frequency deltas against the baseline;
+  * fields that hold the same value in every channel, DQ byte and / or rank
+    are folded into a single entry that is replicated when unpacked (see
+    wddr_table_rep_t); replication strides are emitted as sizeof expressions
+    so the packed table doesn't depend on the host's struct layout;
+  * pointers into the table (driver ZQCAL codes) are stored as offsets into
+    wddr_table_t and relocated when unpacked;
+  * bit fields (PI, LPDE, driver override and DFI register images) are merged
+    into a single entry for their containing register; bit positions are
+    taken from the bit field declarations in include/table/*/*.h.
+
+Entry encoding mirrors wddr_table_entry_t in include/table/wddr/table.h.
+Run whenever table_vals.h is regenerated:
+
+    tools/table_pack.py include/table
+"""
+
+import argparse
+import collections
+import datetime
+import getpass
+import glob
+import os
+import re
+
+WIDTH = 119
+
+ENTRY_RE = re.compile(r"^\s*(\.\S+) = (.+?),\s*\\$", re.M)
+BLOCK_RE = re.compile(r"#define (WDDR_TABLE_CFG__WDDR__\w+)\(name\) \{(.*?)\n\}", re.S)
+DEFINE_RE = re.compile(r"^#define (\w+)(\(\w+\))? (.+)$", re.M)
+POINTER_RE = re.compile(r"^name\.(\w+)$")
+TYPE_BITS = {"uint8_t": 8, "uint16_t": 16, "uint32_t": 32}
+
+# Replicated dimensions, outermost first; mirrors WDDR_TABLE_REP_DIM_*
+DIMS = [
+    re.compile(r"(channel)\[(\d+)\]"),
+    re.compile(r"(dq)\[(\d+)\](?=\.(?:tx|rx)\b)"),
+    re.compile(r"(rank)\[(\d+)\]"),
+]
+
+
+class Aggregate:
+    """Structure or union declared in a table header."""
+
+    def __init__(self, kind):
+        self.kind = kind
+        self.name = ""
+        self.members = {}       # name: (type name or Aggregate, bit field width)
+        self.anonymous = []     # anonymous aggregates whose members are ours
+
+
+def parse_aggregates(text, types):
+    """Adds aggregates of a header to types {type / declarator name: Aggregate}."""
+    text = re.sub(r"/\*.*?\*/|//[^\n]*", "", text, flags=re.S)
+    stack = []
+    for match in re.finditer(r"\b(struct|union)\b[^{;]*\{|\}\s*(\w*)", text):
+        if match.group(1):
+            stack.append((Aggregate(match.group(1)), match.end(), []))
+            continue
+        if not stack:
+            continue
+        node, start, children = stack.pop()
+        node.name = match.group(2)
+        raw = text[start:match.start()]
+        if stack:
+            stack[-1][2].append((node, raw))
+
+        # Declarations at this nesting level
+        body = raw
+        for child, child_raw in children:
+            body = body.replace(child_raw, "", 1)
+        child_iter = iter(children)
+        for decl in body.split(";"):
+            decl = re.sub(r"\b(const|volatile)\b", "", decl).strip()
+            if not decl:
+                continue
+            if re.match(r"(struct|union)\b[^{]*\{\s*\}", decl):
+                child = next(child_iter)[0]
+                if child.name:
+                    node.members[child.name] = (child, None)
+                else:
+                    node.anonymous.append(child)
+                continue
+            member = re.match(r"(\w+)[\s*]+(\w+)\s*(?:\[.*\])?\s*(?::\s*(\d+))?$", decl)
+            if member:
+                width = int(member.group(3)) if member.group(3) else None
+                node.members[member.group(2)] = (member.group(1), width)
+        if not stack and node.name:
+            types[node.name] = node
+
+
+def find_member(node, name):
+    """Returns (aggregate declaring member, (type, width)) or (None, None)."""
+    if name in node.members:
+        return node, node.members[name]
+    for child in node.anonymous:
+        owner, member = find_member(child, name)
+        if owner:
+            return owner, member
+    return None, None
+
+
+def bit_layout(node):
+    """Returns {member: (shift, width)} of the bit fields of an aggregate."""
+    layout = {}
+    shift = 0
+    for member, (type_name, width) in node.members.items():
+        bits = TYPE_BITS[type_name]
+        # Bit fields don't straddle storage units
+        if shift // bits != (shift + width - 1) // bits:
+            shift = (shift + bits - 1) // bits * bits
+        layout[member] = (shift, width)
+        shift += width
+    return layout
+
+
+def bitfield(types, root, field):
+    """Returns (container, (shift, width)) if field is a bit field, else None.
+
+    Container is the register the bit field is written through: the
+    enclosing union if the bit field structure is a union member (anonymous
+    or "fields"), otherwise the bit field structure itself.
+    """
+    node = types[root]
+    path = []
+    components = field[1:].split(".")
+    for nn, component in enumerate(components):
+        name = re.sub(r"\[.*?\]", "", component)
+        owner, member = find_member(node, name)
+        if owner is None:
+            raise ValueError("unknown member %s of %s" % (field, root))
+        type_name, width = member
+        if width is not None:
+            if nn != len(components) - 1:
+                raise ValueError("bit field %s has members" % field)
+            container = path[:-1] if owner.name == "fields" else path
+            return "." + ".".join(container), bit_layout(owner)[name]
+        path.append(component)
+        node = type_name if isinstance(type_name, Aggregate) else types.get(type_name)
+        if node is None:
+            return None
+    return None
+
+
+def merge_bitfields(fields, types, root):
+    """Returns fields with bit fields merged into their containing register.
+
+    Merged value is a C expression so that enumerated values stay symbolic.
+    """
+    containers = collections.OrderedDict()
+    merged = collections.OrderedDict()
+    for field, value in fields.items():
+        info = bitfield(types, root, field)
+        if info is None:
+            merged[field] = value
+            continue
+        container, (shift, width) = info
+        if container not in containers:
+            containers[container] = []
+            merged[container] = None
+        if is_zero(value):
+            continue
+        if re.match(r"^(0x[0-9a-fA-F]+|\d+)$", value) and int(value, 0) >> width:
+            raise ValueError("%s = %s doesn't fit in %d bits" % (field, value, width))
+        containers[container].append((shift, value if shift == 0 else "(%s << %d)" % (value, shift)))
+
+    for container, terms in containers.items():
+        merged[container] = " | ".join(term for _, term in sorted(terms)) if terms else "0"
+    return merged
+
+
+def parse_blocks(text):
+    """Returns {block name: OrderedDict(field: value)} of table_vals.h."""
+    blocks = {}
+    for name, body in BLOCK_RE.findall(text):
+        fields = collections.OrderedDict()
+        for match in ENTRY_RE.finditer(body):
+            fields[match.group(1)] = match.group(2)
+        blocks[name] = fields
+    return blocks
+
+
+def resolve_pointer(value, defines):
+    """Returns designator within wddr_table_t of a pointer value or None."""
+    match = POINTER_RE.match(value)
+    if not match:
+        return None
+
+    # Expand object / single argument function-like macros until fixed
+    expr = match.group(1)
+    for _ in range(8):
+        prev = expr
+        for name, (arg, body) in defines.items():
+            if arg is None:
+                expr = re.sub(r"\b%s\b" % name, body, expr)
+            else:
+                expr = re.sub(r"\b%s\((\w+)\)" % name,
+                              lambda m, a=arg, b=body: re.sub(r"\b%s\b" % a, m.group(1), b),
+                              expr)
+        if expr == prev:
+            break
+    return expr
+
+
+def is_zero(value):
+    try:
+        return int(value, 0) == 0
+    except ValueError:
+        return False
+
+
+def dim_indices(field):
+    """Returns (pattern with replicated indices wildcarded, indices per dim)."""
+    indices = []
+    for dim in DIMS:
+        match = dim.search(field)
+        indices.append(int(match.group(2)) if match else None)
+        if match:
+            field = field[:match.start(2)] + "*" + field[match.end(2):]
+    return field, tuple(indices)
+
+
+def fold(fields, counts):
+    """Returns [(first field, replicated dims, value)].
+
+    Fields that share a pattern and value are folded over the largest set of
+    dimensions (tried outermost first) whose full product is present.
+    """
+    groups = collections.OrderedDict()
+    for field, value in fields.items():
+        pattern, indices = dim_indices(field)
+        groups.setdefault((pattern, value), {})[indices] = field
+
+    entries = []
+    for (pattern, value), members in groups.items():
+        present = [nn for nn in range(len(DIMS)) if next(iter(members))[nn] is not None]
+        remaining = dict(members)
+        # Candidate dimension sets, largest first
+        candidates = [[d for d in present if mask & (1 << d)] for mask in range((1 << len(DIMS)) - 1, 0, -1)]
+        candidates = sorted((c for c in candidates if c), key=len, reverse=True)
+        for dims in candidates:
+            for indices in sorted(remaining):
+                if indices not in remaining:
+                    continue
+                cover = [()]
+                for d in range(len(DIMS)):
+                    values = range(counts[d]) if d in dims else [indices[d]]
+                    cover = [c + (v,) for c in cover for v in values]
+                if all(c in remaining for c in cover):
+                    first = tuple(0 if d in dims else indices[d] for d in range(len(DIMS)))
+                    entries.append((remaining[first], tuple(dims), value))
+                    for c in cover:
+                        del remaining[c]
+        for indices, field in remaining.items():
+            entries.append((field, (), value))
+    return entries
+
+
+def rep_set(type_name, field, dims, counts):
+    """Returns C initializer of the replication set of a folded field."""
+    if not dims:
+        return None
+    stride = []
+    num = []
+    for d, dim in enumerate(DIMS):
+        match = dim.search(field)
+        if d in dims:
+            container = field[1:match.end()]
+            stride.append("sizeof(((%s *) 0)->%s)" % (type_name, container))
+            num.append(str(counts[d]))
+        else:
+            stride.append("0")
+            num.append("1")
+    return "{.stride = {%s}, .num = {%s}}" % (", ".join(stride), ", ".join(num))
+
+
+def entry(type_name, field, rep, value, defines):
+    field = field[1:]
+    pointer = resolve_pointer(value, defines)
+    if pointer is not None:
+        return "WDDR_TABLE_ENTRY_PTR(%s, %s, %d, %s)" % (type_name, field, rep, pointer)
+    return "WDDR_TABLE_ENTRY(%s, %s, %d, %s)" % (type_name, field, rep, value)
+
+
+class Packer:
+    """Collects entries and their replication sets."""
+
+    def __init__(self, counts, defines):
+        self.counts = counts
+        self.defines = defines
+        self.reps = ["{.stride = {0, 0, 0}, .num = {1, 1, 1}}"]
+
+    def pack(self, type_name, fields):
+        lines = []
+        for field, dims, value in fold(fields, self.counts):
+            rep = rep_set(type_name, field, dims, self.counts)
+            if rep is None:
+                index = 0
+            else:
+                if rep not in self.reps:
+                    self.reps.append(rep)
+                index = self.reps.index(rep)
+            lines.append(entry(type_name, field, index, value, self.defines))
+        return lines
+
+
+def macro(name, lines):
+    out = [("#define %s {" % name).ljust(WIDTH - 1) + " \\"]
+    out += [("    %s," % line).ljust(WIDTH - 1) + " \\" for line in lines]
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("table_dir", help="table include directory (include/table)")
+    parser.add_argument("-o", "--output", help="output file (default <table_dir>/wddr/table_pack_vals.h)")
+    args = parser.parse_args()
+
+    defs = open(os.path.join(args.table_dir, "wddr", "table_defs.h")).read()
+    vals = open(os.path.join(args.table_dir, "wddr", "table_vals.h")).read()
+    types = {}
+    for header in sorted(glob.glob(os.path.join(args.table_dir, "*", "*.h"))):
+        if not header.endswith("_vals.h"):
+            parse_aggregates(open(header).read(), types)
+
+    freq_num = int(re.search(r"#define WDDR_PHY_FREQ_NUM\s+\((\d+)\)", defs).group(1))
+    valid = re.search(r"#define WDDR_FREQ_VALID_TABLE \{(.*?)\n\}", defs, re.S).group(1)
+    valid = re.findall(r"FREQ_(?:IN)?VALID", valid)
+
+    defines = {}
+    for name, arg, body in DEFINE_RE.findall(vals):
+        if not name.startswith("WDDR_TABLE_CFG") and not name.startswith("_"):
+            defines[name] = (arg[1:-1] if arg else None, body.strip())
+
+    blocks = parse_blocks(vals)
+    blocks = {name: merge_bitfields(fields, types,
+                                    "wddr_common_cfg_t" if name.endswith("COMMON") else "wddr_freq_cfg_t")
+              for name, fields in blocks.items()}
+    common = blocks["WDDR_TABLE_CFG__WDDR__COMMON"]
+    freqs = [blocks["WDDR_TABLE_CFG__WDDR__FREQID_%d" % f] for f in range(freq_num)]
+
+    def delta(base, freq):
+        return collections.OrderedDict((k, v) for k, v in freq.items() if base.get(k) != v)
+
+    # Baseline is the frequency the others differ least from
+    base_id = min(range(freq_num),
+                  key=lambda b: sum(len(delta(freqs[b], f)) for f in freqs))
+    base = freqs[base_id]
+
+    base_fields = collections.OrderedDict((k, v) for k, v in base.items() if not is_zero(v))
+    common_fields = collections.OrderedDict((k, v) for k, v in common.items() if not is_zero(v))
+
+    # Number of instances of each replicated dimension
+    counts = [0] * len(DIMS)
+    for fields in [common] + freqs:
+        for field in fields:
+            for d, index in enumerate(dim_indices(field)[1]):
+                if index is not None:
+                    counts[d] = max(counts[d], index + 1)
+
+    packer = Packer(counts, defines)
+    common_lines = packer.pack("wddr_common_cfg_t", common_fields)
+    base_lines = packer.pack("wddr_freq_cfg_t", base_fields)
+
+    delta_lines = []
+    index_lines = []
+    for freq_id in range(freq_num):
+        lines = []
+        if freq_id != base_id:
+            lines = packer.pack("wddr_freq_cfg_t", delta(base, freqs[freq_id]))
+        index_lines.append("{.start = %d, .num = %d}" % (len(delta_lines), len(lines)))
+        delta_lines += lines
+
+    banner = """/**
+ * Copyright (c) 2021 Wavious LLC.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/****************************************************************************
+*****************************************************************************
+** Tool used: table_pack.py
+** Generated by: %s
+** Date: %s
+** Input file used: table_vals.h
+** Entries: common %d, baseline %d, deltas %d (of %d fields per frequency)
+** Replication sets: %d
+*****************************************************************************
+****************************************************************************/
+""" % (getpass.getuser(),
+       datetime.datetime.now().strftime("%m/%d/%y %H:%M:%S"),
+       len(common_lines), len(base_lines), len(delta_lines), len(base), len(packer.reps))
+
+    out = banner
+    out += "\n#ifndef _WDDR_TABLE_PACK_VALS_H_\n#define _WDDR_TABLE_PACK_VALS_H_\n\n"
+    out += "#define WDDR_TABLE_PACK_BASE_FREQ   (%d)\n\n" % base_id
+    out += macro("WDDR_TABLE_PACK_VALID", valid) + "\n"
+    out += macro("WDDR_TABLE_PACK_REP", packer.reps) + "\n"
+    out += macro("WDDR_TABLE_PACK_COMMON", common_lines) + "\n"
+    out += macro("WDDR_TABLE_PACK_BASE", base_lines) + "\n"
+    out += macro("WDDR_TABLE_PACK_DELTA", delta_lines) + "\n"
+    out += macro("WDDR_TABLE_PACK_DELTA_INDEX", index_lines) + "\n"
+    out += "#endif /* _WDDR_TABLE_PACK_VALS_H_ */\n"
+
+    output = args.output or os.path.join(args.table_dir, "wddr", "table_pack_vals.h")
+    with open(output, "w") as f:
+        f.write(out)
+
+    print("baseline freq %d: common %d, baseline %d, deltas %d entries, %d replication sets" %
+          (base_id, len(common_lines), len(base_lines), len(delta_lines), len(packer.reps)))
+
+
+if __name__ == "__main__":
+    main()
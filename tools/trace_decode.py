@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Wavious LLC.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+"""Decode a WDDR firmware trace ring dump and rebuild switch timelines.
+
+The dump is either the words returned by MESSAGE_WDDR_TRACE_REQ (one 32-bit
+word per line, hex) starting at word 0, or a raw little-endian memory dump
+of the .noinit.wddr_trace section (--bin).
+
+ID, event and state names mirror include/firmware/phy_trace.h,
+include/firmware/phy_task.h and firmware/phy_task.c.
+"""
+
+import argparse
+import struct
+import sys
+
+TRACE_MAGIC = 0x54524345
+HEADER_WORDS = 4
+ENTRY_WORDS = 4
+
+TRACE_IDS = [
+    "BOOT",
+    "POST",
+    "POST_ISR",
+    "MERGE",
+    "DEQUEUE",
+    "DEFER",
+    "REPLAY",
+    "HANDLE_START",
+    "HANDLE_END",
+    "PLL_IRQ",
+    "LP",
+]
+
+EVENTS = [
+    "BOOT",
+    "PREP",
+    "PHYUPD_REQ",
+    "PHYMSTR_REQ",
+    "PHYMSTR_EXIT",
+    "INIT_START",
+    "INIT_COMPLETE",
+    "PLL_INIT_LOCK",
+    "PLL_LOCK",
+    "PLL_LOSS_LOCK",
+    "PHYMSTR_ACK",
+    "PHYMSTR_ABORT",
+    "PHYUPD_ACK",
+    "PHYUPD_ABORT",
+    "CTRLUPD_ASSERT",
+    "CTRLUPD_DEASSERT",
+    "LP_DATA_REQ",
+    "LP_CTRL_REQ",
+    "VCO_CAL",
+    "FREQ_STORE",
+    "EYE_SCAN",
+]
+
+# WDDR_LP_LEVEL_* flags in include/dev/wddr/lp.h
+LP_LEVELS = ["CLK_GATE", "ANALOG", "DRAM_PD", "DEEP_SLEEP"]
+
+FSW_STATES = ["PREP", "PENDING"]
+DFI_STATES = ["IDLE", "PHYMSTR_PENDING", "PHYMSTR", "PHYUPD", "CTRLUPD"]
+
+
+def name(table, index):
+    return table[index] if index < len(table) else "-"
+
+
+def state_name(state):
+    if state == 0xFF:
+        return "-"
+    return "%s/%s" % (name(FSW_STATES, state >> 4), name(DFI_STATES, state & 0xF))
+
+
+def read_words(path, binary):
+    if binary:
+        with open(path, "rb") as f:
+            data = f.read()
+        count = len(data) // 4
+        return list(struct.unpack("<%dI" % count, data[:count * 4]))
+
+    words = []
+    with open(path) as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if line:
+                words.append(int(line, 16))
+    return words
+
+
+def parse(words):
+    if len(words) < HEADER_WORDS or words[0] != TRACE_MAGIC:
+        raise ValueError("trace ring magic not found")
+
+    length, head, boots = words[1], words[2], words[3]
+    entries = []
+    for nn in range(length):
+        base = HEADER_WORDS + nn * ENTRY_WORDS
+        if base + ENTRY_WORDS > len(words):
+            break
+        cycles, info, arg, seq = words[base:base + ENTRY_WORDS]
+        if seq == 0:
+            continue
+        entries.append({
+            "seq": seq,
+            "cycles": cycles,
+            "id": info & 0xFF,
+            "event": (info >> 8) & 0xFF,
+            "state": (info >> 16) & 0xFF,
+            "arg": arg,
+        })
+
+    entries.sort(key=lambda e: e["seq"])
+    return length, head, boots, entries
+
+
+def delta(start, end):
+    return (end - start) & 0xFFFFFFFF
+
+
+def print_timeline(entries):
+    prev = None
+    print("%8s %12s %10s  %-12s %-16s %-24s %s" %
+          ("seq", "cycles", "delta", "id", "event", "state", "arg"))
+    for e in entries:
+        if e["id"] == TRACE_IDS.index("BOOT"):
+            prev = None
+        d = delta(prev, e["cycles"]) if prev is not None else 0
+        print("%8d %12d %10d  %-12s %-16s %-24s 0x%08x" %
+              (e["seq"], e["cycles"], d, name(TRACE_IDS, e["id"]),
+               name(EVENTS, e["event"]), state_name(e["state"]), e["arg"]))
+        prev = e["cycles"]
+
+
+def switch_timelines(entries):
+    """Returns list of (freq_id, prep, wait, post) cycle tuples.
+
+    prep    PREP handler start to end.
+    wait    PREP handler end to INIT_START posted by ISR.
+    post    INIT_START posted to PLL_LOCK handler end.
+    """
+    start_id = TRACE_IDS.index("HANDLE_START")
+    end_id = TRACE_IDS.index("HANDLE_END")
+    isr_id = TRACE_IDS.index("POST_ISR")
+    boot_id = TRACE_IDS.index("BOOT")
+
+    switches = []
+    cur = None
+    for e in entries:
+        ev = name(EVENTS, e["event"])
+        if e["id"] == boot_id:
+            cur = None
+        elif e["id"] == start_id and ev == "PREP":
+            cur = {"freq_id": e["arg"], "prep_start": e["cycles"]}
+        elif cur is None:
+            continue
+        elif e["id"] == end_id and ev == "PREP":
+            cur["prep_end"] = e["cycles"]
+        elif e["id"] == isr_id and ev == "INIT_START" and "prep_end" in cur:
+            cur["init_start"] = e["cycles"]
+        elif e["id"] == end_id and ev == "PLL_LOCK" and "init_start" in cur:
+            switches.append((cur["freq_id"],
+                             delta(cur["prep_start"], cur["prep_end"]),
+                             delta(cur["prep_end"], cur["init_start"]),
+                             delta(cur["init_start"], e["cycles"])))
+            cur = None
+    return switches
+
+
+def lp_level_name(levels):
+    names = [n for nn, n in enumerate(LP_LEVELS) if levels & (1 << nn)]
+    return "|".join(names) if names else "ON"
+
+
+def lp_transitions(entries):
+    """Returns (transitions, residency).
+
+    transitions     list of (event, levels, latency) tuples; latency is
+                    LP handler start to levels being reached.
+    residency       dict of levels to total cycles spent at those levels.
+    """
+    start_id = TRACE_IDS.index("HANDLE_START")
+    lp_id = TRACE_IDS.index("LP")
+    boot_id = TRACE_IDS.index("BOOT")
+
+    transitions = []
+    residency = {}
+    start = None
+    cur = None
+    for e in entries:
+        if e["id"] == boot_id:
+            start = None
+            cur = None
+        elif e["id"] == start_id and name(EVENTS, e["event"]).startswith("LP_"):
+            start = e["cycles"]
+        elif e["id"] == lp_id:
+            if cur is not None:
+                residency[cur[0]] = residency.get(cur[0], 0) + delta(cur[1], e["cycles"])
+            latency = delta(start, e["cycles"]) if start is not None else 0
+            transitions.append((name(EVENTS, e["event"]), e["arg"], latency))
+            cur = (e["arg"], e["cycles"])
+            start = None
+    return transitions, residency
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="trace ring dump")
+    parser.add_argument("--bin", action="store_true", help="dump is raw little-endian memory")
+    parser.add_argument("--threshold", type=int, default=0,
+                        help="flag switches whose post time exceeds this many cycles")
+    parser.add_argument("--switches-only", action="store_true", help="only print switch timelines")
+    args = parser.parse_args()
+
+    try:
+        length, head, boots, entries = parse(read_words(args.dump, args.bin))
+    except (OSError, ValueError) as err:
+        sys.exit("error: %s" % err)
+
+    print("ring: %d entries, %d written, %d boots, %d valid" % (length, head, boots, len(entries)))
+    if head > length:
+        print("note: ring wrapped; oldest %d entries were overwritten" % (head - length))
+
+    if not args.switches_only:
+        print()
+        print_timeline(entries)
+
+    switches = switch_timelines(entries)
+    print()
+    print("%4s %8s %12s %12s %12s" % ("#", "freq_id", "prep", "wait", "post"))
+    for nn, (freq_id, prep, wait, post) in enumerate(switches):
+        flag = "  <-- outlier" if args.threshold and post > args.threshold else ""
+        print("%4d %8d %12d %12d %12d%s" % (nn, freq_id, prep, wait, post, flag))
+
+    transitions, residency = lp_transitions(entries)
+    if transitions:
+        print()
+        print("%4s %-14s %-36s %12s" % ("#", "event", "levels", "latency"))
+        for nn, (event, levels, latency) in enumerate(transitions):
+            print("%4d %-14s %-36s %12d" % (nn, event, lp_level_name(levels), latency))
+
+        total = sum(residency.values())
+        print()
+        print("%-36s %12s %8s" % ("levels", "residency", "%"))
+        for levels in sorted(residency):
+            pct = 100.0 * residency[levels] / total if total else 0.0
+            print("%-36s %12d %7.1f%%" % (lp_level_name(levels), residency[levels], pct))
+
+
+if __name__ == "__main__":
+    main()